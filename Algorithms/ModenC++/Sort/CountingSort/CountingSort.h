@@ -14,14 +14,29 @@
 
 #include <algorithm>
 #include <iterator> // for std::next()
+#include <type_traits>
 #include <vector>
 
+#include "../RadixSort/RadixSort.h"
+
+namespace custom
+{
+    // Counters allowed beyond one per element before falling back to radix
+    constexpr std::size_t COUNTING_SORT_SLACK = 1 << 16;
+}
+
 /**
  * @brief
- *
+ * Counting sort: counts every value between the minimum and the maximum
+ * and writes the values back in order. It needs one counter per possible
+ * value, so when the range is much larger than the number of elements,
+ * which a single outlier is enough for, and for floating point values, it
+ * hands over to lsd_radix_sort() instead.
  * @tparam ForwardIterator
  * @param first
  * @param last
+ * @time complexity O(N + range), O(N) beyond that
+ * @space complexity O(min(range, N))
  */
 template <typename ForwardIterator>
 void counting_sort(ForwardIterator first, ForwardIterator last)
@@ -29,23 +44,48 @@ void counting_sort(ForwardIterator first, ForwardIterator last)
     if (first == last || std::next(first) == last)
         return;
 
-    auto minmax{std::minmax_element(first, last)};
-    auto min{*minmax.first};
-    auto max{*minmax.second};
-
-    if (min == max)
-        return;
-
+    using value_type = typename std::iterator_traits<ForwardIterator>::value_type;
     using difference_type =
         typename std::iterator_traits<ForwardIterator>::difference_type;
 
-    std::vector<difference_type> counts(max - min + 1, 0);
+    auto const radix_sort{[&]
+                          {
+                              std::vector<value_type> values(first, last);
+
+                              lsd_radix_sort(values.begin(), values.end());
+                              std::copy(values.begin(), values.end(), first);
+                          }};
+
+    if constexpr (!std::is_integral_v<value_type>)
+        radix_sort();
+    else
+    {
+        auto minmax{std::minmax_element(first, last)};
+        auto min{*minmax.first};
+        auto max{*minmax.second};
+
+        if (min == max)
+            return;
+
+        // In the unsigned key space the range cannot overflow
+        auto const base{custom::radix_key(min)};
+        auto const range{static_cast<std::size_t>(custom::radix_key(max) - base)};
+        auto const N{static_cast<std::size_t>(std::distance(first, last))};
+
+        if (range >= N + custom::COUNTING_SORT_SLACK)
+        {
+            radix_sort();
+            return;
+        }
+
+        std::vector<difference_type> counts(range + 1, 0);
 
-    for (auto it{first}; it != last; ++it)
-        ++counts[*it - min];
+        for (auto it{first}; it != last; ++it)
+            ++counts[custom::radix_key(*it) - base];
 
-    for (auto count : counts)
-        first = std::fill_n(first, count, min++);
+        for (std::size_t i{}; i < counts.size(); ++i)
+            first = std::fill_n(first, counts[i], static_cast<value_type>(min + static_cast<value_type>(i)));
+    }
 }
 
-#endif //! COUNTING_SORT_H
\ No newline at end of file
+#endif //! COUNTING_SORT_H
@@ -0,0 +1,698 @@
+/**
+ * @file ExternalSort.h
+ * @author Carlos Salguero
+ * @brief External Merge Sort Algorithm for files larger than the memory,
+ * on POSIX systems
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef EXTERNAL_SORT_H
+#define EXTERNAL_SORT_H
+
+#include <algorithm>          // std::min(), std::max()
+#include <atomic>
+#include <cerrno>             // errno
+#include <condition_variable>
+#include <cstddef>            // std::size_t, std::byte
+#include <cstdint>            // std::uint64_t
+#include <deque>
+#include <filesystem>
+#include <functional>         // std::less<>, std::function
+#include <future>             // std::packaged_task, std::future
+#include <memory>             // std::unique_ptr
+#include <mutex>
+#include <new>                // std::align_val_t
+#include <numeric>            // std::lcm()
+#include <stdexcept>          // std::invalid_argument
+#include <string>
+#include <system_error>       // std::system_error
+#include <thread>
+#include <type_traits>        // std::is_trivially_copyable_v
+#include <utility>            // std::exchange(), std::move(), std::swap()
+#include <vector>
+
+#include <fcntl.h>  // open(), posix_fadvise()
+#include <unistd.h> // pread(), pwrite(), ftruncate(), close(), getpid()
+
+#include "../MergeSort/LoserTree.h"
+#include "../QuickSort/QuickSort.h"
+
+/**
+ * @brief
+ * Settings of external_sort()
+ */
+struct ExternalSortOptions
+{
+    // Bytes of records and I/O buffers held in memory at once
+    std::size_t memory_budget{std::size_t{1} << 30};
+
+    // Directory of the sorted runs, which need as much room as the input
+    std::filesystem::path temp_directory{std::filesystem::temp_directory_path()};
+
+    // Bypass the page cache with O_DIRECT where the file system allows it
+    bool direct_io{false};
+};
+
+namespace custom
+{
+    // Alignment of the buffers, offsets and sizes of direct I/O
+    constexpr std::size_t EXTERNAL_ALIGNMENT = 4096;
+
+    // Smallest read buffer of a run during a merge; fewer runs are merged
+    // at once rather than reading them in smaller pieces
+    constexpr std::size_t EXTERNAL_MERGE_BUFFER = std::size_t{1} << 20;
+
+    /**
+     * @brief
+     * Error of a system call, with the file it failed on
+     */
+    inline std::system_error external_error(const std::string &call, const std::filesystem::path &path)
+    {
+        return std::system_error{errno, std::generic_category(), call + " " + path.string()};
+    }
+
+    /**
+     * @brief
+     * Buffer of bytes aligned for direct I/O
+     */
+    class AlignedBuffer
+    {
+    public:
+        AlignedBuffer() = default;
+
+        explicit AlignedBuffer(std::size_t size)
+            : m_data{static_cast<std::byte *>(::operator new[](size, std::align_val_t{EXTERNAL_ALIGNMENT}))},
+              m_size{size}
+        {
+        }
+
+        AlignedBuffer(AlignedBuffer &&other) noexcept
+            : m_data{std::exchange(other.m_data, nullptr)}, m_size{std::exchange(other.m_size, 0)}
+        {
+        }
+
+        AlignedBuffer &operator=(AlignedBuffer &&other) noexcept
+        {
+            std::swap(m_data, other.m_data);
+            std::swap(m_size, other.m_size);
+            return *this;
+        }
+
+        ~AlignedBuffer()
+        {
+            if (m_data != nullptr)
+                ::operator delete[](m_data, std::align_val_t{EXTERNAL_ALIGNMENT});
+        }
+
+        std::byte *data() const { return m_data; }
+        std::size_t get_size() const { return m_size; }
+
+        template <class T>
+        T *as() const { return reinterpret_cast<T *>(m_data); }
+
+    private:
+        std::byte *m_data{nullptr};
+        std::size_t m_size{};
+    };
+
+    /**
+     * @brief
+     * File descriptor with positioned reads and writes that retry until
+     * the whole request is done. Opened with O_DIRECT, sizes and offsets
+     * have to be multiples of EXTERNAL_ALIGNMENT; a file system that
+     * refuses O_DIRECT (tmpfs) is used through the page cache instead.
+     */
+    class ExternalFile
+    {
+    public:
+        ExternalFile(const std::filesystem::path &path, int flags, bool direct)
+            : m_path{path}
+        {
+#ifdef O_DIRECT
+            if (direct)
+            {
+                m_fd = ::open(path.c_str(), flags | O_DIRECT, 0644);
+
+                if (m_fd < 0 && errno != EINVAL)
+                    throw external_error("open", path);
+            }
+#endif
+
+            if (m_fd < 0)
+            {
+                m_fd = ::open(path.c_str(), flags, 0644);
+
+                if (m_fd < 0)
+                    throw external_error("open", path);
+
+                ::posix_fadvise(m_fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+            }
+        }
+
+        ExternalFile(const ExternalFile &) = delete;
+        ExternalFile &operator=(const ExternalFile &) = delete;
+
+        ~ExternalFile() { ::close(m_fd); }
+
+        /**
+         * @brief
+         * Read up to size bytes at offset
+         * @return std::size_t Bytes read, fewer only at the end of the file
+         */
+        std::size_t read(std::byte *data, std::size_t size, std::uint64_t offset) const
+        {
+            std::size_t done{};
+
+            while (done < size)
+            {
+                auto const count{::pread(m_fd, data + done, size - done, static_cast<off_t>(offset + done))};
+
+                if (count < 0 && errno == EINTR)
+                    continue;
+
+                if (count < 0)
+                    throw external_error("pread", m_path);
+
+                if (count == 0)
+                    break;
+
+                done += static_cast<std::size_t>(count);
+            }
+
+            return done;
+        }
+
+        void write(const std::byte *data, std::size_t size, std::uint64_t offset) const
+        {
+            for (std::size_t done{}; done < size;)
+            {
+                auto const count{::pwrite(m_fd, data + done, size - done, static_cast<off_t>(offset + done))};
+
+                if (count < 0 && errno == EINTR)
+                    continue;
+
+                if (count < 0)
+                    throw external_error("pwrite", m_path);
+
+                done += static_cast<std::size_t>(count);
+            }
+        }
+
+        void truncate(std::uint64_t size) const
+        {
+            if (::ftruncate(m_fd, static_cast<off_t>(size)) != 0)
+                throw external_error("ftruncate", m_path);
+        }
+
+    private:
+        std::filesystem::path m_path;
+        int m_fd{-1};
+    };
+
+    /**
+     * @brief
+     * Thread that runs the reads and writes handed to it in order, so that
+     * the sort and the merge keep working while the disk is busy
+     */
+    class IoWorker
+    {
+    public:
+        IoWorker() : m_thread{[this]
+                              { work(); }}
+        {
+        }
+
+        IoWorker(const IoWorker &) = delete;
+        IoWorker &operator=(const IoWorker &) = delete;
+
+        ~IoWorker()
+        {
+            {
+                std::lock_guard lock{m_mutex};
+                m_stop = true;
+            }
+
+            m_condition.notify_one();
+            m_thread.join();
+        }
+
+        /**
+         * @brief
+         * Queue a request
+         * @return std::future<std::size_t> Result of the request, or its
+         * exception
+         */
+        std::future<std::size_t> submit(std::function<std::size_t()> request)
+        {
+            std::packaged_task<std::size_t()> task{std::move(request)};
+            auto result{task.get_future()};
+
+            {
+                std::lock_guard lock{m_mutex};
+                m_requests.push_back(std::move(task));
+            }
+
+            m_condition.notify_one();
+
+            return result;
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::deque<std::packaged_task<std::size_t()>> m_requests;
+        bool m_stop{false};
+        std::thread m_thread;
+
+        void work()
+        {
+            while (true)
+            {
+                std::unique_lock lock{m_mutex};
+                m_condition.wait(lock, [&]
+                                 { return m_stop || !m_requests.empty(); });
+
+                if (m_requests.empty())
+                    return;
+
+                auto task{std::move(m_requests.front())};
+                m_requests.pop_front();
+                lock.unlock();
+
+                task();
+            }
+        }
+    };
+
+    /**
+     * @brief
+     * Temporary files of one sort, removed with it even if it fails
+     */
+    class RunFiles
+    {
+    public:
+        explicit RunFiles(std::filesystem::path directory) : m_directory{std::move(directory)} {}
+
+        RunFiles(const RunFiles &) = delete;
+        RunFiles &operator=(const RunFiles &) = delete;
+
+        ~RunFiles()
+        {
+            for (auto const &path : m_paths)
+            {
+                std::error_code error;
+                std::filesystem::remove(path, error);
+            }
+        }
+
+        std::filesystem::path create()
+        {
+            static std::atomic<std::uint64_t> sorts{0};
+
+            if (m_id == 0)
+                m_id = sorts.fetch_add(1, std::memory_order_relaxed) + 1;
+
+            m_paths.push_back(m_directory / ("external_sort_" + std::to_string(::getpid()) + "_" +
+                                             std::to_string(m_id) + "_" +
+                                             std::to_string(m_paths.size()) + ".run"));
+
+            return m_paths.back();
+        }
+
+        void remove(const std::filesystem::path &path)
+        {
+            std::error_code error;
+            std::filesystem::remove(path, error);
+        }
+
+    private:
+        std::filesystem::path m_directory;
+        std::vector<std::filesystem::path> m_paths;
+        std::uint64_t m_id{};
+    };
+
+    /**
+     * @brief
+     * Sorted run on disk
+     */
+    struct Run
+    {
+        std::filesystem::path path;
+        std::uint64_t records;
+    };
+
+    /**
+     * @brief
+     * Sequential reader of the records of a run with two buffers: while
+     * the merge consumes one, the I/O thread fills the other
+     * @tparam T Type of the records
+     */
+    template <class T>
+    class RunReader
+    {
+    public:
+        RunReader(const Run &run, std::size_t buffer_size, bool direct, IoWorker &io)
+            : m_file{run.path, O_RDONLY, direct}, m_io{io}, m_bytes{run.records * sizeof(T)},
+              m_buffers{AlignedBuffer{buffer_size}, AlignedBuffer{buffer_size}}
+        {
+            fetch(0);
+            advance();
+        }
+
+        RunReader(const RunReader &) = delete;
+        RunReader &operator=(const RunReader &) = delete;
+
+        ~RunReader()
+        {
+            if (m_pending.valid())
+                m_pending.wait();
+        }
+
+        /**
+         * @brief
+         * Next record, or nullptr at the end of the run
+         */
+        const T *next()
+        {
+            if (m_position == m_available && !advance())
+                return nullptr;
+
+            return m_buffers[m_current].template as<T>() + m_position++;
+        }
+
+    private:
+        ExternalFile m_file;
+        IoWorker &m_io;
+        std::uint64_t m_bytes;
+        std::uint64_t m_offset{};
+        AlignedBuffer m_buffers[2];
+        std::future<std::size_t> m_pending;
+        std::size_t m_current{1};
+        std::size_t m_position{};
+        std::size_t m_available{};
+
+        void fetch(std::size_t index)
+        {
+            if (m_offset >= m_bytes)
+                return;
+
+            auto *const data{m_buffers[index].data()};
+            auto const size{m_buffers[index].get_size()};
+            auto const offset{m_offset};
+
+            m_offset += size;
+            m_pending = m_io.submit([this, data, size, offset]
+                                    { return m_file.read(data, size, offset); });
+        }
+
+        /**
+         * @brief
+         * Switch to the buffer being filled and start filling the other one
+         */
+        bool advance()
+        {
+            if (!m_pending.valid())
+                return false;
+
+            auto const bytes{m_pending.get()};
+
+            m_current ^= 1;
+            m_position = 0;
+            m_available = bytes / sizeof(T);
+
+            fetch(m_current ^ 1);
+
+            return m_available > 0;
+        }
+    };
+
+    /**
+     * @brief
+     * Sequential writer of records with two buffers: while the I/O thread
+     * writes one, the caller fills the other
+     * @tparam T Type of the records
+     */
+    template <class T>
+    class RunWriter
+    {
+    public:
+        RunWriter(const std::filesystem::path &path, std::size_t buffer_size, bool direct, IoWorker &io)
+            : m_file{path, O_WRONLY | O_CREAT | O_TRUNC, direct}, m_io{io},
+              m_buffers{AlignedBuffer{buffer_size}, AlignedBuffer{buffer_size}},
+              m_capacity{buffer_size / sizeof(T)}
+        {
+        }
+
+        RunWriter(const RunWriter &) = delete;
+        RunWriter &operator=(const RunWriter &) = delete;
+
+        ~RunWriter()
+        {
+            if (m_pending.valid())
+                m_pending.wait();
+        }
+
+        void push(const T &record)
+        {
+            m_buffers[m_current].template as<T>()[m_size++] = record;
+
+            if (m_size == m_capacity)
+                flush();
+        }
+
+        /**
+         * @brief
+         * Write whatever is left and wait for every write
+         * @return std::uint64_t Records written
+         */
+        std::uint64_t finish()
+        {
+            auto const bytes{m_offset + m_size * sizeof(T)};
+
+            // Direct writes cover whole blocks, the padding is cut off
+            // afterwards
+            if (m_size > 0)
+                flush();
+
+            if (m_pending.valid())
+                m_pending.get();
+
+            m_file.truncate(bytes);
+
+            return bytes / sizeof(T);
+        }
+
+    private:
+        ExternalFile m_file;
+        IoWorker &m_io;
+        AlignedBuffer m_buffers[2];
+        std::future<std::size_t> m_pending;
+        std::size_t m_capacity;
+        std::size_t m_current{};
+        std::size_t m_size{};
+        std::uint64_t m_offset{};
+
+        void flush()
+        {
+            auto const bytes{(m_size * sizeof(T) + EXTERNAL_ALIGNMENT - 1) / EXTERNAL_ALIGNMENT * EXTERNAL_ALIGNMENT};
+            auto const *const data{m_buffers[m_current].data()};
+            auto const offset{m_offset};
+
+            if (m_pending.valid())
+                m_pending.get();
+
+            m_pending = m_io.submit([this, data, bytes, offset]
+                                    { m_file.write(data, bytes, offset);
+                                      return bytes; });
+
+            m_offset += m_size * sizeof(T);
+            m_current ^= 1;
+            m_size = 0;
+        }
+    };
+
+    /**
+     * @brief
+     * Write the first size bytes of a buffer to a new file in one go. Direct
+     * writes cover whole blocks, the padding is cut off afterwards.
+     */
+    inline void write_run(const std::filesystem::path &path, const AlignedBuffer &buffer,
+                          std::uint64_t size, bool direct)
+    {
+        ExternalFile const file{path, O_WRONLY | O_CREAT | O_TRUNC, direct};
+
+        file.write(buffer.data(), (size + EXTERNAL_ALIGNMENT - 1) / EXTERNAL_ALIGNMENT * EXTERNAL_ALIGNMENT, 0);
+        file.truncate(size);
+    }
+
+    /**
+     * @brief
+     * Merge sorted runs into one file with a loser tree
+     * @return std::uint64_t Records written
+     */
+    template <class T, class Compare>
+    std::uint64_t merge_runs(const std::vector<Run> &runs, const std::filesystem::path &output,
+                             std::size_t buffer_size, bool direct, Compare &cmp, IoWorker &io)
+    {
+        std::vector<std::unique_ptr<RunReader<T>>> readers;
+        LoserTree<T, Compare> tree{runs.size(), cmp};
+
+        for (auto const &run : runs)
+            readers.push_back(std::make_unique<RunReader<T>>(run, buffer_size, direct, io));
+
+        for (std::size_t source{}; source < runs.size(); ++source)
+            if (auto const *const record{readers[source]->next()})
+                tree.set(source, *record);
+
+        tree.build();
+
+        RunWriter<T> writer{output, buffer_size, direct, io};
+
+        while (!tree.is_empty())
+        {
+            writer.push(tree.top());
+
+            if (auto const *const record{readers[tree.top_source()]->next()})
+                tree.replace(*record);
+            else
+                tree.pop();
+        }
+
+        return writer.finish();
+    }
+}
+
+/**
+ * @brief
+ * External merge sort of a file of fixed-size records. The input is read
+ * in chunks that fit the memory budget, every chunk is sorted in memory
+ * with quick_sort() and written to a temporary run; two chunks are kept so
+ * that one is written while the next one is read and sorted. The runs are
+ * then merged with a loser tree, reading every run through two buffers so
+ * the next piece of it is read ahead while the current one is merged; if
+ * there are too many runs to give each at least EXTERNAL_MERGE_BUFFER
+ * bytes, groups of runs are merged into longer runs first. All the I/O is
+ * large and sequential and happens on a separate thread, optionally with
+ * O_DIRECT so that the data does not go through the page cache. An input
+ * that fits in the budget is sorted in memory. Not stable.
+ * @tparam T Type of the records, trivially copyable
+ * @tparam Compare
+ * @param input File of records, its size a multiple of sizeof(T)
+ * @param output File written with the sorted records, not the input
+ * @param cmp
+ * @param options Memory budget, temporary directory and direct I/O
+ * @throw std::invalid_argument If the input is not made of whole records,
+ * or the budget is too small for a merge
+ * @throw std::system_error If a file operation fails
+ * @time complexity O(N log(N)) comparisons, O(N * passes) I/O
+ * @space complexity O(memory_budget) memory, O(N) disk
+ */
+template <class T, class Compare = std::less<>>
+void external_sort(const std::filesystem::path &input, const std::filesystem::path &output,
+                   Compare cmp = Compare{}, const ExternalSortOptions &options = {})
+{
+    static_assert(std::is_trivially_copyable_v<T>, "records are read and written as bytes");
+
+    using custom::AlignedBuffer;
+    using custom::Run;
+
+    // Buffers are multiples of this, so that records never straddle them
+    auto const block{std::lcm(custom::EXTERNAL_ALIGNMENT, sizeof(T))};
+    auto const align{[&](std::size_t bytes)
+                     { return bytes / block * block; }};
+
+    auto const bytes{std::filesystem::file_size(input)};
+
+    if (bytes % sizeof(T) != 0)
+        throw std::invalid_argument{"Input is not made of whole records"};
+
+    // Two chunks in memory while the runs are formed, and at least two
+    // runs with two buffers each plus the output buffers while merging
+    auto const chunk_size{align(options.memory_budget / 2)};
+
+    if (align(options.memory_budget / 6) == 0)
+        throw std::invalid_argument{"Memory budget too small"};
+
+    auto const direct{options.direct_io};
+    custom::IoWorker io;
+
+    if (bytes <= options.memory_budget)
+    {
+        AlignedBuffer buffer{std::max(align(bytes + block - 1), block)};
+        auto const records{custom::ExternalFile{input, O_RDONLY, direct}.read(buffer.data(), buffer.get_size(), 0) /
+                           sizeof(T)};
+
+        quick_sort(buffer.as<T>(), buffer.as<T>() + records, cmp);
+        custom::write_run(output, buffer, records * sizeof(T), direct);
+
+        return;
+    }
+
+    custom::RunFiles files{options.temp_directory};
+    std::vector<Run> runs;
+
+    {
+        custom::ExternalFile const file{input, O_RDONLY, direct};
+        AlignedBuffer chunks[2]{AlignedBuffer{chunk_size}, AlignedBuffer{chunk_size}};
+        std::future<std::size_t> writing;
+        std::size_t current{};
+
+        try
+        {
+            for (std::uint64_t offset{}; offset < bytes; offset += chunk_size, current ^= 1)
+            {
+                // The other chunk may still be on its way to disk
+                auto &chunk{chunks[current]};
+                auto const records{file.read(chunk.data(), chunk.get_size(), offset) / sizeof(T)};
+
+                quick_sort(chunk.as<T>(), chunk.as<T>() + records, cmp);
+
+                if (writing.valid())
+                    writing.get();
+
+                runs.push_back(Run{files.create(), records});
+
+                writing = io.submit([path{runs.back().path}, &chunk, records, direct]
+                                    { custom::write_run(path, chunk, records * sizeof(T), direct);
+                                      return records; });
+            }
+
+            writing.get();
+        }
+        catch (...)
+        {
+            // The chunk being written must outlive the write
+            if (writing.valid())
+                writing.wait();
+
+            throw;
+        }
+    }
+
+    // Every run gets two read buffers, the output two more
+    auto const buffers{options.memory_budget / std::max(custom::EXTERNAL_MERGE_BUFFER, block)};
+    auto const fan_in{std::max<std::size_t>(2, buffers / 2 - std::min<std::size_t>(buffers / 2, 1))};
+
+    while (runs.size() > fan_in)
+    {
+        std::vector<Run> group(runs.begin(), runs.begin() + static_cast<std::ptrdiff_t>(fan_in));
+        Run merged{files.create(), 0};
+
+        merged.records = custom::merge_runs<T>(group, merged.path, align(options.memory_budget / (2 * fan_in + 2)),
+                                               direct, cmp, io);
+
+        for (auto const &run : group)
+            files.remove(run.path);
+
+        runs.erase(runs.begin(), runs.begin() + static_cast<std::ptrdiff_t>(fan_in));
+        runs.push_back(std::move(merged));
+    }
+
+    custom::merge_runs<T>(runs, output, align(options.memory_budget / (2 * runs.size() + 2)), direct, cmp, io);
+}
+
+#endif //! EXTERNAL_SORT_H
@@ -12,66 +12,142 @@
 #ifndef HEAP_SORT_H
 #define HEAP_SORT_H
 
-#include <algorithm>  // std::is_heap(), std::push_heap()
+#include <algorithm>  // std::min()
+#include <cstddef>    // std::size_t, std::ptrdiff_t
 #include <functional> // std::less<>
-#include <iterator>   //
-#include <cassert>    // assert
-
-/**
- * @brief 
- * 
- * @tparam RandomIt 
- * @tparam Compare 
- * @param first 
- * @param last 
- * @param cmp 
- */
-template <class RandomIt, class Compare = std::less<>>
-void heap_sort(RandomIt first, RandomIt last, Compare cmp = Compare{})
-{
-    custom::make_heap(first, last, cmp);
-    custom::sort_heap(first, last, cmp);
-}
+#include <iterator>   // std::iterator_traits
+#include <utility>    // std::move()
 
 namespace custom
 {
     /**
      * @brief
-     *
+     * Bottom-up sift-down (Wegener). Instead of comparing the value with
+     * the largest child at every level, the hole left at top follows the
+     * largest children down to a leaf, which takes Arity - 1 comparisons
+     * per level, and the value then climbs back to its place. The value
+     * sifted by heap sort comes from the bottom of the heap and rarely
+     * climbs more than a level or two, which saves about half of the
+     * comparisons of the usual sift-down.
+     * @tparam Arity Children per node
      * @tparam RandomIt
+     * @tparam T Type of the value
      * @tparam Compare
-     * @param first
-     * @param second
+     * @param first Beginning of the heap
+     * @param N Size of the heap
+     * @param top Position of the hole, below which [first, first + N) is a
+     * heap
+     * @param value Value to be placed
      * @param cmp
+     * @time complexity O(Arity * log_Arity(N))
+     * @space complexity O(1)
      */
-    template <class RandomIt, class Compare = std::less<>>
-    void make_heap(RandomIt first, RandomIt second, Compare cmp = Compare{})
+    template <std::size_t Arity, class RandomIt, class T, class Compare>
+    void heap_sift(RandomIt first, std::ptrdiff_t N, std::ptrdiff_t top, T value, Compare &cmp)
     {
-        for (auto it{first}; it != last;)
+        constexpr auto ARITY{static_cast<std::ptrdiff_t>(Arity)};
+
+        auto hole{top};
+
+        for (auto child{ARITY * hole + 1}; child < N; child = ARITY * hole + 1)
         {
-            std::push_heap(first, ++it, cmp);
-            assert(std::is_heap(first, it, cmp));
+            auto const end{std::min(child + ARITY, N)};
+            auto largest{child};
+
+            for (auto other{child + 1}; other < end; ++other)
+                if (cmp(first[largest], first[other]))
+                    largest = other;
+
+            first[hole] = std::move(first[largest]);
+            hole = largest;
         }
+
+        while (hole > top)
+        {
+            auto const parent{(hole - 1) / ARITY};
+
+            if (!cmp(first[parent], value))
+                break;
+
+            first[hole] = std::move(first[parent]);
+            hole = parent;
+        }
+
+        first[hole] = std::move(value);
+    }
+
+    /**
+     * @brief
+     * Floyd's heap construction: every inner node is sifted down, from the
+     * last one to the root, so that most of the work happens on the small
+     * heaps near the leaves
+     * @tparam Arity Children per node, 2 by default
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <std::size_t Arity = 2, class RandomIt, class Compare = std::less<>>
+    void make_heap(RandomIt first, RandomIt last, Compare cmp = Compare{})
+    {
+        static_assert(Arity >= 2, "a heap node has at least two children");
+
+        auto const N{last - first};
+
+        for (auto parent{(N - 2) / static_cast<std::ptrdiff_t>(Arity)}; N > 1 && parent >= 0; --parent)
+            heap_sift<Arity>(first, N, parent, std::move(first[parent]), cmp);
     }
 
     /**
      * @brief
-     *
+     * Turn a heap into a sorted range by moving the root behind the heap
+     * and sifting the last element of the heap from the root, N - 1 times
+     * @tparam Arity Children per node, 2 by default
      * @tparam RandomIt
      * @tparam Compare
      * @param first
      * @param last
      * @param cmp
+     * @time complexity O(N * Arity * log_Arity(N))
+     * @space complexity O(1)
      */
-    template <class RandomIt, class Compare = std::less<>>
+    template <std::size_t Arity = 2, class RandomIt, class Compare = std::less<>>
     void sort_heap(RandomIt first, RandomIt last, Compare cmp = Compare{})
     {
-        for (auto it{last}; it != first;)
+        static_assert(Arity >= 2, "a heap node has at least two children");
+
+        for (auto end{last - first - 1}; end > 0; --end)
         {
-            std::pop_heap(first, it--, cmp);
-            assert(std::is_heap(first, it, cmp));
+            typename std::iterator_traits<RandomIt>::value_type value{std::move(first[end])};
+
+            first[end] = std::move(first[0]);
+            heap_sift<Arity>(first, end, 0, std::move(value), cmp);
         }
     }
 }
 
-#endif //! HEAP_SORT_H
\ No newline at end of file
+/**
+ * @brief
+ * Heap sort with a heap of Arity children per node. A 4-ary heap makes
+ * more comparisons per level but has half the levels, and its children
+ * share a cache line, which usually makes it faster on large ranges.
+ * @tparam Arity Children per node, 2 by default
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first
+ * @param last
+ * @param cmp
+ * @time complexity O(N log(N))
+ * @space complexity O(1)
+ */
+template <std::size_t Arity = 2, class RandomIt, class Compare = std::less<>>
+void heap_sort(RandomIt first, RandomIt last, Compare cmp = Compare{})
+{
+    custom::make_heap<Arity>(first, last, cmp);
+    custom::sort_heap<Arity>(first, last, cmp);
+}
+
+#endif //! HEAP_SORT_H
@@ -12,32 +12,58 @@
 #ifndef INSERTION_SORT_H
 #define INSERTION_SORT_H
 
-#include <algorithm>  // std::upper_bound(), std::rotate(), std::is_sorted()
-#include <cassert>    // assert
-#include <functional> // std::less<>
-#include <iterator>   // std::next()
+#include <algorithm>   // std::upper_bound(), std::rotate()
+#include <functional>  // std::less<>
+#include <iterator>    // std::next(), std::prev(), std::iterator_traits
+#include <type_traits> // std::is_base_of_v
+#include <utility>     // std::move()
 
 /**
  * @brief
- *
+ * Stable insertion sort. With bidirectional iterators every element is
+ * moved out and the larger ones before it are shifted one place to the
+ * right until its place is found; forward iterators find the place with
+ * std::upper_bound() and rotate the element into it.
  * @tparam FwdIt
  * @tparam Compare
  * @param first
- * @param second
+ * @param last
  * @param cmp
- * @time complexity O(N^2)
+ * @time complexity O(N^2), O(N) on sorted input with bidirectional
+ * iterators
  * @space complexity O(1)
  */
 template <class FwdIt, class Compare = std::less<>>
-void insertion_sort(FwdIt first, FwdIt second, Compare cmp = Compare{})
+void insertion_sort(FwdIt first, FwdIt last, Compare cmp = Compare{})
 {
-    for (auto it{first}; it != last; ++i)
+    using category = typename std::iterator_traits<FwdIt>::iterator_category;
+
+    if (first == last)
+        return;
+
+    if constexpr (std::is_base_of_v<std::bidirectional_iterator_tag, category>)
     {
-        auto const insertion{std::upper_bound(first, it, *it, cmp)};
+        for (auto it{std::next(first)}; it != last; ++it)
+        {
+            auto value{std::move(*it)};
+            auto hole{it};
+
+            for (auto previous{std::prev(hole)}; cmp(value, *previous); --previous)
+            {
+                *hole = std::move(*previous);
 
-        std::rotate(insertion, it, std::next(it));
-        assert(std::is_sorted(first, std::next(it), cmp));
+                if (--hole == first)
+                    break;
+            }
+
+            *hole = std::move(value);
+        }
+    }
+    else
+    {
+        for (auto it{first}; it != last; ++it)
+            std::rotate(std::upper_bound(first, it, *it, cmp), it, std::next(it));
     }
 }
 
-#endif //! INSERTION_SORT_H
\ No newline at end of file
+#endif //! INSERTION_SORT_H
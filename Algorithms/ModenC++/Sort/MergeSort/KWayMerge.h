@@ -0,0 +1,288 @@
+/**
+ * @file KWayMerge.h
+ * @author Carlos Salguero
+ * @brief K-way merge of sorted ranges or streams with a loser tree,
+ * sequential or on top of the fork-join ThreadPool
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef KWAY_MERGE_H
+#define KWAY_MERGE_H
+
+#include <algorithm>  // std::copy(), std::merge(), std::lower_bound(), std::upper_bound()
+#include <cstddef>    // std::size_t, std::ptrdiff_t
+#include <functional> // std::less<>
+#include <istream>
+#include <iterator>    // std::istream_iterator, std::iterator_traits
+#include <type_traits> // std::is_trivially_copyable_v
+#include <utility>     // std::pair
+#include <vector>
+
+#include "LoserTree.h"
+#include "ParallelMergeSort.h" // custom::MERGE_GRAIN
+#include "../../../../DataStructures/Concurrency/ThreadPool.h"
+
+namespace custom
+{
+    // Largest trivially copyable values kept in the loser tree itself
+    constexpr std::size_t KWAY_CACHED_SIZE = 16;
+
+    // Samples per piece of a parallel merge, at least one per source
+    constexpr std::ptrdiff_t KWAY_OVERSAMPLING = 16;
+
+    // Pieces of a parallel merge per worker, so that stealing evens out
+    // pieces of different sizes
+    constexpr std::ptrdiff_t KWAY_PIECES_PER_WORKER = 4;
+
+    /**
+     * @brief
+     * Element of a source in the order of a stable merge: by value, then by
+     * source, then by position
+     */
+    struct KWayPosition
+    {
+        std::size_t source;
+        std::ptrdiff_t index;
+    };
+}
+
+/**
+ * @brief
+ * Stable k-way merge. Every source is a pair of iterators, and the sources
+ * compete in a LoserTree that holds their current values, or iterators to
+ * them for large or non-trivial types, so an output element costs log2(k)
+ * comparisons and only its own source is advanced.
+ * Sources that run out become sentinels that lose every match. Equal
+ * elements come out in the order of their sources. Two sources are merged
+ * with std::merge().
+ * @tparam InputIt Input iterator, istream_iterator included
+ * @tparam OutputIt
+ * @tparam Compare
+ * @param sources Sorted ranges
+ * @param out Beginning of the output
+ * @param cmp
+ * @return OutputIt End of the output
+ * @time complexity O(N log(k))
+ * @space complexity O(k)
+ */
+template <class InputIt, class OutputIt, class Compare = std::less<>>
+OutputIt kway_merge(const std::vector<std::pair<InputIt, InputIt>> &sources, OutputIt out,
+                    Compare cmp = Compare{})
+{
+    if (sources.empty())
+        return out;
+
+    if (sources.size() == 1)
+        return std::copy(sources[0].first, sources[0].second, out);
+
+    if (sources.size() == 2)
+        return std::merge(sources[0].first, sources[0].second, sources[1].first, sources[1].second,
+                          out, cmp);
+
+    using value_type = typename std::iterator_traits<InputIt>::value_type;
+
+    auto positions{sources};
+
+    // Small trivial values are copied into the tree, where a match compares
+    // them without following the iterators
+    if constexpr (std::is_trivially_copyable_v<value_type> && sizeof(value_type) <= custom::KWAY_CACHED_SIZE)
+    {
+        LoserTree<value_type, Compare &> tree{sources.size(), cmp};
+
+        for (std::size_t source{}; source < sources.size(); ++source)
+            if (positions[source].first != positions[source].second)
+                tree.set(source, *positions[source].first);
+
+        tree.build();
+
+        while (!tree.is_empty())
+        {
+            *out = tree.top();
+            ++out;
+
+            auto &[it, last]{positions[tree.top_source()]};
+
+            if (++it != last)
+                tree.replace(*it);
+            else
+                tree.pop();
+        }
+    }
+    else
+    {
+        auto const less{[&cmp](const InputIt &a, const InputIt &b)
+                        { return cmp(*a, *b); }};
+
+        LoserTree<InputIt, decltype(less)> tree{sources.size(), less};
+
+        for (std::size_t source{}; source < sources.size(); ++source)
+            if (positions[source].first != positions[source].second)
+                tree.set(source, positions[source].first);
+
+        tree.build();
+
+        while (!tree.is_empty())
+        {
+            auto it{tree.top()};
+
+            *out = *it;
+            ++out;
+
+            if (++it != sources[tree.top_source()].second)
+                tree.replace(it);
+            else
+                tree.pop();
+        }
+    }
+
+    return out;
+}
+
+/**
+ * @brief
+ * Stable k-way merge of streams of values separated by whitespace, read
+ * with operator>>
+ * @tparam T Type of the values
+ * @tparam OutputIt
+ * @tparam Compare
+ * @param streams Streams of sorted values
+ * @param out Beginning of the output
+ * @param cmp
+ * @return OutputIt End of the output
+ * @time complexity O(N log(k))
+ * @space complexity O(k)
+ */
+template <class T, class OutputIt, class Compare = std::less<>>
+OutputIt kway_merge(const std::vector<std::istream *> &streams, OutputIt out, Compare cmp = Compare{})
+{
+    std::vector<std::pair<std::istream_iterator<T>, std::istream_iterator<T>>> sources;
+
+    for (auto *const stream : streams)
+        sources.emplace_back(std::istream_iterator<T>{*stream}, std::istream_iterator<T>{});
+
+    return kway_merge(sources, out, cmp);
+}
+
+/**
+ * @brief
+ * Parallel stable k-way merge of random access ranges. The output is split
+ * into pieces at splitter elements sampled evenly from every source: the
+ * co-rank of a splitter in every source, the number of its elements that
+ * come before the splitter in the merge, is found with a binary search,
+ * and the sum of the co-ranks is where the splitter lands in the output.
+ * The pieces are then merged independently with kway_merge(), several per
+ * worker so that work stealing evens out their sizes.
+ * @tparam RandomIt
+ * @tparam OutputIt Random access iterator
+ * @tparam Compare
+ * @param sources Sorted ranges
+ * @param out Beginning of the output
+ * @param cmp
+ * @param pool Pool to run in, the process-wide one by default
+ * @return OutputIt End of the output
+ * @time complexity O(N log(k) + pieces * k log(N)) work,
+ * O(N log(k) / threads) span with balanced pieces
+ * @space complexity O(pieces * k)
+ */
+template <class RandomIt, class OutputIt, class Compare = std::less<>>
+OutputIt parallel_kway_merge(const std::vector<std::pair<RandomIt, RandomIt>> &sources, OutputIt out,
+                             Compare cmp = Compare{}, ThreadPool &pool = ThreadPool::instance())
+{
+    using custom::KWayPosition;
+
+    auto const k{sources.size()};
+    std::ptrdiff_t N{};
+
+    for (auto const &[first, last] : sources)
+        N += last - first;
+
+    auto const pieces{std::min(static_cast<std::ptrdiff_t>(pool.get_size()) * custom::KWAY_PIECES_PER_WORKER,
+                               N / custom::MERGE_GRAIN)};
+
+    if (pieces <= 1 || k <= 1)
+        return kway_merge(sources, out, cmp);
+
+    auto const value{[&](const KWayPosition &position) -> decltype(auto)
+                     { return sources[position.source].first[position.index]; }};
+
+    auto const before{[&](const KWayPosition &a, const KWayPosition &b)
+                      {
+                          if (cmp(value(a), value(b)))
+                              return true;
+
+                          if (cmp(value(b), value(a)))
+                              return false;
+
+                          return a.source < b.source || (a.source == b.source && a.index < b.index);
+                      }};
+
+    // Every sample stands for about step elements of its source
+    auto const step{std::max<std::ptrdiff_t>(
+        1, N / (pieces * std::max(custom::KWAY_OVERSAMPLING, static_cast<std::ptrdiff_t>(k))))};
+
+    std::vector<KWayPosition> samples;
+
+    for (std::size_t source{}; source < k; ++source)
+        for (std::ptrdiff_t index{step / 2}; index < sources[source].second - sources[source].first; index += step)
+            samples.push_back({source, index});
+
+    std::sort(samples.begin(), samples.end(), before);
+
+    // Co-ranks of the splitters, the first row all zeros and the last one
+    // the sizes of the sources
+    std::vector<std::vector<std::ptrdiff_t>> splits(pieces + 1, std::vector<std::ptrdiff_t>(k));
+    std::vector<std::ptrdiff_t> offsets(pieces + 1);
+
+    for (std::size_t source{}; source < k; ++source)
+        splits[pieces][source] = sources[source].second - sources[source].first;
+
+    offsets[pieces] = N;
+
+    pool.parallel_for(std::ptrdiff_t{1}, pieces, std::ptrdiff_t{1},
+                      [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                      {
+                          for (auto piece{begin}; piece != end; ++piece)
+                          {
+                              auto const splitter{samples[samples.size() * piece / pieces]};
+                              auto const &pivot{value(splitter)};
+
+                              for (std::size_t source{}; source < k; ++source)
+                              {
+                                  auto const [first, last]{sources[source]};
+
+                                  // Equal elements of earlier sources come first
+                                  if (source < splitter.source)
+                                      splits[piece][source] = std::upper_bound(first, last, pivot, cmp) - first;
+                                  else if (source == splitter.source)
+                                      splits[piece][source] = splitter.index;
+                                  else
+                                      splits[piece][source] = std::lower_bound(first, last, pivot, cmp) - first;
+
+                                  offsets[piece] += splits[piece][source];
+                              }
+                          }
+                      });
+
+    pool.parallel_for(std::ptrdiff_t{0}, pieces, std::ptrdiff_t{1},
+                      [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                      {
+                          for (auto piece{begin}; piece != end; ++piece)
+                          {
+                              std::vector<std::pair<RandomIt, RandomIt>> ranges(k);
+
+                              for (std::size_t source{}; source < k; ++source)
+                                  ranges[source] = {sources[source].first + splits[piece][source],
+                                                    sources[source].first + splits[piece + 1][source]};
+
+                              kway_merge(ranges, out + offsets[piece], cmp);
+                          }
+                      });
+
+    return out + N;
+}
+
+#endif //! KWAY_MERGE_H
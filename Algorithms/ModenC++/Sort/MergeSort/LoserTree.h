@@ -0,0 +1,244 @@
+/**
+ * @file LoserTree.h
+ * @author Carlos Salguero
+ * @brief Tournament tree of losers for k-way merging
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef LOSER_TREE_H
+#define LOSER_TREE_H
+
+#include <algorithm>   // std::move()
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::uint32_t
+#include <functional>  // std::less<>
+#include <type_traits> // std::is_arithmetic_v, std::is_trivially_copyable_v
+#include <utility>     // std::move(), std::swap()
+#include <vector>
+
+/**
+ * @brief
+ * Tree of losers over k sources (Knuth). Every source offers its current
+ * value at a leaf, every inner node remembers the value and source that
+ * lost the match played there and the root remembers the overall winner,
+ * the smallest value. When the winner is replaced by the next value of its
+ * source, only the matches on the path from its leaf to the root are
+ * replayed, against the losers stored there: log2(k) comparisons, where a
+ * binary heap needs up to twice as many.
+ *
+ * A source that runs out is closed and acts as a sentinel larger than any
+ * value, so the tree keeps its shape until every source is closed. Equal
+ * values leave the tree in the order of their sources, which makes merges
+ * of stable runs stable.
+ * @tparam T Type of the values
+ * @tparam Compare
+ */
+template <class T, class Compare = std::less<>>
+class LoserTree
+{
+public:
+    /**
+     * @brief
+     * Construct a new LoserTree object for k sources, all closed until
+     * they are given a value
+     * @param k Number of sources
+     * @param cmp
+     */
+    explicit LoserTree(std::size_t k, Compare cmp = Compare{})
+        : m_tree(k == 0 ? 1 : k), m_leaves(k), m_cmp{cmp}
+    {
+        for (std::size_t source{}; source < k; ++source)
+            m_leaves[source].source = static_cast<std::uint32_t>(source);
+    }
+
+    /**
+     * @brief
+     * Get the number of sources
+     * @return std::size_t Number of sources
+     */
+    std::size_t get_size() const { return m_leaves.size(); }
+
+    /**
+     * @brief
+     * Give a source its first value, before build()
+     * @param source Index of the source
+     * @param value Value of the source
+     */
+    void set(std::size_t source, T value)
+    {
+        m_leaves[source].value = std::move(value);
+        m_leaves[source].closed = false;
+    }
+
+    /**
+     * @brief
+     * Play every match, after the sources were given their first values
+     * @time complexity O(k)
+     * @space complexity O(k)
+     */
+    void build()
+    {
+        auto const k{m_leaves.size()};
+
+        if (k <= 1)
+        {
+            if (k == 1)
+                m_tree[0] = std::move(m_leaves[0]);
+
+            return;
+        }
+
+        // Winners of the subtrees, the leaf of source i being node k + i
+        std::vector<Entry> winners(2 * k);
+
+        std::move(m_leaves.begin(), m_leaves.end(), winners.begin() + static_cast<std::ptrdiff_t>(k));
+
+        for (auto node{k - 1}; node > 0; --node)
+        {
+            auto &winner{winners[2 * node]};
+            auto &loser{winners[2 * node + 1]};
+
+            if (beats(loser, winner))
+                std::swap(winner, loser);
+
+            winners[node] = std::move(winner);
+            m_tree[node] = std::move(loser);
+        }
+
+        m_tree[0] = std::move(winners[1]);
+    }
+
+    /**
+     * @brief
+     * Checks if every source is closed
+     * @return true If no value is left
+     * @return false If there is a winner
+     */
+    bool is_empty() const { return m_leaves.empty() || m_tree[0].closed; }
+
+    /**
+     * @brief
+     * Get the source of the smallest value
+     * @return std::size_t Index of the source
+     */
+    std::size_t top_source() const { return m_tree[0].source; }
+
+    /**
+     * @brief
+     * Get the smallest value
+     * @return const T& Smallest value
+     */
+    const T &top() const { return m_tree[0].value; }
+
+    /**
+     * @brief
+     * Replace the smallest value by the next value of its source
+     * @param value Next value of the source of the winner
+     * @time complexity O(log(k))
+     * @space complexity O(1)
+     */
+    void replace(T value)
+    {
+        m_tree[0].value = std::move(value);
+        replay();
+    }
+
+    /**
+     * @brief
+     * Close the source of the smallest value, which ran out
+     * @time complexity O(log(k))
+     * @space complexity O(1)
+     */
+    void pop()
+    {
+        m_tree[0].closed = true;
+        replay();
+    }
+
+private:
+    /**
+     * @brief
+     * Value of a source with the source itself. The losers are kept in
+     * the nodes together with their values, so that replaying a path reads
+     * one entry per level instead of following an index to the value.
+     */
+    struct Entry
+    {
+        T value{};
+        std::uint32_t source{};
+        bool closed{true};
+    };
+
+    // The winner at 0, the loser of the match at node i at i
+    std::vector<Entry> m_tree;
+    std::vector<Entry> m_leaves;
+    Compare m_cmp;
+
+    /**
+     * @brief
+     * Whether a comes out before b: closed sources lose against everything
+     * and ties go to the lower source
+     */
+    bool beats(const Entry &a, const Entry &b)
+    {
+        if constexpr (std::is_arithmetic_v<T>)
+        {
+            // Without branches: a closed entry still holds a number, so the
+            // comparisons are always safe to make. Iterators and pointers
+            // may be past the end of their source and are not compared.
+            bool const less{static_cast<bool>(m_cmp(a.value, b.value))};
+            bool const greater{static_cast<bool>(m_cmp(b.value, a.value))};
+            bool const lower{a.source < b.source};
+            bool const open{static_cast<bool>(less | ((!greater) & lower))};
+
+            return ((!a.closed) & (b.closed | open)) | (a.closed & b.closed & lower);
+        }
+
+        if (a.closed || b.closed)
+            return b.closed && (!a.closed || a.source < b.source);
+
+        // The lower source wins unless the other one is strictly smaller,
+        // a single comparison either way
+        return a.source < b.source ? !m_cmp(b.value, a.value) : m_cmp(a.value, b.value);
+    }
+
+    void replay()
+    {
+        auto const k{m_leaves.size()};
+
+        // Kept out of the array, which the stores to the path would
+        // otherwise force to be read again at every level
+        auto winner{std::move(m_tree[0])};
+
+        for (auto node{(winner.source + k) / 2}; node > 0; node /= 2)
+        {
+            if constexpr (std::is_trivially_copyable_v<T>)
+            {
+                // Whether the stored loser wins is close to a coin flip, so
+                // both entries are selected without a branch
+                auto &slot{m_tree[node]};
+                auto const stored{slot};
+                auto const swap{beats(stored, winner)};
+
+                // Field by field, which the compiler turns into conditional
+                // moves where it would branch on whole entries
+                slot.value = swap ? winner.value : stored.value;
+                slot.source = swap ? winner.source : stored.source;
+                slot.closed = swap ? winner.closed : stored.closed;
+                winner.value = swap ? stored.value : winner.value;
+                winner.source = swap ? stored.source : winner.source;
+                winner.closed = swap ? stored.closed : winner.closed;
+            }
+            else if (beats(m_tree[node], winner))
+                std::swap(m_tree[node], winner);
+        }
+
+        m_tree[0] = std::move(winner);
+    }
+};
+
+#endif //! LOSER_TREE_H
@@ -12,35 +12,105 @@
 #ifndef MERGE_SORT_H
 #define MERGE_SORT_H
 
-#include <algorithm>  // std::inplace_merge()
-#include <iterator>   // std::next(), std::distance()
 #include <functional> // std::less<>
+#include <iterator>   // std::next(), std::distance(), std::make_move_iterator()
+#include <utility>    // std::move()
+#include <vector>
+
+namespace custom
+{
+    /**
+     * @brief
+     * Merge the sorted halves [first, middle) and [middle, last) through a
+     * buffer that takes the left half. The right half is merged in place
+     * behind it, and whatever is left of it once the buffer runs out is
+     * already where it belongs.
+     * @tparam BiDirIt
+     * @tparam Buffer
+     * @tparam Compare
+     * @param first
+     * @param middle
+     * @param last
+     * @param buffer Scratch room for the left half, reused between calls
+     * @param cmp
+     * @time complexity O(N)
+     * @space complexity O(1), the buffer is preallocated
+     */
+    template <class BiDirIt, class Buffer, class Compare>
+    void merge_halves(BiDirIt first, BiDirIt middle, BiDirIt last, Buffer &buffer,
+                      Compare &cmp)
+    {
+        buffer.assign(std::make_move_iterator(first), std::make_move_iterator(middle));
+
+        auto left{buffer.begin()};
+        auto right{middle};
+
+        // Ties take the left value, which keeps the sort stable
+        while (left != buffer.end())
+        {
+            if (right != last && cmp(*right, *left))
+                *first++ = std::move(*right++);
+            else
+                *first++ = std::move(*left++);
+        }
+    }
+
+    /**
+     * @brief
+     * Recursive step of merge_sort()
+     * @tparam BiDirIt
+     * @tparam Buffer
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param N Number of elements in [first, last)
+     * @param buffer
+     * @param cmp
+     */
+    template <class BiDirIt, class Buffer, class Compare>
+    void merge_sort(BiDirIt first, BiDirIt last,
+                    typename std::iterator_traits<BiDirIt>::difference_type N,
+                    Buffer &buffer, Compare &cmp)
+    {
+        if (N <= 1)
+            return;
+
+        auto const middle{std::next(first, N / 2)};
+
+        merge_sort(first, middle, N / 2, buffer, cmp);
+        merge_sort(middle, last, N - N / 2, buffer, cmp);
+
+        merge_halves(first, middle, last, buffer, cmp);
+    }
+}
 
 /**
  * @brief
- *
+ * Stable merge sort. The scratch buffer is allocated once, for half of
+ * the range, instead of on every merge; if it cannot be allocated,
+ * std::bad_alloc is thrown rather than silently falling back to a slower
+ * merge.
  * @tparam BiDirIt
  * @tparam Compare
  * @param first
- * @param second
+ * @param last
  * @param cmp
+ * @throw std::bad_alloc If the buffer cannot be allocated
  * @time complexity O(N log(N))
  * @space complexity O(N)
  */
 template <class BiDirIt, class Compare = std::less<>>
-void merge_sort(BiDirIt first, BiDirIt second, Compare cmp = Compare{})
+void merge_sort(BiDirIt first, BiDirIt last, Compare cmp = Compare{})
 {
     auto const N{std::distance(first, last)};
 
     if (N <= 1)
         return;
 
-    auto const middle{std::next(first, N / 2)};
-
-    merge_sort(first, middle, cmp);
-    merge_sort(middle, last, cmp);
+    std::vector<typename std::iterator_traits<BiDirIt>::value_type> buffer;
+    buffer.reserve(N / 2);
 
-    std::inplace_merge(first, middle, last, cmp);
+    custom::merge_sort(first, last, N, buffer, cmp);
 }
 
-#endif //! MERGE_SORT_H
\ No newline at end of file
+#endif //! MERGE_SORT_H
@@ -0,0 +1,252 @@
+/**
+ * @file ParallelMergeSort.h
+ * @author Carlos Salguero
+ * @brief Parallel Merge Sort Algorithm on top of the fork-join ThreadPool
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PARALLEL_MERGE_SORT_H
+#define PARALLEL_MERGE_SORT_H
+
+#include <algorithm>  // std::merge(), std::move()
+#include <cstddef>    // std::ptrdiff_t
+#include <functional> // std::less<>, std::ref()
+#include <iterator>   // std::make_move_iterator()
+#include <memory>     // std::make_unique_for_overwrite()
+#include <utility>    // std::move()
+#include <vector>
+
+#include "../InsertionSort/InsertionSort.h"
+#include "../../../../DataStructures/Concurrency/ThreadPool.h"
+
+namespace custom
+{
+    // Ranges up to this size are sorted by insertion_sort(), which unlike
+    // small_sort() is stable
+    constexpr std::ptrdiff_t MERGE_INSERTION_CUTOFF = 32;
+
+    // Ranges up to this size are sorted without forking tasks
+    constexpr std::ptrdiff_t MERGE_SEQUENTIAL_CUTOFF = 1 << 14;
+
+    // Output elements merged by one task
+    constexpr std::ptrdiff_t MERGE_GRAIN = 1 << 16;
+
+    /**
+     * @brief
+     * Co-rank of an output position: the number i of elements of a that
+     * come before position k when a and b are merged stably, so that the
+     * first k outputs are a[0, i) and b[0, k - i)
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param k Output position
+     * @param a First sorted range
+     * @param na Size of a
+     * @param b Second sorted range
+     * @param nb Size of b
+     * @param cmp
+     * @return std::ptrdiff_t Elements of a among the first k outputs
+     * @time complexity O(log(min(k, na)))
+     * @space complexity O(1)
+     */
+    template <class RandomIt, class Compare>
+    std::ptrdiff_t co_rank(std::ptrdiff_t k, RandomIt a, std::ptrdiff_t na,
+                           RandomIt b, std::ptrdiff_t nb, Compare &cmp)
+    {
+        auto low{k > nb ? k - nb : 0};
+        auto high{k < na ? k : na};
+
+        while (low < high)
+        {
+            auto const i{low + (high - low) / 2};
+
+            // a[i] stays among the first k unless b[k - i - 1] is strictly
+            // smaller, ties go to a
+            if (cmp(b[k - i - 1], a[i]))
+                high = i;
+            else
+                low = i + 1;
+        }
+
+        return low;
+    }
+
+    /**
+     * @brief
+     * Stable merge of a and b into out, moving the elements. Large merges
+     * split the output into pieces of MERGE_GRAIN elements and find where
+     * every piece starts in a and b with co_rank(), so the pieces are
+     * merged in parallel without any synchronization.
+     * @tparam InputIt
+     * @tparam OutputIt
+     * @tparam Compare
+     * @param a First sorted range
+     * @param na Size of a
+     * @param b Second sorted range
+     * @param nb Size of b
+     * @param out Beginning of the output, not overlapping a nor b
+     * @param cmp
+     * @param pool Pool to run in, nullptr to merge sequentially
+     * @time complexity O(N)
+     * @space complexity O(N / MERGE_GRAIN)
+     */
+    template <class InputIt, class OutputIt, class Compare>
+    void parallel_merge(InputIt a, std::ptrdiff_t na, InputIt b, std::ptrdiff_t nb,
+                        OutputIt out, Compare &cmp, ThreadPool *pool)
+    {
+        auto const N{na + nb};
+
+        if (pool == nullptr || N <= MERGE_GRAIN)
+        {
+            std::merge(std::make_move_iterator(a), std::make_move_iterator(a + na),
+                       std::make_move_iterator(b), std::make_move_iterator(b + nb),
+                       out, cmp);
+            return;
+        }
+
+        auto const pieces{(N + MERGE_GRAIN - 1) / MERGE_GRAIN};
+
+        // Every split is found before any piece moves its elements away
+        std::vector<std::ptrdiff_t> splits(pieces + 1);
+
+        for (std::ptrdiff_t piece{}; piece <= pieces; ++piece)
+            splits[piece] = co_rank(N * piece / pieces, a, na, b, nb, cmp);
+
+        pool->parallel_for(std::ptrdiff_t{0}, pieces, std::ptrdiff_t{1},
+                           [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                           {
+                               for (auto piece{begin}; piece != end; ++piece)
+                               {
+                                   auto const k_first{N * piece / pieces};
+                                   auto const k_last{N * (piece + 1) / pieces};
+                                   auto const i_first{splits[piece]};
+                                   auto const i_last{splits[piece + 1]};
+
+                                   std::merge(std::make_move_iterator(a + i_first),
+                                              std::make_move_iterator(a + i_last),
+                                              std::make_move_iterator(b + (k_first - i_first)),
+                                              std::make_move_iterator(b + (k_last - i_last)),
+                                              out + k_first, cmp);
+                               }
+                           });
+    }
+
+    /**
+     * @brief
+     * Recursive step of parallel_merge_sort(). The data moves back and
+     * forth between the range and the buffer: the halves are sorted into
+     * whichever side the merge reads from, so every level costs a single
+     * pass and nothing is copied back at the end.
+     * @tparam RandomIt
+     * @tparam BufferIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param buffer Scratch room for last - first elements
+     * @param into_buffer Whether the sorted result goes to the buffer
+     * @param cmp
+     * @param pool Pool to fork in, nullptr below the sequential cutoff
+     */
+    template <class RandomIt, class BufferIt, class Compare>
+    void parallel_merge_sort(RandomIt first, RandomIt last, BufferIt buffer,
+                             bool into_buffer, Compare &cmp, ThreadPool *pool)
+    {
+        auto const N{last - first};
+
+        if (N <= MERGE_INSERTION_CUTOFF)
+        {
+            insertion_sort(first, last, std::ref(cmp));
+
+            if (into_buffer)
+                std::move(first, last, buffer);
+
+            return;
+        }
+
+        if (N <= MERGE_SEQUENTIAL_CUTOFF)
+            pool = nullptr;
+
+        auto const half{N / 2};
+        auto const sort_left{[&]
+                             { parallel_merge_sort(first, first + half, buffer,
+                                                   !into_buffer, cmp, pool); }};
+        auto const sort_right{[&]
+                              { parallel_merge_sort(first + half, last, buffer + half,
+                                                    !into_buffer, cmp, pool); }};
+
+        if (pool != nullptr)
+            pool->invoke(sort_left, sort_right);
+        else
+        {
+            sort_left();
+            sort_right();
+        }
+
+        if (into_buffer)
+            parallel_merge(first, half, first + half, N - half, buffer, cmp, pool);
+        else
+            parallel_merge(buffer, half, buffer + half, N - half, first, cmp, pool);
+    }
+}
+
+/**
+ * @brief
+ * Stable parallel merge sort with a caller-provided scratch buffer, so
+ * repeated sorts do not allocate. The halves of every range are sorted as
+ * fork-join tasks down to a sequential cutoff, and large merges are split
+ * between the workers by co-ranking.
+ * @tparam RandomIt
+ * @tparam BufferIt Random access iterator to elements of the same type
+ * @tparam Compare
+ * @param first
+ * @param last
+ * @param buffer Beginning of at least last - first constructed elements,
+ * overwritten by the sort
+ * @param cmp
+ * @param pool Pool to run in
+ * @time complexity O(N log(N)) work, O(log(N)^2) span
+ * @space complexity O(log(N)) stack, besides the buffer
+ */
+template <class RandomIt, class BufferIt, class Compare>
+void parallel_merge_sort(RandomIt first, RandomIt last, BufferIt buffer, Compare cmp,
+                         ThreadPool &pool)
+{
+    if (last - first <= 1)
+        return;
+
+    pool.run([&]
+             { custom::parallel_merge_sort(first, last, buffer, false, cmp, &pool); });
+}
+
+/**
+ * @brief
+ * Stable parallel merge sort. The scratch buffer is allocated once for the
+ * whole sort, without initializing trivial types; the elements have to be
+ * default constructible.
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first
+ * @param last
+ * @param cmp
+ * @param pool Pool to run in, the process-wide one by default
+ * @throw std::bad_alloc If the buffer cannot be allocated
+ * @time complexity O(N log(N)) work, O(log(N)^2) span
+ * @space complexity O(N)
+ */
+template <class RandomIt, class Compare = std::less<>>
+void parallel_merge_sort(RandomIt first, RandomIt last, Compare cmp = Compare{},
+                         ThreadPool &pool = ThreadPool::instance())
+{
+    if (last - first <= 1)
+        return;
+
+    auto const buffer{std::make_unique_for_overwrite<
+        typename std::iterator_traits<RandomIt>::value_type[]>(last - first)};
+
+    parallel_merge_sort(first, last, buffer.get(), cmp, pool);
+}
+
+#endif //! PARALLEL_MERGE_SORT_H
@@ -0,0 +1,555 @@
+/**
+ * @file PartialSort.h
+ * @author Carlos Salguero
+ * @brief Selection of the k smallest elements: introselect, partial sort
+ * with a bounded heap and a streaming top-K with a vectorized threshold
+ * filter
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PARTIAL_SORT_H
+#define PARTIAL_SORT_H
+
+#include <algorithm>   // std::partition(), std::iter_swap()
+#include <bit>         // std::bit_width(), std::countr_zero()
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::int32_t, std::uint32_t, std::uint64_t
+#include <functional>  // std::less<>, std::greater<>, std::ref()
+#include <iterator>    // std::iterator_traits, std::contiguous_iterator
+#include <memory>      // std::to_address()
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::move(), std::pair
+#include <vector>
+
+#include "../HeapSort/HeapSort.h"
+#include "../QuickSort/QuickSort.h"
+#include "../SimdSort/SimdSort.h"
+#include "../SmallSort/SmallSort.h"
+
+namespace custom
+{
+    // Elements per group of the median of medians
+    constexpr std::ptrdiff_t MEDIAN_GROUP_SIZE = 5;
+
+    // A partial sort of more than 1 / PARTIAL_SORT_HEAP_RATIO of the range
+    // selects and sorts the prefix instead of going through a heap, which
+    // loses once it outgrows the faster caches
+    constexpr std::ptrdiff_t PARTIAL_SORT_HEAP_RATIO = 1024;
+
+    /**
+     * @brief
+     * Whether the vectorized threshold filter has kernels for T: the key
+     * types of simd_sort()
+     */
+    template <class T>
+    constexpr bool simd_key_v =
+        std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::uint64_t> || std::is_same_v<T, float>;
+
+    /**
+     * @brief
+     * Whether Compare is the standard descending order of T
+     */
+    template <class T, class Compare>
+    constexpr bool greater_v = std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>;
+
+    /**
+     * @brief
+     * Whether a range of It can be filtered with vector compares under
+     * Compare: contiguous keys of simd_sort() under the standard orderings
+     */
+    template <class It, class T, class Compare>
+    constexpr bool simd_filter_v =
+        std::contiguous_iterator<It> && std::is_same_v<typename std::iterator_traits<It>::value_type, T> &&
+        simd_key_v<T> &&
+        (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>> || greater_v<T, Compare>);
+
+    template <bool Branchless, class RandomIt, class Compare>
+    void intro_select(RandomIt first, RandomIt nth, RandomIt last, Compare &cmp);
+
+    /**
+     * @brief
+     * Median of the medians of groups of MEDIAN_GROUP_SIZE elements, which
+     * has at least 3/10 of the range on either side. The medians are moved
+     * to the front of the range and their median is selected there.
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @return RandomIt Position of the median of medians
+     * @time complexity O(N)
+     * @space complexity O(log(N))
+     */
+    template <class RandomIt, class Compare>
+    RandomIt median_of_medians(RandomIt first, RandomIt last, Compare &cmp)
+    {
+        auto medians{first};
+
+        for (auto group{first}; last - group >= MEDIAN_GROUP_SIZE; group += MEDIAN_GROUP_SIZE)
+        {
+            network_sort<MEDIAN_GROUP_SIZE>(group, cmp);
+            std::iter_swap(medians++, group + MEDIAN_GROUP_SIZE / 2);
+        }
+
+        auto const middle{first + (medians - first) / 2};
+
+        custom::intro_select<false>(first, middle, medians, cmp);
+
+        return middle;
+    }
+
+    /**
+     * @brief
+     * Partition around a copy of *pivot into the elements smaller than it,
+     * the ones equal to it and the larger ones. Without the sentinels
+     * partition_right() relies on, for pivots that are not a median of 3.
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param pivot
+     * @param cmp
+     * @return std::pair<RandomIt, RandomIt> Beginning and end of the
+     * elements equal to the pivot
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class RandomIt, class Compare>
+    std::pair<RandomIt, RandomIt> partition_three_way(RandomIt first, RandomIt last, RandomIt pivot,
+                                                      Compare &cmp)
+    {
+        auto const value{*pivot};
+
+        auto const lower{std::partition(first, last, [&](const auto &element)
+                                        { return cmp(element, value); })};
+        auto const upper{std::partition(lower, last, [&](const auto &element)
+                                        { return !cmp(value, element); })};
+
+        return {lower, upper};
+    }
+
+    /**
+     * @brief
+     * Introselect: quickselect with the pivots and partitions of
+     * quick_sort(), which only goes on into the side that holds nth. After
+     * log2(N) badly unbalanced partitions the pivots are medians of
+     * medians, which bounds the worst case.
+     * @tparam Branchless Whether to use partition_right_branchless()
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param nth
+     * @param last
+     * @param cmp
+     * @time complexity O(N)
+     * @space complexity O(log(N))
+     */
+    template <bool Branchless, class RandomIt, class Compare>
+    void intro_select(RandomIt first, RandomIt nth, RandomIt last, Compare &cmp)
+    {
+        auto bad_allowed{std::bit_width(static_cast<std::size_t>(last - first))};
+        bool leftmost{true};
+
+        while (last - first >= QUICK_INSERTION_CUTOFF)
+        {
+            auto const size{last - first};
+
+            if (bad_allowed == 0)
+            {
+                auto const [lower, upper]{partition_three_way(first, last, median_of_medians(first, last, cmp), cmp)};
+
+                if (nth < lower)
+                    last = lower;
+                else if (nth < upper)
+                    return;
+                else
+                {
+                    first = upper;
+                    leftmost = false;
+                }
+
+                continue;
+            }
+
+            auto const half{size / 2};
+
+            if (size > NINTHER_THRESHOLD)
+            {
+                sort3(first, first + half, last - 1, cmp);
+                sort3(first + 1, first + (half - 1), last - 2, cmp);
+                sort3(first + 2, first + (half + 1), last - 3, cmp);
+                sort3(first + (half - 1), first + half, first + (half + 1), cmp);
+                std::iter_swap(first, first + half);
+            }
+            else
+                sort3(first + half, first, last - 1, cmp);
+
+            // The pivot equals the element before the range: every copy of
+            // it goes to the front at once, and nth may be among them
+            if (!leftmost && !cmp(*(first - 1), *first))
+            {
+                auto const pivot{partition_left(first, last, cmp)};
+
+                if (nth <= pivot)
+                    return;
+
+                first = pivot + 1;
+                continue;
+            }
+
+            auto const pivot{Branchless ? partition_right_branchless(first, last, cmp).first
+                                        : partition_right(first, last, cmp).first};
+
+            if (pivot - first < size / 8 || last - (pivot + 1) < size / 8)
+            {
+                --bad_allowed;
+                break_patterns(first, pivot);
+                break_patterns(pivot + 1, last);
+            }
+
+            if (nth == pivot)
+                return;
+
+            if (nth < pivot)
+                last = pivot;
+            else
+            {
+                first = pivot + 1;
+                leftmost = false;
+            }
+        }
+
+        if (leftmost)
+            small_sort(first, last, std::ref(cmp));
+        else
+            unguarded_insertion_sort(first, last, std::ref(cmp));
+    }
+
+#if SIMD_SORT_X86
+    // The kernels come from SimdSortKernels.h, compiled for their
+    // instruction set; these only pick the vector type for T
+    namespace avx2
+    {
+        template <bool Greater, class Accept>
+        std::size_t top_k_filter(const std::int32_t *data, std::size_t n, std::int32_t threshold, Accept &accept)
+        {
+            return simd_threshold_filter<Int32x8, Greater>(data, n, threshold, accept);
+        }
+
+        template <bool Greater, class Accept>
+        std::size_t top_k_filter(const float *data, std::size_t n, float threshold, Accept &accept)
+        {
+            return simd_threshold_filter<Float32x8, Greater>(data, n, threshold, accept);
+        }
+
+        template <bool Greater, class Accept>
+        std::size_t top_k_filter(const std::uint64_t *data, std::size_t n, std::uint64_t threshold, Accept &accept)
+        {
+            return simd_threshold_filter<UInt64x4, Greater>(data, n, threshold, accept);
+        }
+    }
+
+    namespace avx512
+    {
+        template <bool Greater, class Accept>
+        std::size_t top_k_filter(const std::int32_t *data, std::size_t n, std::int32_t threshold, Accept &accept)
+        {
+            return simd_threshold_filter<Int32x16, Greater>(data, n, threshold, accept);
+        }
+
+        template <bool Greater, class Accept>
+        std::size_t top_k_filter(const float *data, std::size_t n, float threshold, Accept &accept)
+        {
+            return simd_threshold_filter<Float32x16, Greater>(data, n, threshold, accept);
+        }
+
+        template <bool Greater, class Accept>
+        std::size_t top_k_filter(const std::uint64_t *data, std::size_t n, std::uint64_t threshold, Accept &accept)
+        {
+            return simd_threshold_filter<UInt64x8, Greater>(data, n, threshold, accept);
+        }
+    }
+#endif // SIMD_SORT_X86
+
+    /**
+     * @brief
+     * Run the threshold filter of the fastest instruction set of the CPU
+     * over data, or nothing without AVX2
+     * @return std::size_t Number of elements scanned
+     */
+    template <bool Greater, class T, class Accept>
+    std::size_t top_k_filter(const T *data, std::size_t n, T threshold, Accept &accept)
+    {
+#if SIMD_SORT_X86
+        auto const level{simd_supported_level()};
+
+        if (level == SimdLevel::avx512)
+            return avx512::top_k_filter<Greater>(data, n, threshold, accept);
+
+        if (level == SimdLevel::avx2)
+            return avx2::top_k_filter<Greater>(data, n, threshold, accept);
+#endif
+
+        return 0;
+    }
+}
+
+/**
+ * @brief
+ * Rearrange a range so that *nth is the element a sort would put there,
+ * with no greater element before it and no smaller one after it.
+ * Introselect: the pivots and partitions of quick_sort(), including its
+ * branchless partition for arithmetic types, but only the side holding
+ * nth is partitioned again, and repeated badly unbalanced partitions
+ * switch to medians of medians. Not stable.
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first
+ * @param nth Position to select
+ * @param last
+ * @param cmp
+ * @time complexity O(N)
+ * @space complexity O(log(N))
+ */
+template <class RandomIt, class Compare = std::less<>>
+void intro_select(RandomIt first, RandomIt nth, RandomIt last, Compare cmp = Compare{})
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    if (nth == last || last - first <= 1)
+        return;
+
+    custom::intro_select<custom::branchless_partition_v<value_type, Compare>>(first, nth, last, cmp);
+}
+
+/**
+ * @brief
+ * Sort the middle - first smallest elements of a range into [first,
+ * middle), leaving the others in [middle, last) in no particular order.
+ * The prefix is kept as a bounded max-heap that every later element
+ * smaller than its root replaces the root of, so only the elements that
+ * make it into the heap cost more than one comparison. A prefix of more
+ * than 1 / PARTIAL_SORT_HEAP_RATIO of the range is selected with
+ * intro_select() and sorted with quick_sort() instead. Not stable.
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first
+ * @param middle End of the elements to sort
+ * @param last
+ * @param cmp
+ * @time complexity O(N log(k)), k = middle - first
+ * @space complexity O(1), O(log(N)) for large k
+ */
+template <class RandomIt, class Compare = std::less<>>
+void partial_heap_sort(RandomIt first, RandomIt middle, RandomIt last, Compare cmp = Compare{})
+{
+    auto const k{middle - first};
+
+    if (k == 0)
+        return;
+
+    if (k * custom::PARTIAL_SORT_HEAP_RATIO > last - first)
+    {
+        intro_select(first, middle, last, cmp);
+        quick_sort(first, middle, cmp);
+        return;
+    }
+
+    custom::make_heap(first, middle, cmp);
+
+    for (auto it{middle}; it != last; ++it)
+    {
+        if (!cmp(*it, *first))
+            continue;
+
+        auto value{std::move(*it)};
+
+        *it = std::move(*first);
+        custom::heap_sift<2>(first, k, 0, std::move(value), cmp);
+    }
+
+    custom::sort_heap(first, middle, cmp);
+}
+
+/**
+ * @brief
+ * The k smallest values seen so far in a stream, in a bounded max-heap
+ * whose root, the largest value kept, is the threshold a new value has to
+ * come before to get in. For the k largest, use std::greater<>.
+ *
+ * Batches of int32_t, uint64_t or float from contiguous memory under the
+ * standard orderings are compared with the threshold a register at a
+ * time, AVX-512 or AVX2 picked at runtime, and only the lanes that pass
+ * reach the heap; once the heap holds good values that is a tiny fraction
+ * of a large stream. NaNs are not supported.
+ * @tparam T Type of the values
+ * @tparam Compare
+ */
+template <class T, class Compare = std::less<>>
+class TopK
+{
+public:
+    /**
+     * @brief
+     * Construct a new TopK object that keeps k values
+     * @param k Number of values to keep
+     * @param cmp
+     */
+    explicit TopK(std::size_t k, Compare cmp = Compare{})
+        : m_k{k}, m_cmp{cmp}
+    {
+        m_heap.reserve(k);
+    }
+
+    /**
+     * @brief
+     * Get the number of values kept
+     * @return std::size_t Number of values, k once the stream is long
+     * enough
+     */
+    std::size_t get_size() const { return m_heap.size(); }
+
+    /**
+     * @brief
+     * Get the number of values the object keeps at most
+     * @return std::size_t k
+     */
+    std::size_t get_capacity() const { return m_k; }
+
+    /**
+     * @brief
+     * Checks if k values are kept, so that new values have to beat the
+     * threshold
+     * @return true If k values are kept
+     * @return false If there is still room
+     */
+    bool is_full() const { return m_heap.size() == m_k; }
+
+    /**
+     * @brief
+     * Get the largest value kept, which a new value has to come before.
+     * Only meaningful once the object is full.
+     * @return const T& Threshold
+     */
+    const T &threshold() const { return m_heap.front(); }
+
+    /**
+     * @brief
+     * Offer a value
+     * @param value
+     * @time complexity O(1) if it is rejected, O(log(k)) otherwise
+     * @space complexity O(1)
+     */
+    void push(T value)
+    {
+        if (m_heap.size() < m_k)
+        {
+            m_heap.push_back(std::move(value));
+
+            if (is_full())
+                custom::make_heap(m_heap.begin(), m_heap.end(), m_cmp);
+        }
+        else if (m_k > 0 && m_cmp(value, m_heap.front()))
+            replace_threshold(std::move(value));
+    }
+
+    /**
+     * @brief
+     * Offer every value of a range, with the vectorized filter when the
+     * values are contiguous keys of simd_sort()
+     * @tparam InputIt
+     * @param first
+     * @param last
+     * @time complexity O(N log(k)), O(N) for random values
+     * @space complexity O(1)
+     */
+    template <class InputIt>
+    void push(InputIt first, InputIt last)
+    {
+        // The heap is filled through the scalar path, the filter needs its
+        // threshold
+        for (; first != last && !is_full(); ++first)
+            push(*first);
+
+        if (first == last || m_k == 0)
+            return;
+
+        if constexpr (custom::simd_filter_v<InputIt, T, Compare>)
+        {
+            auto const accept{[this](const T &value)
+                              {
+                                  if (m_cmp(value, m_heap.front()))
+                                      replace_threshold(value);
+
+                                  return m_heap.front();
+                              }};
+
+            first += static_cast<std::ptrdiff_t>(custom::top_k_filter<custom::greater_v<T, Compare>>(
+                std::to_address(first), static_cast<std::size_t>(last - first), m_heap.front(), accept));
+        }
+
+        for (; first != last; ++first)
+            if (m_cmp(*first, m_heap.front()))
+                replace_threshold(*first);
+    }
+
+    /**
+     * @brief
+     * Get the values kept, in order
+     * @return std::vector<T> Up to k smallest values seen, sorted
+     * @time complexity O(k log(k))
+     * @space complexity O(k)
+     */
+    std::vector<T> get_sorted() const
+    {
+        auto sorted{m_heap};
+        quick_sort(sorted.begin(), sorted.end(), m_cmp);
+
+        return sorted;
+    }
+
+    /**
+     * @brief
+     * Forget every value, keeping k
+     */
+    void clear() { m_heap.clear(); }
+
+private:
+    std::vector<T> m_heap;
+    std::size_t m_k;
+    Compare m_cmp;
+
+    void replace_threshold(T value)
+    {
+        custom::heap_sift<2>(m_heap.begin(), static_cast<std::ptrdiff_t>(m_heap.size()), 0, std::move(value), m_cmp);
+    }
+};
+
+/**
+ * @brief
+ * The k smallest values of a range or stream, through a TopK
+ * @tparam InputIt Input iterator, istream_iterator included
+ * @tparam Compare
+ * @param first
+ * @param last
+ * @param k Number of values
+ * @param cmp
+ * @return std::vector<value_type> Up to k smallest values, sorted
+ * @time complexity O(N log(k)), O(N + k log(k)) for random values
+ * @space complexity O(k)
+ */
+template <class InputIt, class Compare = std::less<>>
+std::vector<typename std::iterator_traits<InputIt>::value_type> top_k(InputIt first, InputIt last, std::size_t k,
+                                                                      Compare cmp = Compare{})
+{
+    TopK<typename std::iterator_traits<InputIt>::value_type, Compare> top{k, cmp};
+    top.push(first, last);
+
+    return top.get_sorted();
+}
+
+#endif //! PARTIAL_SORT_H
@@ -12,43 +12,510 @@
 #ifndef QUICK_SORT_H
 #define QUICK_SORT_H
 
-#include <algorithm>  // std::partition()
-#include <functional> // std::less<>
-#include <iterator>   // std::next(), std::distance()
+#include <algorithm>   // std::make_heap(), std::sort_heap(), std::iter_swap(), std::min()
+#include <bit>         // std::bit_width()
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <functional>  // std::less<>, std::greater<>, std::ref()
+#include <iterator>    // std::iterator_traits
+#include <type_traits> // std::is_arithmetic_v
+#include <utility>     // std::move(), std::pair
+
+#include "../SmallSort/SmallSort.h"
+
+namespace custom
+{
+    // Ranges smaller than this are finished by small_sort(), or by
+    // unguarded_insertion_sort() when an element precedes them
+    constexpr std::ptrdiff_t QUICK_INSERTION_CUTOFF = 24;
+
+    // Ranges larger than this take the pivot from a ninther
+    constexpr std::ptrdiff_t NINTHER_THRESHOLD = 128;
+
+    // Moves an insertion sort may make on an already partitioned range
+    constexpr std::ptrdiff_t PARTIAL_INSERTION_LIMIT = 8;
+
+    // Elements classified per block by the branchless partition
+    constexpr std::ptrdiff_t PARTITION_BLOCK_SIZE = 64;
+
+    /**
+     * @brief
+     * Whether comparisons are cheap and free of side effects, so that the
+     * branchless partition pays off: arithmetic types under the standard
+     * orderings
+     */
+    template <class T, class Compare>
+    constexpr bool branchless_partition_v =
+        std::is_arithmetic_v<T> &&
+        (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<T>> ||
+         std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<T>>);
+
+    /**
+     * @brief
+     * Insertion sort that gives up after PARTIAL_INSERTION_LIMIT moves. Used
+     * on ranges that were already partitioned, which are often sorted.
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @return true If the range is now sorted
+     * @return false If it gave up
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class RandomIt, class Compare>
+    bool quick_partial_insertion_sort(RandomIt first, RandomIt last, Compare &cmp)
+    {
+        if (first == last)
+            return true;
+
+        std::ptrdiff_t moves{};
+
+        for (auto it{first + 1}; it != last; ++it)
+        {
+            if (!cmp(*it, *(it - 1)))
+                continue;
+
+            auto value{std::move(*it)};
+            auto hole{it};
+
+            do
+                *hole = std::move(*(hole - 1));
+            while (--hole != first && cmp(value, *(hole - 1)));
+
+            *hole = std::move(value);
+            moves += it - hole;
+
+            if (moves > PARTIAL_INSERTION_LIMIT)
+                return false;
+        }
+
+        return true;
+    }
+
+    /**
+     * @brief
+     * Sort three elements in place
+     */
+    template <class RandomIt, class Compare>
+    void sort3(RandomIt a, RandomIt b, RandomIt c, Compare &cmp)
+    {
+        if (cmp(*b, *a))
+            std::iter_swap(a, b);
+
+        if (cmp(*c, *b))
+        {
+            std::iter_swap(b, c);
+
+            if (cmp(*b, *a))
+                std::iter_swap(a, b);
+        }
+    }
+
+    /**
+     * @brief
+     * Partition around the pivot at *first: elements smaller than it end up
+     * on its left, the others on its right. Needs an element no smaller
+     * than the pivot somewhere after it, which the median selection leaves
+     * at last - 1.
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @return std::pair<RandomIt, bool> Final position of the pivot, and
+     * whether the range was already partitioned
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class RandomIt, class Compare>
+    std::pair<RandomIt, bool> partition_right(RandomIt first, RandomIt last, Compare &cmp)
+    {
+        auto pivot{std::move(*first)};
+        auto left{first};
+        auto right{last};
+
+        while (cmp(*++left, pivot))
+            ;
+
+        // Only the first scan from the right needs a bounds check, and only
+        // if nothing smaller than the pivot was found on the left
+        if (left - 1 == first)
+            while (left < right && !cmp(*--right, pivot))
+                ;
+        else
+            while (!cmp(*--right, pivot))
+                ;
+
+        bool const already_partitioned{left >= right};
+
+        while (left < right)
+        {
+            std::iter_swap(left, right);
+
+            while (cmp(*++left, pivot))
+                ;
+
+            while (!cmp(*--right, pivot))
+                ;
+        }
+
+        auto const position{left - 1};
+        *first = std::move(*position);
+        *position = std::move(pivot);
+
+        return {position, already_partitioned};
+    }
+
+    /**
+     * @brief
+     * Swap the misplaced elements found by partition_right_branchless(),
+     * with a cyclic permutation when the counts differ
+     */
+    template <class RandomIt>
+    void swap_offsets(RandomIt left_base, RandomIt right_base, const unsigned char *left,
+                      const unsigned char *right, std::ptrdiff_t count, bool use_swaps)
+    {
+        if (use_swaps)
+        {
+            for (std::ptrdiff_t i{}; i < count; ++i)
+                std::iter_swap(left_base + left[i], right_base - right[i]);
+        }
+        else if (count > 0)
+        {
+            auto l{left_base + left[0]};
+            auto r{right_base - right[0]};
+            auto value{std::move(*l)};
+            *l = std::move(*r);
+
+            for (std::ptrdiff_t i{1}; i < count; ++i)
+            {
+                l = left_base + left[i];
+                *r = std::move(*l);
+                r = right_base - right[i];
+                *l = std::move(*r);
+            }
+
+            *r = std::move(value);
+        }
+    }
+
+    /**
+     * @brief
+     * Same as partition_right(), but the elements are first classified a
+     * block at a time into buffers of offsets, without a branch on the
+     * result of each comparison (BlockQuicksort), and the misplaced ones
+     * are swapped afterwards. This removes the branch mispredictions of
+     * random input.
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @return std::pair<RandomIt, bool> Final position of the pivot, and
+     * whether the range was already partitioned
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class RandomIt, class Compare>
+    std::pair<RandomIt, bool> partition_right_branchless(RandomIt first, RandomIt last,
+                                                         Compare &cmp)
+    {
+        auto pivot{std::move(*first)};
+        auto left{first};
+        auto right{last};
+
+        while (cmp(*++left, pivot))
+            ;
+
+        if (left - 1 == first)
+            while (left < right && !cmp(*--right, pivot))
+                ;
+        else
+            while (!cmp(*--right, pivot))
+                ;
+
+        bool const already_partitioned{left >= right};
+
+        if (!already_partitioned)
+        {
+            std::iter_swap(left, right);
+            ++left;
+
+            alignas(64) unsigned char left_offsets[PARTITION_BLOCK_SIZE];
+            alignas(64) unsigned char right_offsets[PARTITION_BLOCK_SIZE];
+
+            auto left_base{left};
+            auto right_base{right};
+            std::ptrdiff_t left_count{}, right_count{}, left_start{}, right_start{};
+
+            while (left < right)
+            {
+                // Fill whichever buffer is empty, splitting what is left
+                // between both when they are
+                auto const unknown{right - left};
+                auto const left_split{left_count == 0 ? (right_count == 0 ? unknown / 2 : unknown) : 0};
+                auto const right_split{right_count == 0 ? unknown - left_split : 0};
+
+                for (std::ptrdiff_t i{}, n{std::min(left_split, PARTITION_BLOCK_SIZE)}; i < n; ++i)
+                {
+                    left_offsets[left_count] = static_cast<unsigned char>(i);
+                    left_count += !cmp(*left++, pivot);
+                }
+
+                for (std::ptrdiff_t i{}, n{std::min(right_split, PARTITION_BLOCK_SIZE)}; i < n;)
+                {
+                    right_offsets[right_count] = static_cast<unsigned char>(++i);
+                    right_count += cmp(*--right, pivot);
+                }
+
+                auto const count{std::min(left_count, right_count)};
+
+                swap_offsets(left_base, right_base, left_offsets + left_start,
+                             right_offsets + right_start, count, left_count == right_count);
+
+                left_count -= count;
+                right_count -= count;
+                left_start += count;
+                right_start += count;
+
+                if (left_count == 0)
+                {
+                    left_start = 0;
+                    left_base = left;
+                }
+
+                if (right_count == 0)
+                {
+                    right_start = 0;
+                    right_base = right;
+                }
+            }
+
+            // One buffer may still hold misplaced elements, move them to
+            // the far end of the unknown part, which is empty by now
+            if (left_count > 0)
+            {
+                while (left_count-- > 0)
+                    std::iter_swap(left_base + left_offsets[left_start + left_count], --right);
+
+                left = right;
+            }
+
+            if (right_count > 0)
+            {
+                while (right_count-- > 0)
+                    std::iter_swap(right_base - right_offsets[right_start + right_count], left++);
+
+                right = left;
+            }
+        }
+
+        auto const position{left - 1};
+        *first = std::move(*position);
+        *position = std::move(pivot);
+
+        return {position, already_partitioned};
+    }
+
+    /**
+     * @brief
+     * Partition around the pivot at *first, putting the elements equal to
+     * it on its left. Used when the pivot equals the element before the
+     * range, which then only holds values equal to it.
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @return RandomIt Final position of the pivot
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class RandomIt, class Compare>
+    RandomIt partition_left(RandomIt first, RandomIt last, Compare &cmp)
+    {
+        auto pivot{std::move(*first)};
+        auto left{first};
+        auto right{last};
+
+        while (cmp(pivot, *--right))
+            ;
+
+        if (right + 1 == last)
+            while (left < right && !cmp(pivot, *++left))
+                ;
+        else
+            while (!cmp(pivot, *++left))
+                ;
+
+        while (left < right)
+        {
+            std::iter_swap(left, right);
+
+            while (cmp(pivot, *--right))
+                ;
+
+            while (!cmp(pivot, *++left))
+                ;
+        }
+
+        *first = std::move(*right);
+        *right = std::move(pivot);
+
+        return right;
+    }
+
+    /**
+     * @brief
+     * Shuffle a few elements of a range left badly unbalanced by a
+     * partition, so the next pivots are not chosen the same way
+     */
+    template <class RandomIt>
+    void break_patterns(RandomIt first, RandomIt last)
+    {
+        auto const size{last - first};
+        auto const quarter{size / 4};
+
+        if (size < QUICK_INSERTION_CUTOFF)
+            return;
+
+        std::iter_swap(first, first + quarter);
+        std::iter_swap(last - 1, last - quarter);
+
+        if (size > NINTHER_THRESHOLD)
+        {
+            std::iter_swap(first + 1, first + (quarter + 1));
+            std::iter_swap(first + 2, first + (quarter + 2));
+            std::iter_swap(last - 2, last - (quarter + 1));
+            std::iter_swap(last - 3, last - (quarter + 2));
+        }
+    }
+
+    /**
+     * @brief
+     * Recursive step of quick_sort(). It recurses into the smaller side of
+     * every partition and loops on the larger one, so the stack stays
+     * O(log(N)).
+     * @tparam Branchless Whether to use partition_right_branchless()
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param last
+     * @param cmp
+     * @param bad_allowed Unbalanced partitions left before heap sort
+     * @param leftmost Whether nothing precedes the range
+     */
+    template <bool Branchless, class RandomIt, class Compare>
+    void quick_sort(RandomIt first, RandomIt last, Compare &cmp, int bad_allowed,
+                    bool leftmost)
+    {
+        while (true)
+        {
+            auto const size{last - first};
+
+            if (size < QUICK_INSERTION_CUTOFF)
+            {
+                if (leftmost)
+                    small_sort(first, last, std::ref(cmp));
+                else
+                    unguarded_insertion_sort(first, last, std::ref(cmp));
+
+                return;
+            }
+
+            // Move the median of 3, or of 3 medians of 3, to the front
+            auto const half{size / 2};
+
+            if (size > NINTHER_THRESHOLD)
+            {
+                sort3(first, first + half, last - 1, cmp);
+                sort3(first + 1, first + (half - 1), last - 2, cmp);
+                sort3(first + 2, first + (half + 1), last - 3, cmp);
+                sort3(first + (half - 1), first + half, first + (half + 1), cmp);
+                std::iter_swap(first, first + half);
+            }
+            else
+                sort3(first + half, first, last - 1, cmp);
+
+            // The pivot equals the element before the range, which is no
+            // greater than anything in it: skip every copy of it at once
+            if (!leftmost && !cmp(*(first - 1), *first))
+            {
+                first = partition_left(first, last, cmp) + 1;
+                continue;
+            }
+
+            auto const [pivot, already_partitioned]{
+                Branchless ? partition_right_branchless(first, last, cmp)
+                           : partition_right(first, last, cmp)};
+
+            auto const left_size{pivot - first};
+            auto const right_size{last - (pivot + 1)};
+
+            if (left_size < size / 8 || right_size < size / 8)
+            {
+                if (--bad_allowed == 0)
+                {
+                    std::make_heap(first, last, cmp);
+                    std::sort_heap(first, last, cmp);
+                    return;
+                }
+
+                break_patterns(first, pivot);
+                break_patterns(pivot + 1, last);
+            }
+            else if (already_partitioned &&
+                     quick_partial_insertion_sort(first, pivot, cmp) &&
+                     quick_partial_insertion_sort(pivot + 1, last, cmp))
+                return;
+
+            if (left_size < right_size)
+            {
+                custom::quick_sort<Branchless>(first, pivot, cmp, bad_allowed, leftmost);
+                first = pivot + 1;
+                leftmost = false;
+            }
+            else
+            {
+                custom::quick_sort<Branchless>(pivot + 1, last, cmp, bad_allowed, false);
+                last = pivot;
+            }
+        }
+    }
+}
 
 /**
  * @brief
- *
- * @tparam FwdIt
+ * Pattern-defeating quicksort. Pivots are the median of 3 elements, or of
+ * 3 medians of 3 on large ranges, and small ranges are finished by the
+ * leaf sorts of SmallSort.h. A range that was already partitioned is tried with an
+ * insertion sort that gives up quickly, so sorted and nearly sorted input
+ * take linear time, and runs of equal elements are skipped in one pass.
+ * Badly unbalanced partitions shuffle a few elements to break the pattern
+ * behind them, and after log(N) of them the range is heap sorted, which
+ * bounds the worst case. Arithmetic types under the standard orderings use
+ * a branchless block partition.
+ * @tparam RandomIt
  * @tparam Compare
  * @param first
- * @param second
+ * @param last
  * @param cmp
- * @time complexity O(N log(N))
- * @space complexity O(N)
+ * @time complexity O(N log(N)), O(N) on sorted input
+ * @space complexity O(log(N))
  */
-template <class FwdIt, class Compare = std::less<>>
-void quick_sort(FwdIt first, FwdIt second, Compare cmp = Compare{})
+template <class RandomIt, class Compare = std::less<>>
+void quick_sort(RandomIt first, RandomIt last, Compare cmp = Compare{})
 {
-    auto const N{std::distance(first, last)};
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+
+    auto const N{last - first};
 
     if (N <= 1)
         return;
 
-    auto const pivot{*std::next(first, N / 2)};
-
-    auto const middle_left{
-        std::partition(
-            first, last, [=](auto const &elem)
-            { return cmp(elem, pivot); })};
-
-    auto const middle_right{
-        std::partition(
-            middle_left, last, [=](auto const &elem)
-            { return !cmp(pivot, elem); })};
-
-    quick_sort(first, middle_left, cmp);
-    quick_sort(middle_right, last, cmp);
+    custom::quick_sort<custom::branchless_partition_v<value_type, Compare>>(
+        first, last, cmp, std::bit_width(static_cast<std::size_t>(N)), true);
 }
 
-#endif //! QUICK_SORT_H
\ No newline at end of file
+#endif //! QUICK_SORT_H
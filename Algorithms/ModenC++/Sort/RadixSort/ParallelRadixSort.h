@@ -0,0 +1,418 @@
+/**
+ * @file ParallelRadixSort.h
+ * @author Carlos Salguero
+ * @brief Parallel LSD Radix Sort Algorithm on top of the fork-join
+ * ThreadPool
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PARALLEL_RADIX_SORT_H
+#define PARALLEL_RADIX_SORT_H
+
+#include <algorithm> // std::min(), std::move()
+#include <array>
+#include <climits>   // CHAR_BIT
+#include <cstddef>   // std::size_t, std::ptrdiff_t
+#include <cstdint>   // std::uintptr_t
+#include <iterator>  // std::iterator_traits, std::contiguous_iterator
+#include <memory>    // std::unique_ptr, std::to_address()
+#include <new>       // std::align_val_t
+#include <utility>   // std::exchange()
+#include <vector>
+
+#include "RadixSort.h"
+#include "../../../../DataStructures/Concurrency/ThreadPool.h"
+
+namespace custom
+{
+    // Ranges up to this size are sorted by lsd_radix_sort(), and every
+    // block of the parallel sort holds at least this many elements
+    constexpr std::ptrdiff_t RADIX_SEQUENTIAL_CUTOFF = 1 << 16;
+
+    // Buckets per pass of the parallel sort, one byte of the key
+    constexpr std::size_t RADIX_PARALLEL_BUCKETS = 256;
+
+    // Bytes staged per bucket before they are written out, a cache line
+    constexpr std::size_t RADIX_STAGING_BYTES = 64;
+
+    using radix_histogram = std::array<std::ptrdiff_t, RADIX_PARALLEL_BUCKETS>;
+
+    /**
+     * @brief
+     * Elements staged per bucket, a cache line of them or a single large one
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    constexpr std::ptrdiff_t radix_staging_size()
+    {
+        return sizeof(T) >= RADIX_STAGING_BYTES ? 1 : RADIX_STAGING_BYTES / sizeof(T);
+    }
+
+    /**
+     * @brief
+     * Position of an element in its cache line, in elements. Only known for
+     * contiguous outputs of elements that divide a line; the others count
+     * as starting one.
+     * @tparam T Type of the elements
+     * @tparam OutputIt
+     * @param position
+     * @return std::ptrdiff_t Elements of the line before position
+     */
+    template <class T, class OutputIt>
+    std::ptrdiff_t radix_line_offset(OutputIt position)
+    {
+        if constexpr (std::contiguous_iterator<OutputIt> && RADIX_STAGING_BYTES % sizeof(T) == 0)
+            return static_cast<std::ptrdiff_t>(
+                (reinterpret_cast<std::uintptr_t>(std::to_address(position)) % RADIX_STAGING_BYTES) / sizeof(T));
+        else
+            return 0;
+    }
+
+    /**
+     * @brief
+     * Frees the buffers of make_radix_buffer()
+     * @tparam T Type of the elements
+     */
+    template <class T>
+    struct radix_buffer_deleter
+    {
+        std::size_t size{};
+
+        void operator()(T *data) const
+        {
+            std::destroy_n(data, size);
+            ::operator delete[](data, std::align_val_t{std::max(RADIX_STAGING_BYTES, alignof(T))});
+        }
+    };
+
+    template <class T>
+    using radix_buffer = std::unique_ptr<T[], radix_buffer_deleter<T>>;
+
+    /**
+     * @brief
+     * Default-initialized elements that start on a cache line, so that the
+     * scatters into them write whole lines
+     * @tparam T Type of the elements
+     * @param size Number of elements
+     * @return radix_buffer<T>
+     * @throw std::bad_alloc If the buffer cannot be allocated
+     */
+    template <class T>
+    radix_buffer<T> make_radix_buffer(std::size_t size)
+    {
+        std::align_val_t const alignment{std::max(RADIX_STAGING_BYTES, alignof(T))};
+        auto *const data{static_cast<T *>(::operator new[](size * sizeof(T), alignment))};
+
+        try
+        {
+            std::uninitialized_default_construct_n(data, size);
+        }
+        catch (...)
+        {
+            ::operator delete[](data, alignment);
+            throw;
+        }
+
+        return radix_buffer<T>{data, radix_buffer_deleter<T>{size}};
+    }
+
+    /**
+     * @brief
+     * Count the byte at shift of every key in [first, last)
+     * @tparam InputIt
+     * @tparam Projection
+     * @param first
+     * @param last
+     * @param count Histogram to fill
+     * @param shift Position of the byte, in bits
+     * @param proj
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class InputIt, class Projection>
+    void radix_count(InputIt first, InputIt last, radix_histogram &count,
+                     std::size_t shift, Projection &proj)
+    {
+        count.fill(0);
+
+        for (; first != last; ++first)
+            ++count[(radix_key_of(proj, *first) >> shift) & 0xFF];
+    }
+
+    /**
+     * @brief
+     * Stable scatter of [first, last) by the byte at shift. Writing every
+     * element straight to its bucket touches up to 256 distant output lines
+     * and pages at once, so the elements are staged per bucket in a small
+     * buffer that stays in L1 and written out a full cache line at a time.
+     * The first write of a bucket is cut short at the end of the line of
+     * the output it starts in, so that the later ones cover whole lines of
+     * a contiguous output of elements that divide a line.
+     * @tparam InputIt
+     * @tparam OutputIt
+     * @tparam T Type of the elements
+     * @tparam Projection
+     * @param first
+     * @param last
+     * @param out Beginning of the output
+     * @param next Position in the output of the next element of every
+     * bucket, advanced past the elements written
+     * @param staging Room for RADIX_PARALLEL_BUCKETS * radix_staging_size<T>()
+     * elements
+     * @param shift Position of the byte, in bits
+     * @param proj
+     * @time complexity O(N)
+     * @space complexity O(1)
+     */
+    template <class InputIt, class OutputIt, class T, class Projection>
+    void radix_scatter(InputIt first, InputIt last, OutputIt out, radix_histogram &next,
+                       T *staging, std::size_t shift, Projection &proj)
+    {
+        constexpr auto LINE{radix_staging_size<T>()};
+
+        radix_histogram fill{};
+        radix_histogram limit;
+
+        for (std::size_t bucket{}; bucket < RADIX_PARALLEL_BUCKETS; ++bucket)
+            limit[bucket] = LINE - radix_line_offset<T>(out + next[bucket]);
+
+        for (; first != last; ++first)
+        {
+            auto const bucket{static_cast<std::size_t>((radix_key_of(proj, *first) >> shift) & 0xFF)};
+            auto *const line{staging + bucket * LINE};
+
+            line[fill[bucket]++] = std::move(*first);
+
+            if (fill[bucket] == limit[bucket])
+            {
+                std::move(line, line + fill[bucket], out + next[bucket]);
+
+                next[bucket] += fill[bucket];
+                fill[bucket] = 0;
+                limit[bucket] = LINE;
+            }
+        }
+
+        for (std::size_t bucket{}; bucket < RADIX_PARALLEL_BUCKETS; ++bucket)
+        {
+            auto *const line{staging + bucket * LINE};
+
+            std::move(line, line + fill[bucket], out + next[bucket]);
+            next[bucket] += fill[bucket];
+        }
+    }
+
+    /**
+     * @brief
+     * Body of parallel_radix_sort(). The range is split into one block per
+     * task. Every block keeps its own histograms, so counting needs no
+     * synchronization; the histograms are then merged by a prefix sum in
+     * bucket-major order, which gives each block the place of its elements
+     * in every bucket, after the same bucket of the blocks before it. The
+     * blocks scatter in parallel and the data moves back and forth between
+     * the range and the buffer.
+     * @tparam RandomIt
+     * @tparam BufferIt
+     * @tparam Projection
+     * @param first
+     * @param last
+     * @param buffer Scratch room for last - first elements
+     * @param proj
+     * @param pool Pool to run in, from one of its workers
+     * @param blocks Number of blocks
+     */
+    template <class RandomIt, class BufferIt, class Projection>
+    void parallel_radix_sort(RandomIt first, RandomIt last, BufferIt buffer, Projection &proj,
+                             ThreadPool &pool, std::ptrdiff_t blocks)
+    {
+        using value_type = typename std::iterator_traits<RandomIt>::value_type;
+        using key_type = decltype(radix_key_of(proj, *first));
+
+        constexpr std::size_t DIGITS{sizeof(key_type) * CHAR_BIT / 8};
+
+        // Aligned so that the histograms of neighbouring blocks never share
+        // a cache line
+        struct alignas(64) Block
+        {
+            std::array<radix_histogram, DIGITS> counts;
+            radix_buffer<value_type> staging;
+        };
+
+        auto const N{last - first};
+        auto const bound{[&](std::ptrdiff_t block)
+                         { return N * block / blocks; }};
+
+        std::vector<Block> state(blocks);
+
+        // Every histogram of the original order in a single pass
+        pool.parallel_for(std::ptrdiff_t{0}, blocks, std::ptrdiff_t{1},
+                          [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                          {
+                              for (auto block{begin}; block != end; ++block)
+                              {
+                                  auto &counts{state[block].counts};
+
+                                  for (auto &count : counts)
+                                      count.fill(0);
+
+                                  for (auto it{first + bound(block)}; it != first + bound(block + 1); ++it)
+                                  {
+                                      auto const key{radix_key_of(proj, *it)};
+
+                                      for (std::size_t digit{}; digit < DIGITS; ++digit)
+                                          ++counts[digit][(key >> (digit * 8)) & 0xFF];
+                                  }
+                              }
+                          });
+
+        auto const sample{radix_key_of(proj, *first)};
+        bool in_buffer{false};
+        bool moved{false};
+
+        auto const pass{[&](auto source, auto target, std::size_t digit)
+                        {
+                            auto const shift{digit * 8};
+
+                            // Once the elements moved, the blocks hold other elements;
+                            // a single block holds all of them in any order
+                            if (moved && blocks > 1)
+                                pool.parallel_for(std::ptrdiff_t{0}, blocks, std::ptrdiff_t{1},
+                                                  [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                                                  {
+                                                      for (auto block{begin}; block != end; ++block)
+                                                          radix_count(source + bound(block), source + bound(block + 1),
+                                                                      state[block].counts[digit], shift, proj);
+                                                  });
+
+                            std::ptrdiff_t sum{};
+
+                            for (std::size_t bucket{}; bucket < RADIX_PARALLEL_BUCKETS; ++bucket)
+                                for (auto &block : state)
+                                    sum += std::exchange(block.counts[digit][bucket], sum);
+
+                            pool.parallel_for(std::ptrdiff_t{0}, blocks, std::ptrdiff_t{1},
+                                              [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                                              {
+                                                  for (auto block{begin}; block != end; ++block)
+                                                  {
+                                                      // Allocated by the task that uses it
+                                                      auto &staging{state[block].staging};
+
+                                                      if (!staging)
+                                                          staging = make_radix_buffer<value_type>(
+                                                              RADIX_PARALLEL_BUCKETS * radix_staging_size<value_type>());
+
+                                                      radix_scatter(source + bound(block), source + bound(block + 1),
+                                                                    target, state[block].counts[digit],
+                                                                    staging.get(), shift, proj);
+                                                  }
+                                              });
+                        }};
+
+        for (std::size_t digit{}; digit < DIGITS; ++digit)
+        {
+            std::ptrdiff_t same{};
+
+            for (auto const &block : state)
+                same += block.counts[digit][(sample >> (digit * 8)) & 0xFF];
+
+            // Every element has the same byte here, the histograms of the
+            // original order are still valid for it
+            if (same == N)
+                continue;
+
+            if (in_buffer)
+                pass(buffer, first, digit);
+            else
+                pass(first, buffer, digit);
+
+            in_buffer = !in_buffer;
+            moved = true;
+        }
+
+        if (in_buffer)
+            pool.parallel_for(std::ptrdiff_t{0}, blocks, std::ptrdiff_t{1},
+                              [&](std::ptrdiff_t begin, std::ptrdiff_t end)
+                              { std::move(buffer + bound(begin), buffer + bound(end), first + bound(begin)); });
+    }
+}
+
+/**
+ * @brief
+ * Stable parallel LSD radix sort with a caller-provided scratch buffer, so
+ * repeated sorts do not allocate the N elements again. The keys are the
+ * projections of the elements, as in lsd_radix_sort(), sorted one byte at
+ * a time; bytes that are the same for every element are skipped. Every
+ * worker counts and scatters its own block, through per-bucket staging
+ * buffers of a cache line. Small ranges go to lsd_radix_sort(). The
+ * elements have to be default constructible.
+ * @tparam RandomIt
+ * @tparam BufferIt Random access iterator to elements of the same type
+ * @tparam Projection Function from an element to its arithmetic key
+ * @param first
+ * @param last
+ * @param buffer Beginning of at least last - first constructed elements,
+ * overwritten by the sort
+ * @param proj
+ * @param pool Pool to run in
+ * @time complexity O(N * bytes) work, O(N * bytes / threads + 256 * threads)
+ * span
+ * @space complexity O(threads * (bytes * 256 + 256 * 64 bytes)), besides
+ * the buffer
+ */
+template <class RandomIt, class BufferIt, class Projection>
+void parallel_radix_sort(RandomIt first, RandomIt last, BufferIt buffer, Projection proj,
+                         ThreadPool &pool)
+{
+    auto const N{last - first};
+
+    if (N <= custom::RADIX_SEQUENTIAL_CUTOFF)
+    {
+        lsd_radix_sort(first, last, proj);
+        return;
+    }
+
+    auto const blocks{std::min(static_cast<std::ptrdiff_t>(pool.get_size()),
+                               N / custom::RADIX_SEQUENTIAL_CUTOFF)};
+
+    pool.run([&]
+             { custom::parallel_radix_sort(first, last, buffer, proj, pool, blocks); });
+}
+
+/**
+ * @brief
+ * Stable parallel LSD radix sort. The scratch buffer is allocated once for
+ * the whole sort, on a cache line boundary and without initializing
+ * trivial types; the elements have to be default constructible.
+ * @tparam RandomIt
+ * @tparam Projection Function from an element to its arithmetic key
+ * @param first
+ * @param last
+ * @param proj
+ * @param pool Pool to run in, the process-wide one by default
+ * @throw std::bad_alloc If the buffer cannot be allocated
+ * @time complexity O(N * bytes) work, O(N * bytes / threads + 256 * threads)
+ * span
+ * @space complexity O(N)
+ */
+template <class RandomIt, class Projection = std::identity>
+void parallel_radix_sort(RandomIt first, RandomIt last, Projection proj = {},
+                         ThreadPool &pool = ThreadPool::instance())
+{
+    if (last - first <= custom::RADIX_SEQUENTIAL_CUTOFF)
+    {
+        lsd_radix_sort(first, last, proj);
+        return;
+    }
+
+    auto const buffer{custom::make_radix_buffer<typename std::iterator_traits<RandomIt>::value_type>(
+        static_cast<std::size_t>(last - first))};
+
+    parallel_radix_sort(first, last, buffer.get(), proj, pool);
+}
+
+#endif //! PARALLEL_RADIX_SORT_H
@@ -0,0 +1,293 @@
+/**
+ * @file RadixSort.h
+ * @author Carlos Salguero
+ * @brief LSD and MSD (American flag) Radix Sort Algorithms implemented with
+ * Modern C++
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <algorithm>   // std::move(), std::iter_swap()
+#include <array>
+#include <bit>         // std::bit_cast()
+#include <climits>     // CHAR_BIT
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::uint32_t, std::uint64_t
+#include <functional>  // std::identity, std::invoke()
+#include <iterator>    // std::iterator_traits, std::make_move_iterator()
+#include <type_traits> // std::make_unsigned_t, std::is_floating_point_v
+#include <utility>     // std::exchange(), std::move()
+#include <vector>
+
+#include "../SmallSort/SmallSort.h"
+
+namespace custom
+{
+    // Buckets of the MSD sort up to this size are finished by small_sort()
+    constexpr std::ptrdiff_t RADIX_INSERTION_CUTOFF = 32;
+
+    /**
+     * @brief
+     * Unsigned integer that orders like a key: unsigned keys are kept,
+     * signed keys get their sign bit flipped, and floating point keys flip
+     * every bit when negative and only the sign bit otherwise
+     * @tparam Key Arithmetic type of the key
+     */
+    template <class Key>
+    struct radix_key_type
+    {
+        using type = std::make_unsigned_t<Key>;
+    };
+
+    template <>
+    struct radix_key_type<bool>
+    {
+        using type = unsigned char;
+    };
+
+    template <>
+    struct radix_key_type<float>
+    {
+        using type = std::uint32_t;
+    };
+
+    template <>
+    struct radix_key_type<double>
+    {
+        using type = std::uint64_t;
+    };
+
+    template <class Key>
+    using radix_key_t = typename radix_key_type<std::remove_cv_t<Key>>::type;
+
+    /**
+     * @brief
+     * Map a key to radix_key_t<Key> keeping its order
+     * @tparam Key Arithmetic type of the key
+     * @param key Key to be mapped
+     * @return radix_key_t<Key> Unsigned key with the same order
+     */
+    template <class Key>
+    constexpr radix_key_t<Key> radix_key(Key key)
+    {
+        using unsigned_t = radix_key_t<Key>;
+
+        constexpr auto sign{unsigned_t{1} << (sizeof(unsigned_t) * CHAR_BIT - 1)};
+
+        if constexpr (std::is_floating_point_v<Key>)
+        {
+            // -0.0 sorts right before 0.0
+            static_assert(sizeof(Key) == sizeof(unsigned_t), "unsupported floating point type");
+
+            auto const bits{std::bit_cast<unsigned_t>(key)};
+
+            return (bits & sign) ? static_cast<unsigned_t>(~bits) : static_cast<unsigned_t>(bits | sign);
+        }
+        else if constexpr (std::is_signed_v<Key>)
+            return static_cast<unsigned_t>(static_cast<unsigned_t>(key) ^ sign);
+        else
+            return static_cast<unsigned_t>(key);
+    }
+
+    /**
+     * @brief
+     * Key of an element under a projection, as an order-preserving
+     * unsigned integer
+     */
+    template <class Projection, class T>
+    constexpr auto radix_key_of(Projection &proj, const T &value)
+    {
+        return radix_key(std::invoke(proj, value));
+    }
+
+    /**
+     * @brief
+     * Recursive step of msd_radix_sort(): distribute [first, last) by the
+     * byte at shift in place, then sort every bucket by the next byte
+     * @param shift Position of the byte, in bits
+     */
+    template <class RandomIt, class Projection>
+    void msd_radix_sort(RandomIt first, RandomIt last, Projection &proj, int shift)
+    {
+        auto const N{last - first};
+
+        if (N <= RADIX_INSERTION_CUTOFF)
+        {
+            small_sort(first, last, [&proj](const auto &a, const auto &b)
+                       { return radix_key_of(proj, a) < radix_key_of(proj, b); });
+            return;
+        }
+
+        auto const digit{[&](const auto &value)
+                         { return static_cast<std::size_t>((radix_key_of(proj, value) >> shift) & 0xFF); }};
+
+        std::array<std::ptrdiff_t, 256> counts{};
+
+        for (auto it{first}; it != last; ++it)
+            ++counts[digit(*it)];
+
+        // Every element has the same byte here, go straight to the next one
+        if (counts[digit(*first)] == N)
+        {
+            if (shift > 0)
+                msd_radix_sort(first, last, proj, shift - 8);
+
+            return;
+        }
+
+        std::array<std::ptrdiff_t, 256> next;
+        std::array<std::ptrdiff_t, 256> end;
+        std::ptrdiff_t sum{};
+
+        for (std::size_t bucket{}; bucket < 256; ++bucket)
+        {
+            next[bucket] = sum;
+            sum += counts[bucket];
+            end[bucket] = sum;
+        }
+
+        // American flag: swap every element into the next free slot of its
+        // bucket until each bucket only holds its own elements
+        for (std::size_t bucket{}; bucket < 256; ++bucket)
+        {
+            while (next[bucket] < end[bucket])
+            {
+                auto const target{digit(first[next[bucket]])};
+
+                if (target == bucket)
+                    ++next[bucket];
+                else
+                    std::iter_swap(first + next[bucket], first + next[target]++);
+            }
+        }
+
+        if (shift == 0)
+            return;
+
+        std::ptrdiff_t begin{};
+
+        for (std::size_t bucket{}; bucket < 256; ++bucket)
+        {
+            if (end[bucket] - begin > 1)
+                msd_radix_sort(first + begin, first + end[bucket], proj, shift - 8);
+
+            begin = end[bucket];
+        }
+    }
+}
+
+/**
+ * @brief
+ * Stable LSD radix sort. The keys are the projections of the elements,
+ * integers or floating point numbers, mapped to unsigned integers that
+ * order the same way; they are distributed by DigitBits bits at a time,
+ * from the least significant digit, between the range and a buffer. The
+ * histograms of every digit are built in a single pass, and digits that are
+ * the same for every element are skipped.
+ * @tparam DigitBits Bits per digit, 8, 11 or 16 being the usual choices
+ * @tparam RandomIt
+ * @tparam Projection Function from an element to its arithmetic key
+ * @param first
+ * @param last
+ * @param proj
+ * @time complexity O(N * bits / DigitBits + 2^DigitBits * bits / DigitBits)
+ * @space complexity O(N + 2^DigitBits * bits / DigitBits)
+ */
+template <std::size_t DigitBits = 8, class RandomIt, class Projection = std::identity>
+void lsd_radix_sort(RandomIt first, RandomIt last, Projection proj = {})
+{
+    using value_type = typename std::iterator_traits<RandomIt>::value_type;
+    using key_type = decltype(custom::radix_key_of(proj, *first));
+
+    static_assert(DigitBits >= 1 && DigitBits <= 16, "digits have between 1 and 16 bits");
+
+    constexpr std::size_t BUCKETS{std::size_t{1} << DigitBits};
+    constexpr std::size_t DIGITS{(sizeof(key_type) * CHAR_BIT + DigitBits - 1) / DigitBits};
+    constexpr key_type MASK{static_cast<key_type>(BUCKETS - 1)};
+
+    auto const N{last - first};
+
+    if (N <= 1)
+        return;
+
+    std::vector<std::array<std::ptrdiff_t, BUCKETS>> counts(DIGITS);
+
+    for (auto it{first}; it != last; ++it)
+    {
+        auto const key{custom::radix_key_of(proj, *it)};
+
+        for (std::size_t digit{}; digit < DIGITS; ++digit)
+            ++counts[digit][(key >> (digit * DigitBits)) & MASK];
+    }
+
+    // A digit is trivial when every element has the one of any element
+    auto const sample{custom::radix_key_of(proj, *first)};
+
+    std::vector<value_type> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+    bool in_buffer{true};
+
+    for (std::size_t digit{}; digit < DIGITS; ++digit)
+    {
+        auto const shift{digit * DigitBits};
+        auto &count{counts[digit]};
+
+        if (count[(sample >> shift) & MASK] == N)
+            continue;
+
+        std::ptrdiff_t sum{};
+
+        for (auto &bucket : count)
+            sum += std::exchange(bucket, sum);
+
+        auto const scatter{[&](auto source, auto source_last, auto target)
+                           {
+                               for (; source != source_last; ++source)
+                                   target[count[(custom::radix_key_of(proj, *source) >> shift) & MASK]++] =
+                                       std::move(*source);
+                           }};
+
+        if (in_buffer)
+            scatter(buffer.begin(), buffer.end(), first);
+        else
+            scatter(first, last, buffer.begin());
+
+        in_buffer = !in_buffer;
+    }
+
+    if (in_buffer)
+        std::move(buffer.begin(), buffer.end(), first);
+}
+
+/**
+ * @brief
+ * In-place MSD radix sort (American flag sort). The elements are
+ * distributed by the most significant byte of their key with cycles of
+ * swaps, without a buffer, and every bucket is sorted by the next byte;
+ * bytes shared by a whole bucket are skipped and small buckets are
+ * finished by insertion sort. Not stable.
+ * @tparam RandomIt
+ * @tparam Projection Function from an element to its arithmetic key
+ * @param first
+ * @param last
+ * @param proj
+ * @time complexity O(N * bytes)
+ * @space complexity O(bytes) stack frames of 6 KiB
+ */
+template <class RandomIt, class Projection = std::identity>
+void msd_radix_sort(RandomIt first, RandomIt last, Projection proj = {})
+{
+    using key_type = decltype(custom::radix_key_of(proj, *first));
+
+    if (last - first <= 1)
+        return;
+
+    custom::msd_radix_sort(first, last, proj, static_cast<int>(sizeof(key_type) * CHAR_BIT) - 8);
+}
+
+#endif //! RADIX_SORT_H
@@ -12,10 +12,8 @@
 #ifndef SELECTION_SORT_H
 #define SELECTION_SORT_H
 
-#include <algorithm>  // std::min_element, std::iter_swap, std::is_sorted
-#include <cassert>    // assert
+#include <algorithm>  // std::min_element, std::iter_swap
 #include <functional> // std::less<>
-#include <iterator>   // distance, begin, end, next
 
 /**
  * @brief
@@ -23,21 +21,16 @@
  * @tparam FwdIt
  * @tparam Compare std::less<>
  * @param first
- * @param second
- * @param cpm
+ * @param last
+ * @param cmp
  * @time complexity O(N^2)
  * @space complexity O(1)
  */
 template <class FwdIt, class Compare = std::less<>>
-void selection_sort(FwdIt first, FwdIt second, Compare cmp = Compare{})
+void selection_sort(FwdIt first, FwdIt last, Compare cmp = Compare{})
 {
-    for (auto it{first}; it != last; ++i)
-    {
-        auto const selection_sort{std::min_element(it, last, cmp)};
-
-        std::iter_swap(selection, it);
-        assert(std::is_sorted(first, std::next(it), cmp));
-    }
+    for (auto it{first}; it != last; ++it)
+        std::iter_swap(std::min_element(it, last, cmp), it);
 }
 
 #endif //! SELECTION_SORT_H
\ No newline at end of file
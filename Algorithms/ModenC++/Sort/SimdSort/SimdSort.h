@@ -0,0 +1,572 @@
+/**
+ * @file SimdSort.h
+ * @author Carlos Salguero
+ * @brief Vectorized sort for int32_t, uint64_t and float keys, with AVX2
+ * and AVX-512 kernels picked at runtime
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SIMD_SORT_H
+#define SIMD_SORT_H
+
+#include <algorithm>   // std::copy(), std::fill(), std::min()
+#include <array>
+#include <bit>         // std::bit_ceil(), std::bit_width(), std::popcount()
+#include <cstddef>     // std::size_t
+#include <cstdint>     // std::int32_t, std::uint32_t, std::uint64_t
+#include <iterator>    // std::iterator_traits
+#include <limits>      // std::numeric_limits
+#include <memory>      // std::to_address()
+#include <type_traits> // std::is_same_v
+#include <utility>     // std::swap()
+
+#include "../QuickSort/QuickSort.h"
+
+// The kernels are compiled for their instruction set with GCC target
+// pragmas, so that the rest of the program does not need -mavx2 or
+// -mavx512f. Elsewhere only the scalar fallback is built.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define SIMD_SORT_X86 1
+#include <immintrin.h>
+#else
+#define SIMD_SORT_X86 0
+#endif
+
+/**
+ * @brief
+ * Instruction sets simd_sort() can run on, from the slowest to the fastest
+ */
+enum class SimdLevel
+{
+    scalar,
+    avx2,
+    avx512
+};
+
+namespace custom
+{
+    // Registers of the largest block the quick sort finishes with a
+    // sorting network inside the registers, instead of partitioning it
+    constexpr std::size_t SIMD_BLOCK_REGISTERS = 8;
+
+    /**
+     * @brief
+     * Permutation and lane selection of one step of a sorting network, in
+     * the forms the instruction sets want: 32-bit permutation indices (a
+     * 64-bit lane uses two of them), a vector mask with all bits set where
+     * the lane takes the larger value, and the same as a bit mask
+     * @tparam L Number of 32-bit lanes of the register
+     */
+    template <std::size_t L>
+    struct SimdShuffle
+    {
+        alignas(64) std::array<std::int32_t, L> index;
+        alignas(64) std::array<std::int32_t, L> blend;
+        std::uint32_t bits;
+    };
+
+    /**
+     * @brief
+     * Build a SimdShuffle from a function giving the partner of each lane
+     * and one telling whether the lane keeps the larger value
+     */
+    template <std::size_t W, std::size_t L, class Partner, class TakesMax>
+    constexpr SimdShuffle<L> simd_shuffle(Partner partner, TakesMax takes_max)
+    {
+        constexpr auto scale{L / W};
+        SimdShuffle<L> shuffle{};
+
+        for (std::size_t lane{}; lane < W; ++lane)
+        {
+            for (std::size_t part{}; part < scale; ++part)
+            {
+                shuffle.index[lane * scale + part] = static_cast<std::int32_t>(partner(lane) * scale + part);
+                shuffle.blend[lane * scale + part] = takes_max(lane) ? -1 : 0;
+            }
+
+            if (takes_max(lane))
+                shuffle.bits |= std::uint32_t{1} << lane;
+        }
+
+        return shuffle;
+    }
+
+    /**
+     * @brief
+     * Bitonic sorting network for the W lanes of a register: the steps that
+     * sort it, the ones that sort it when it is already bitonic, and the
+     * permutation that reverses it
+     * @tparam W Number of lanes
+     * @tparam L Number of 32-bit lanes
+     */
+    template <std::size_t W, std::size_t L>
+    struct SimdNetwork
+    {
+        static constexpr std::size_t LOG_W = std::bit_width(W) - 1;
+
+        std::array<SimdShuffle<L>, LOG_W *(LOG_W + 1) / 2> sort;
+        std::array<SimdShuffle<L>, LOG_W> merge;
+        SimdShuffle<L> reverse;
+
+        static constexpr SimdNetwork build()
+        {
+            SimdNetwork network{};
+            std::size_t step{};
+
+            // Lane i is compared with lane i ^ j and keeps the larger value
+            // in the upper lane of ascending blocks of size k, and in the
+            // lower lane of descending ones
+            for (std::size_t k{2}; k <= W; k *= 2)
+                for (std::size_t j{k / 2}; j > 0; j /= 2)
+                    network.sort[step++] = simd_shuffle<W, L>(
+                        [=](std::size_t i)
+                        { return i ^ j; },
+                        [=](std::size_t i)
+                        { return ((i & j) != 0) != ((i & k) != 0); });
+
+            step = 0;
+
+            for (std::size_t j{W / 2}; j > 0; j /= 2)
+                network.merge[step++] = simd_shuffle<W, L>(
+                    [=](std::size_t i)
+                    { return i ^ j; },
+                    [=](std::size_t i)
+                    { return (i & j) != 0; });
+
+            network.reverse = simd_shuffle<W, L>(
+                [](std::size_t i)
+                { return W - 1 - i; },
+                [](std::size_t)
+                { return false; });
+
+            return network;
+        }
+
+        static const SimdNetwork value;
+    };
+
+    template <std::size_t W, std::size_t L>
+    inline constexpr SimdNetwork<W, L> SimdNetwork<W, L>::value{SimdNetwork<W, L>::build()};
+
+    /**
+     * @brief
+     * For every mask of W lanes, the byte indices of the 32-bit lanes that
+     * move the selected lanes to the front, in order, and the others after
+     * them. Used to emulate a compressing store on AVX2.
+     */
+    template <std::size_t W>
+    constexpr std::array<std::uint64_t, (1u << W)> simd_compress_table()
+    {
+        constexpr auto scale{8 / W};
+        std::array<std::uint64_t, (1u << W)> table{};
+
+        for (std::size_t mask{}; mask < table.size(); ++mask)
+        {
+            std::size_t position{};
+
+            for (bool selected : {true, false})
+                for (std::size_t lane{}; lane < W; ++lane)
+                    if (((mask >> lane) & 1) == selected)
+                        for (std::size_t part{}; part < scale; ++part)
+                            table[mask] |= std::uint64_t{lane * scale + part} << (8 * position++);
+        }
+
+        return table;
+    }
+}
+
+#if SIMD_SORT_X86
+
+#pragma GCC push_options
+#pragma GCC target("avx2,popcnt")
+
+namespace custom::avx2
+{
+    constexpr auto COMPRESS8{simd_compress_table<8>()};
+    constexpr auto COMPRESS4{simd_compress_table<4>()};
+
+    inline __m256i compress_index(std::uint64_t entry)
+    {
+        return _mm256_cvtepu8_epi32(_mm_cvtsi64_si128(static_cast<long long>(entry)));
+    }
+
+    inline __m256i load_index(const std::array<std::int32_t, 8> &index)
+    {
+        return _mm256_load_si256(reinterpret_cast<const __m256i *>(index.data()));
+    }
+
+    struct Int32x8
+    {
+        using value_type = std::int32_t;
+        using reg = __m256i;
+
+        static constexpr std::size_t W = 8;
+        static constexpr std::size_t INDEX_LANES = 8;
+
+        static reg load(const value_type *p) { return _mm256_loadu_si256(reinterpret_cast<const reg *>(p)); }
+        static void store(value_type *p, reg v) { _mm256_storeu_si256(reinterpret_cast<reg *>(p), v); }
+        static reg set1(value_type value) { return _mm256_set1_epi32(value); }
+        static reg min(reg a, reg b) { return _mm256_min_epi32(a, b); }
+        static reg max(reg a, reg b) { return _mm256_max_epi32(a, b); }
+
+        static reg permute(reg v, const SimdShuffle<8> &shuffle)
+        {
+            return _mm256_permutevar8x32_epi32(v, load_index(shuffle.index));
+        }
+
+        static reg blend(reg a, reg b, const SimdShuffle<8> &shuffle)
+        {
+            return _mm256_blendv_epi8(a, b, load_index(shuffle.blend));
+        }
+
+        static std::uint32_t lt_mask(reg v, reg pivot)
+        {
+            return _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(pivot, v)));
+        }
+
+        static std::uint32_t le_mask(reg v, reg pivot)
+        {
+            return ~_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(v, pivot))) & 0xFF;
+        }
+
+        static void store_partitioned(value_type *left, value_type *right_end, reg v, std::uint32_t mask)
+        {
+            auto const packed{_mm256_permutevar8x32_epi32(v, compress_index(COMPRESS8[mask]))};
+
+            store(left, packed);
+            store(right_end - W, packed);
+        }
+    };
+
+    struct Float32x8
+    {
+        using value_type = float;
+        using reg = __m256;
+
+        static constexpr std::size_t W = 8;
+        static constexpr std::size_t INDEX_LANES = 8;
+
+        static reg load(const value_type *p) { return _mm256_loadu_ps(p); }
+        static void store(value_type *p, reg v) { _mm256_storeu_ps(p, v); }
+        static reg set1(value_type value) { return _mm256_set1_ps(value); }
+        static reg min(reg a, reg b) { return _mm256_min_ps(a, b); }
+        static reg max(reg a, reg b) { return _mm256_max_ps(a, b); }
+
+        static reg permute(reg v, const SimdShuffle<8> &shuffle)
+        {
+            return _mm256_permutevar8x32_ps(v, load_index(shuffle.index));
+        }
+
+        static reg blend(reg a, reg b, const SimdShuffle<8> &shuffle)
+        {
+            return _mm256_blendv_ps(a, b, _mm256_castsi256_ps(load_index(shuffle.blend)));
+        }
+
+        static std::uint32_t lt_mask(reg v, reg pivot)
+        {
+            return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_LT_OQ));
+        }
+
+        static std::uint32_t le_mask(reg v, reg pivot)
+        {
+            return _mm256_movemask_ps(_mm256_cmp_ps(v, pivot, _CMP_LE_OQ));
+        }
+
+        static void store_partitioned(value_type *left, value_type *right_end, reg v, std::uint32_t mask)
+        {
+            auto const packed{_mm256_permutevar8x32_ps(v, compress_index(COMPRESS8[mask]))};
+
+            store(left, packed);
+            store(right_end - W, packed);
+        }
+    };
+
+    struct UInt64x4
+    {
+        using value_type = std::uint64_t;
+        using reg = __m256i;
+
+        static constexpr std::size_t W = 4;
+        static constexpr std::size_t INDEX_LANES = 8;
+
+        static reg load(const value_type *p) { return _mm256_loadu_si256(reinterpret_cast<const reg *>(p)); }
+        static void store(value_type *p, reg v) { _mm256_storeu_si256(reinterpret_cast<reg *>(p), v); }
+        static reg set1(value_type value) { return _mm256_set1_epi64x(static_cast<long long>(value)); }
+
+        // AVX2 only compares signed 64-bit lanes, flipping the sign bit
+        // turns that into an unsigned comparison
+        static reg greater(reg a, reg b)
+        {
+            auto const sign{_mm256_set1_epi64x(std::numeric_limits<long long>::min())};
+
+            return _mm256_cmpgt_epi64(_mm256_xor_si256(a, sign), _mm256_xor_si256(b, sign));
+        }
+
+        static reg min(reg a, reg b) { return _mm256_blendv_epi8(a, b, greater(a, b)); }
+        static reg max(reg a, reg b) { return _mm256_blendv_epi8(b, a, greater(a, b)); }
+
+        static reg permute(reg v, const SimdShuffle<8> &shuffle)
+        {
+            return _mm256_permutevar8x32_epi32(v, load_index(shuffle.index));
+        }
+
+        static reg blend(reg a, reg b, const SimdShuffle<8> &shuffle)
+        {
+            return _mm256_blendv_epi8(a, b, load_index(shuffle.blend));
+        }
+
+        static std::uint32_t lt_mask(reg v, reg pivot)
+        {
+            return _mm256_movemask_pd(_mm256_castsi256_pd(greater(pivot, v)));
+        }
+
+        static std::uint32_t le_mask(reg v, reg pivot)
+        {
+            return ~_mm256_movemask_pd(_mm256_castsi256_pd(greater(v, pivot))) & 0xF;
+        }
+
+        static void store_partitioned(value_type *left, value_type *right_end, reg v, std::uint32_t mask)
+        {
+            auto const packed{_mm256_permutevar8x32_epi32(v, compress_index(COMPRESS4[mask]))};
+
+            store(left, packed);
+            store(right_end - W, packed);
+        }
+    };
+
+#include "SimdSortKernels.h"
+
+    inline void simd_sort(std::int32_t *data, std::size_t n)
+    {
+        simd_quick_sort<Int32x8>(data, n, 2 * std::bit_width(n));
+    }
+
+    inline void simd_sort(float *data, std::size_t n)
+    {
+        simd_quick_sort<Float32x8>(data, n, 2 * std::bit_width(n));
+    }
+
+    inline void simd_sort(std::uint64_t *data, std::size_t n)
+    {
+        simd_quick_sort<UInt64x4>(data, n, 2 * std::bit_width(n));
+    }
+}
+
+#pragma GCC pop_options
+
+#pragma GCC push_options
+#pragma GCC target("avx512f,popcnt")
+
+// GCC 12 flags the deliberately undefined registers the AVX-512 intrinsics
+// start from as uninitialized
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wuninitialized"
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+
+namespace custom::avx512
+{
+    inline __m512i load_index(const std::array<std::int32_t, 16> &index)
+    {
+        return _mm512_load_si512(index.data());
+    }
+
+    struct Int32x16
+    {
+        using value_type = std::int32_t;
+        using reg = __m512i;
+
+        static constexpr std::size_t W = 16;
+        static constexpr std::size_t INDEX_LANES = 16;
+
+        static reg load(const value_type *p) { return _mm512_loadu_si512(p); }
+        static void store(value_type *p, reg v) { _mm512_storeu_si512(p, v); }
+        static reg set1(value_type value) { return _mm512_set1_epi32(value); }
+        static reg min(reg a, reg b) { return _mm512_min_epi32(a, b); }
+        static reg max(reg a, reg b) { return _mm512_max_epi32(a, b); }
+
+        static reg permute(reg v, const SimdShuffle<16> &shuffle)
+        {
+            return _mm512_permutexvar_epi32(load_index(shuffle.index), v);
+        }
+
+        static reg blend(reg a, reg b, const SimdShuffle<16> &shuffle)
+        {
+            return _mm512_mask_blend_epi32(static_cast<__mmask16>(shuffle.bits), a, b);
+        }
+
+        static std::uint32_t lt_mask(reg v, reg pivot) { return _mm512_cmplt_epi32_mask(v, pivot); }
+        static std::uint32_t le_mask(reg v, reg pivot) { return _mm512_cmple_epi32_mask(v, pivot); }
+
+        static void store_partitioned(value_type *left, value_type *right_end, reg v, std::uint32_t mask)
+        {
+            auto const below{static_cast<std::size_t>(std::popcount(mask))};
+
+            _mm512_mask_compressstoreu_epi32(left, static_cast<__mmask16>(mask), v);
+            _mm512_mask_compressstoreu_epi32(right_end - (W - below), static_cast<__mmask16>(~mask), v);
+        }
+    };
+
+    struct Float32x16
+    {
+        using value_type = float;
+        using reg = __m512;
+
+        static constexpr std::size_t W = 16;
+        static constexpr std::size_t INDEX_LANES = 16;
+
+        static reg load(const value_type *p) { return _mm512_loadu_ps(p); }
+        static void store(value_type *p, reg v) { _mm512_storeu_ps(p, v); }
+        static reg set1(value_type value) { return _mm512_set1_ps(value); }
+        static reg min(reg a, reg b) { return _mm512_min_ps(a, b); }
+        static reg max(reg a, reg b) { return _mm512_max_ps(a, b); }
+
+        static reg permute(reg v, const SimdShuffle<16> &shuffle)
+        {
+            return _mm512_permutexvar_ps(load_index(shuffle.index), v);
+        }
+
+        static reg blend(reg a, reg b, const SimdShuffle<16> &shuffle)
+        {
+            return _mm512_mask_blend_ps(static_cast<__mmask16>(shuffle.bits), a, b);
+        }
+
+        static std::uint32_t lt_mask(reg v, reg pivot) { return _mm512_cmp_ps_mask(v, pivot, _CMP_LT_OQ); }
+        static std::uint32_t le_mask(reg v, reg pivot) { return _mm512_cmp_ps_mask(v, pivot, _CMP_LE_OQ); }
+
+        static void store_partitioned(value_type *left, value_type *right_end, reg v, std::uint32_t mask)
+        {
+            auto const below{static_cast<std::size_t>(std::popcount(mask))};
+
+            _mm512_mask_compressstoreu_ps(left, static_cast<__mmask16>(mask), v);
+            _mm512_mask_compressstoreu_ps(right_end - (W - below), static_cast<__mmask16>(~mask), v);
+        }
+    };
+
+    struct UInt64x8
+    {
+        using value_type = std::uint64_t;
+        using reg = __m512i;
+
+        static constexpr std::size_t W = 8;
+        static constexpr std::size_t INDEX_LANES = 16;
+
+        static reg load(const value_type *p) { return _mm512_loadu_si512(p); }
+        static void store(value_type *p, reg v) { _mm512_storeu_si512(p, v); }
+        static reg set1(value_type value) { return _mm512_set1_epi64(static_cast<long long>(value)); }
+        static reg min(reg a, reg b) { return _mm512_min_epu64(a, b); }
+        static reg max(reg a, reg b) { return _mm512_max_epu64(a, b); }
+
+        static reg permute(reg v, const SimdShuffle<16> &shuffle)
+        {
+            return _mm512_permutexvar_epi32(load_index(shuffle.index), v);
+        }
+
+        static reg blend(reg a, reg b, const SimdShuffle<16> &shuffle)
+        {
+            return _mm512_mask_blend_epi64(static_cast<__mmask8>(shuffle.bits), a, b);
+        }
+
+        static std::uint32_t lt_mask(reg v, reg pivot) { return _mm512_cmplt_epu64_mask(v, pivot); }
+        static std::uint32_t le_mask(reg v, reg pivot) { return _mm512_cmple_epu64_mask(v, pivot); }
+
+        static void store_partitioned(value_type *left, value_type *right_end, reg v, std::uint32_t mask)
+        {
+            auto const below{static_cast<std::size_t>(std::popcount(mask))};
+
+            _mm512_mask_compressstoreu_epi64(left, static_cast<__mmask8>(mask), v);
+            _mm512_mask_compressstoreu_epi64(right_end - (W - below), static_cast<__mmask8>(~mask), v);
+        }
+    };
+
+#include "SimdSortKernels.h"
+
+    inline void simd_sort(std::int32_t *data, std::size_t n)
+    {
+        simd_quick_sort<Int32x16>(data, n, 2 * std::bit_width(n));
+    }
+
+    inline void simd_sort(float *data, std::size_t n)
+    {
+        simd_quick_sort<Float32x16>(data, n, 2 * std::bit_width(n));
+    }
+
+    inline void simd_sort(std::uint64_t *data, std::size_t n)
+    {
+        simd_quick_sort<UInt64x8>(data, n, 2 * std::bit_width(n));
+    }
+}
+
+#pragma GCC diagnostic pop
+#pragma GCC pop_options
+
+#endif // SIMD_SORT_X86
+
+/**
+ * @brief
+ * Fastest instruction set of the running CPU that simd_sort() has kernels
+ * for, detected once
+ * @return SimdLevel Instruction set
+ */
+inline SimdLevel simd_supported_level()
+{
+#if SIMD_SORT_X86
+    static SimdLevel const level{__builtin_cpu_supports("avx512f")
+                                     ? SimdLevel::avx512
+                                 : __builtin_cpu_supports("avx2") ? SimdLevel::avx2
+                                                                  : SimdLevel::scalar};
+
+    return level;
+#else
+    return SimdLevel::scalar;
+#endif
+}
+
+/**
+ * @brief
+ * Sort int32_t, uint64_t or float keys with a vectorized quick sort:
+ * partitions go a register at a time, writing the lanes below the pivot to
+ * the left and the others to the right in one step, and blocks of up to 8
+ * registers are finished by a bitonic sorting network inside the
+ * registers. Runs of equal keys are split off in one pass, and a range
+ * that keeps partitioning badly is handed to quick_sort(). The kernels are
+ * picked at runtime; without AVX2, or outside GCC on x86-64, it is
+ * quick_sort(). NaNs are not supported.
+ * @tparam ContiguousIt Iterator to contiguous int32_t, uint64_t or float
+ * @param first
+ * @param last
+ * @param level Fastest instruction set to use, lowered to what the CPU has
+ * @time complexity O(N log(N))
+ * @space complexity O(log(N))
+ */
+template <class ContiguousIt>
+void simd_sort(ContiguousIt first, ContiguousIt last, SimdLevel level = simd_supported_level())
+{
+    using value_type = typename std::iterator_traits<ContiguousIt>::value_type;
+
+    static_assert(std::is_same_v<value_type, std::int32_t> || std::is_same_v<value_type, std::uint64_t> ||
+                      std::is_same_v<value_type, float>,
+                  "simd_sort() sorts int32_t, uint64_t and float keys");
+
+    auto const N{static_cast<std::size_t>(last - first)};
+
+    if (N <= 1)
+        return;
+
+    level = std::min(level, simd_supported_level());
+
+#if SIMD_SORT_X86
+    if (level == SimdLevel::avx512)
+        return custom::avx512::simd_sort(std::to_address(first), N);
+
+    if (level == SimdLevel::avx2)
+        return custom::avx2::simd_sort(std::to_address(first), N);
+#endif
+
+    quick_sort(first, last);
+}
+
+#endif //! SIMD_SORT_H
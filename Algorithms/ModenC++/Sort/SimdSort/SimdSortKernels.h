@@ -0,0 +1,324 @@
+/**
+ * @file SimdSortKernels.h
+ * @author Carlos Salguero
+ * @brief Vectorized quick sort and threshold filter kernels, generic over
+ * the vector type
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+// No include guard on purpose: SimdSort.h includes this file once per
+// instruction set, inside the namespace of that instruction set and with
+// its target options in effect, so the kernels below are compiled once for
+// each of them. A vector type V provides:
+//   value_type, reg, W (lanes) and INDEX_LANES (32-bit permutation lanes)
+//   load(), store(), set1(), min(), max()
+//   permute(reg, shuffle) and blend(a, b, shuffle), b where the shuffle says
+//   lt_mask() and le_mask(), the lanes below (or not above) a pivot
+//   store_partitioned(left, right_end, reg, mask)
+
+/**
+ * @brief
+ * One compare-exchange stage of a bitonic network inside a register: every
+ * lane is compared with its partner and keeps the smaller or the larger
+ * value
+ */
+template <class V>
+typename V::reg simd_network_stage(typename V::reg v, const SimdShuffle<V::INDEX_LANES> &stage)
+{
+    auto const partner{V::permute(v, stage)};
+
+    return V::blend(V::min(v, partner), V::max(v, partner), stage);
+}
+
+/**
+ * @brief
+ * Sort the lanes of one register with a bitonic sorting network
+ * @time complexity O(log(W)^2) instructions
+ */
+template <class V>
+typename V::reg simd_sort_register(typename V::reg v)
+{
+    for (auto const &stage : SimdNetwork<V::W, V::INDEX_LANES>::value.sort)
+        v = simd_network_stage<V>(v, stage);
+
+    return v;
+}
+
+/**
+ * @brief
+ * Sort the lanes of a register that hold a bitonic sequence
+ * @time complexity O(log(W)) instructions
+ */
+template <class V>
+typename V::reg simd_merge_register(typename V::reg v)
+{
+    for (auto const &stage : SimdNetwork<V::W, V::INDEX_LANES>::value.merge)
+        v = simd_network_stage<V>(v, stage);
+
+    return v;
+}
+
+/**
+ * @brief
+ * Sort count registers that together hold a bitonic sequence, the lanes
+ * of register i being elements i * W to (i + 1) * W - 1
+ */
+template <class V>
+void simd_merge_registers(typename V::reg *registers, std::size_t count)
+{
+    if (count == 1)
+    {
+        registers[0] = simd_merge_register<V>(registers[0]);
+        return;
+    }
+
+    auto const half{count / 2};
+
+    for (std::size_t i{}; i < half; ++i)
+    {
+        auto const low{V::min(registers[i], registers[i + half])};
+        registers[i + half] = V::max(registers[i], registers[i + half]);
+        registers[i] = low;
+    }
+
+    simd_merge_registers<V>(registers, half);
+    simd_merge_registers<V>(registers + half, half);
+}
+
+/**
+ * @brief
+ * Sort the elements of count registers, count being a power of two: both
+ * halves are sorted, the second one is reversed so that the whole is
+ * bitonic, and the result is merged
+ */
+template <class V>
+void simd_sort_registers(typename V::reg *registers, std::size_t count)
+{
+    if (count == 1)
+    {
+        registers[0] = simd_sort_register<V>(registers[0]);
+        return;
+    }
+
+    auto const half{count / 2};
+
+    simd_sort_registers<V>(registers, half);
+    simd_sort_registers<V>(registers + half, half);
+
+    for (std::size_t i{}; i < half / 2; ++i)
+        std::swap(registers[half + i], registers[count - 1 - i]);
+
+    for (auto i{half}; i < count; ++i)
+        registers[i] = V::permute(registers[i], SimdNetwork<V::W, V::INDEX_LANES>::value.reverse);
+
+    simd_merge_registers<V>(registers, count);
+}
+
+/**
+ * @brief
+ * Sort a block of at most SIMD_BLOCK_REGISTERS * W elements in registers,
+ * padding it with the largest value up to a power of two of registers
+ */
+template <class V>
+void simd_sort_block(typename V::value_type *data, std::size_t n)
+{
+    using T = typename V::value_type;
+
+    constexpr auto padding{std::numeric_limits<T>::has_infinity ? std::numeric_limits<T>::infinity()
+                                                                : std::numeric_limits<T>::max()};
+
+    alignas(64) T buffer[SIMD_BLOCK_REGISTERS * V::W];
+    typename V::reg registers[SIMD_BLOCK_REGISTERS];
+
+    auto const count{std::bit_ceil((n + V::W - 1) / V::W)};
+
+    std::copy(data, data + n, buffer);
+    std::fill(buffer + n, buffer + count * V::W, padding);
+
+    for (std::size_t i{}; i < count; ++i)
+        registers[i] = V::load(buffer + i * V::W);
+
+    simd_sort_registers<V>(registers, count);
+
+    for (std::size_t i{}; i < count; ++i)
+        V::store(buffer + i * V::W, registers[i]);
+
+    std::copy(buffer, buffer + n, data);
+}
+
+/**
+ * @brief
+ * Partition data around a pivot, a register at a time. The first and the
+ * last register are set aside, which leaves W free slots at each end;
+ * every register read is written to both ends at once, its lanes below
+ * the pivot at the left and the others at the right, and the next one is
+ * read from the end with less free room, so neither end ever runs out.
+ * The few elements left at the end are placed one by one.
+ * @param data
+ * @param n Number of elements, at least 2 * W
+ * @param pivot
+ * @param strict Whether the left part gets the elements below the pivot
+ * (true) or the ones not above it (false)
+ * @return std::size_t Size of the left part
+ * @time complexity O(N)
+ * @space complexity O(W)
+ */
+template <class V>
+std::size_t simd_partition(typename V::value_type *data, std::size_t n,
+                           typename V::value_type pivot, bool strict)
+{
+    using T = typename V::value_type;
+
+    auto const pivots{V::set1(pivot)};
+    auto const first{V::load(data)};
+    auto const last{V::load(data + n - V::W)};
+
+    std::size_t left_store{}, right_store{n};
+    std::size_t left_read{V::W}, right_read{n - V::W};
+
+    while (right_read - left_read >= V::W)
+    {
+        typename V::reg v;
+
+        if (left_read - left_store <= right_store - right_read)
+        {
+            v = V::load(data + left_read);
+            left_read += V::W;
+        }
+        else
+        {
+            right_read -= V::W;
+            v = V::load(data + right_read);
+        }
+
+        auto const mask{strict ? V::lt_mask(v, pivots) : V::le_mask(v, pivots)};
+        auto const below{static_cast<std::size_t>(std::popcount(mask))};
+
+        V::store_partitioned(data + left_store, data + right_store, v, mask);
+
+        left_store += below;
+        right_store -= V::W - below;
+    }
+
+    alignas(64) T rest[3 * V::W];
+    auto const unread{right_read - left_read};
+
+    std::copy(data + left_read, data + right_read, rest);
+    V::store(rest + unread, first);
+    V::store(rest + unread + V::W, last);
+
+    for (std::size_t i{}; i < unread + 2 * V::W; ++i)
+    {
+        if (strict ? rest[i] < pivot : !(pivot < rest[i]))
+            data[left_store++] = rest[i];
+        else
+            data[--right_store] = rest[i];
+    }
+
+    return left_store;
+}
+
+/**
+ * @brief
+ * Quick sort with simd_partition() and simd_sort_block(). It recurses
+ * into the smaller part and loops on the larger one. A pivot that is the
+ * minimum leaves the left part empty, so its copies are split off with a
+ * second partition instead; once the depth budget runs out, the range is
+ * handed to quick_sort().
+ * @param data
+ * @param n
+ * @param depth Partitions left before falling back
+ */
+template <class V>
+void simd_quick_sort(typename V::value_type *data, std::size_t n, int depth)
+{
+    while (n > SIMD_BLOCK_REGISTERS * V::W)
+    {
+        if (depth-- == 0)
+        {
+            ::quick_sort(data, data + n);
+            return;
+        }
+
+        auto a{data[n / 4]}, b{data[n / 2]}, c{data[n - n / 4]};
+
+        if (b < a)
+            std::swap(a, b);
+
+        if (c < b)
+            b = a < c ? c : a;
+
+        auto const pivot{b};
+        auto split{simd_partition<V>(data, n, pivot, true)};
+
+        if (split == 0)
+        {
+            // Everything is at least the pivot: the elements equal to it
+            // are done
+            split = simd_partition<V>(data, n, pivot, false);
+            data += split;
+            n -= split;
+            continue;
+        }
+
+        if (split < n - split)
+        {
+            simd_quick_sort<V>(data, split, depth);
+            data += split;
+            n -= split;
+        }
+        else
+        {
+            simd_quick_sort<V>(data + split, n - split, depth);
+            n = split;
+        }
+    }
+
+    if (n > 1)
+        simd_sort_block<V>(data, n);
+}
+
+/**
+ * @brief
+ * Scan data a register at a time for the elements that come before a
+ * threshold: below it, or above it when Greater. Most registers of a long
+ * scan hold none and cost one compare and one branch; every lane of the
+ * others is handed to accept, which returns the threshold to go on with.
+ * Used by TopK, whose threshold only tightens.
+ * @param data
+ * @param n
+ * @param threshold
+ * @param accept Function called with the values that pass
+ * @return std::size_t Number of elements scanned, a multiple of W
+ * @time complexity O(N)
+ * @space complexity O(1)
+ */
+template <class V, bool Greater, class Accept>
+std::size_t simd_threshold_filter(const typename V::value_type *data, std::size_t n,
+                                  typename V::value_type threshold, Accept &accept)
+{
+    constexpr std::uint32_t LANES{static_cast<std::uint32_t>((std::uint64_t{1} << V::W) - 1)};
+
+    auto pivot{V::set1(threshold)};
+    std::size_t i{};
+
+    for (; i + V::W <= n; i += V::W)
+    {
+        auto const v{V::load(data + i)};
+        auto mask{Greater ? ~V::le_mask(v, pivot) & LANES : V::lt_mask(v, pivot)};
+
+        if (mask == 0)
+            continue;
+
+        for (; mask != 0; mask &= mask - 1)
+            threshold = accept(data[i + static_cast<std::size_t>(std::countr_zero(mask))]);
+
+        pivot = V::set1(threshold);
+    }
+
+    return i;
+}
@@ -0,0 +1,270 @@
+/**
+ * @file SmallSort.h
+ * @author Carlos Salguero
+ * @brief Sorts for the small ranges at the leaves of larger sorts: sorting
+ * networks, unguarded insertion sort and binary insertion sort
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SMALL_SORT_H
+#define SMALL_SORT_H
+
+#include <algorithm>   // std::min(), std::upper_bound(), std::move_backward()
+#include <array>
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::uint8_t
+#include <functional>  // std::less<>
+#include <type_traits> // std::is_arithmetic_v, std::is_pointer_v
+#include <utility>     // std::index_sequence, std::move(), std::swap()
+
+#include "../InsertionSort/InsertionSort.h"
+
+namespace custom
+{
+    // Largest range sorted by a sorting network
+    constexpr std::size_t SMALL_SORT_NETWORK_LIMIT = 16;
+
+    struct Comparator
+    {
+        std::uint8_t low;
+        std::uint8_t high;
+    };
+
+    /**
+     * @brief
+     * Comparators of Batcher's odd-even merge sort for N elements, in
+     * order. The network is the one of the next power of two without the
+     * comparators that reach past N, which is still a sorting network
+     * since the missing elements would be larger than all the others.
+     * @tparam Visit Type of the function called with every comparator
+     * @param N Number of elements
+     * @param visit Function called with the two positions of a comparator
+     */
+    template <class Visit>
+    constexpr void odd_even_merge_network(std::size_t N, Visit visit)
+    {
+        for (std::size_t p{1}; p < N; p += p)
+            for (std::size_t k{p}; k >= 1; k /= 2)
+                for (std::size_t j{k % p}; j + k < N; j += 2 * k)
+                    for (std::size_t i{}; i < k && i + j + k < N; ++i)
+                        if ((i + j) / (2 * p) == (i + j + k) / (2 * p))
+                            visit(i + j, i + j + k);
+    }
+
+    /**
+     * @brief
+     * Sorting network for N elements, built at compile time
+     * @tparam N Number of elements
+     */
+    template <std::size_t N>
+    constexpr auto sorting_network{[]
+                                   {
+                                       constexpr auto SIZE{[]
+                                                           {
+                                                               std::size_t size{};
+                                                               odd_even_merge_network(N, [&](std::size_t, std::size_t)
+                                                                                      { ++size; });
+                                                               return size;
+                                                           }()};
+
+                                       std::array<Comparator, SIZE> network{};
+                                       std::size_t size{};
+
+                                       odd_even_merge_network(N, [&](std::size_t low, std::size_t high)
+                                                              { network[size++] = {static_cast<std::uint8_t>(low),
+                                                                                   static_cast<std::uint8_t>(high)}; });
+
+                                       return network;
+                                   }()};
+
+    /**
+     * @brief
+     * Put the smaller of a and b in a. Arithmetic values and pointers are
+     * selected without a branch, which the compiler turns into conditional
+     * moves; a network has no data-dependent branches left to mispredict.
+     * @tparam T Type of the values
+     * @tparam Compare
+     * @param a
+     * @param b
+     * @param cmp
+     */
+    template <class T, class Compare>
+    inline void compare_exchange(T &a, T &b, Compare &cmp)
+    {
+        if constexpr (std::is_arithmetic_v<T> || std::is_pointer_v<T>)
+        {
+            auto const x{a};
+            auto const y{b};
+            bool const swap{static_cast<bool>(cmp(y, x))};
+
+            a = swap ? y : x;
+            b = swap ? x : y;
+        }
+        else if (cmp(b, a))
+        {
+            using std::swap;
+            swap(a, b);
+        }
+    }
+
+    /**
+     * @brief
+     * Sort the N elements at first with the network for N, unrolled at
+     * compile time
+     * @tparam N Number of elements
+     * @tparam RandomIt
+     * @tparam Compare
+     * @param first
+     * @param cmp
+     */
+    template <std::size_t N, class RandomIt, class Compare>
+    void network_sort(RandomIt first, Compare &cmp)
+    {
+        constexpr auto &network{sorting_network<N>};
+
+        [&]<std::size_t... I>(std::index_sequence<I...>)
+        {
+            (compare_exchange(first[network[I].low], first[network[I].high], cmp), ...);
+        }(std::make_index_sequence<network.size()>{});
+    }
+
+    /**
+     * @brief
+     * Table of network_sort() by size, so that the size of a range picks
+     * its fully unrolled network with a single indirect call
+     */
+    template <class RandomIt, class Compare, std::size_t... N>
+    constexpr auto network_table(std::index_sequence<N...>)
+    {
+        return std::array<void (*)(RandomIt, Compare &), sizeof...(N)>{&network_sort<N, RandomIt, Compare>...};
+    }
+}
+
+/**
+ * @brief
+ * Sort exactly N elements with a sorting network, a fixed sequence of
+ * compare-exchanges without loops. Not stable.
+ * @tparam N Number of elements, known at compile time
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first Beginning of the N elements
+ * @param cmp
+ * @time complexity O(N log(N)^2) comparisons
+ * @space complexity O(1)
+ */
+template <std::size_t N, class RandomIt, class Compare = std::less<>>
+void network_sort(RandomIt first, Compare cmp = Compare{})
+{
+    custom::network_sort<N>(first, cmp);
+}
+
+/**
+ * @brief
+ * Sort a small range: up to SMALL_SORT_NETWORK_LIMIT elements go through
+ * the sorting network for their size, larger ranges through insertion
+ * sort. Not stable.
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first
+ * @param last
+ * @param cmp
+ * @time complexity O(N^2)
+ * @space complexity O(1)
+ */
+template <class RandomIt, class Compare = std::less<>>
+void small_sort(RandomIt first, RandomIt last, Compare cmp = Compare{})
+{
+    static constexpr auto networks{custom::network_table<RandomIt, Compare>(
+        std::make_index_sequence<custom::SMALL_SORT_NETWORK_LIMIT + 1>{})};
+
+    auto const N{static_cast<std::size_t>(last - first)};
+
+    if (N <= custom::SMALL_SORT_NETWORK_LIMIT)
+        networks[N](first, cmp);
+    else
+        insertion_sort(first, last, cmp);
+}
+
+/**
+ * @brief
+ * Stable insertion sort without the bounds check of the inner loop. The
+ * element before first has to be no greater than any element of the
+ * range, which holds for every partition but the leftmost one in
+ * quicksort, and stops the shifting instead.
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first Beginning of the range, preceded by a sentinel
+ * @param last
+ * @param cmp
+ * @time complexity O(N^2), O(N) on sorted input
+ * @space complexity O(1)
+ */
+template <class RandomIt, class Compare = std::less<>>
+void unguarded_insertion_sort(RandomIt first, RandomIt last, Compare cmp = Compare{})
+{
+    if (first == last)
+        return;
+
+    for (auto it{first + 1}; it != last; ++it)
+    {
+        auto value{std::move(*it)};
+        auto hole{it};
+
+        for (; cmp(value, *(hole - 1)); --hole)
+            *hole = std::move(*(hole - 1));
+
+        *hole = std::move(value);
+    }
+}
+
+/**
+ * @brief
+ * Stable insertion sort that finds the place of every element with a
+ * binary search, for comparisons that cost more than moving the elements.
+ * The search gallops backwards from the end of the sorted prefix first,
+ * comparing with the elements 1, 2, 4, ... places back, so an element
+ * close to its place costs a few comparisons instead of log2 of the
+ * prefix, and one already in place costs a single comparison.
+ * @tparam RandomIt
+ * @tparam Compare
+ * @param first
+ * @param last
+ * @param cmp
+ * @time complexity O(N log(N)) comparisons, O(N^2) moves
+ * @space complexity O(1)
+ */
+template <class RandomIt, class Compare = std::less<>>
+void binary_insertion_sort(RandomIt first, RandomIt last, Compare cmp = Compare{})
+{
+    if (first == last)
+        return;
+
+    for (auto it{first + 1}; it != last; ++it)
+    {
+        if (!cmp(*it, *(it - 1)))
+            continue;
+
+        // *(it - 1) is greater, the place is in [it - offset, it - step)
+        std::ptrdiff_t step{1};
+        std::ptrdiff_t offset{2};
+
+        while (offset <= it - first && cmp(*it, *(it - offset)))
+        {
+            step = offset;
+            offset *= 2;
+        }
+
+        auto const low{it - std::min(offset, static_cast<std::ptrdiff_t>(it - first))};
+        auto const place{std::upper_bound(low, it - step, *it, cmp)};
+
+        auto value{std::move(*it)};
+        std::move_backward(place, it, it + 1);
+        *place = std::move(value);
+    }
+}
+
+#endif //! SMALL_SORT_H
@@ -0,0 +1,156 @@
+/**
+ * @file AggregateStackBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief MinStack and a sum AggregateStack against a RingStack that scans
+ * for the aggregate, plus the allocations made by a reserved stack
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Stack/RingStack.cpp"
+#include "../DataStructures/LinearDataStructures/Stack/AggregateStack.cpp"
+
+namespace
+{
+    std::size_t allocation_count{};
+
+    constexpr std::size_t n{4'000'000};
+
+    /**
+     * @brief
+     * Random pushes and pops around a given depth, reading the aggregate
+     * after every operation, like an undo log that shows its running total
+     * @return double Elapsed milliseconds
+     */
+    template <class Push, class Pop, class Query>
+    double walk(const std::vector<std::uint32_t> &values, std::size_t depth,
+                Push push, Pop pop, Query query)
+    {
+        return bench::time_ms([&]
+                              {
+            std::uint64_t checksum{};
+            std::size_t size{};
+
+            for (auto const value : values)
+            {
+                // Pop with a higher chance the deeper the stack is
+                if (size > 0 && value % (2 * depth) < size)
+                {
+                    pop();
+                    --size;
+                }
+                else
+                {
+                    push(value);
+                    ++size;
+                }
+
+                if (size > 0)
+                    checksum += query();
+            }
+
+            bench::do_not_optimize(checksum); });
+    }
+}
+
+// Count every heap allocation of the process
+void *operator new(std::size_t bytes)
+{
+    ++allocation_count;
+
+    if (auto *pointer = std::malloc(bytes))
+        return pointer;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+
+int main()
+{
+    std::vector<std::uint32_t> values(n);
+    bench::Random random;
+
+    for (auto &value : values)
+        value = static_cast<std::uint32_t>(random.next());
+
+    std::cout << n << " random pushes and pops, aggregate read after each one\n";
+
+    for (std::size_t depth : {16u, 64u, 512u})
+    {
+        auto const suffix{" (depth ~" + std::to_string(depth) + ")"};
+
+        std::cout << "\n";
+
+        {
+            RingStack<std::uint32_t> stack;
+            std::vector<std::uint32_t> mirror;
+
+            // RingStack has no index, so the scan runs over a mirror of it
+            bench::report("RingStack + scan for min" + suffix,
+                          walk(values, depth, [&](std::uint32_t value)
+                               {
+                                   stack.push(value);
+                                   mirror.push_back(value); },
+                               [&]
+                               {
+                                   stack.pop();
+                                   mirror.pop_back(); },
+                               [&]
+                               { return *std::min_element(mirror.begin(), mirror.end()); }),
+                          n);
+        }
+
+        {
+            MinStack<std::uint32_t> stack;
+
+            bench::report("MinStack" + suffix,
+                          walk(values, depth, [&](std::uint32_t value)
+                               { stack.push(value); },
+                               [&]
+                               { stack.pop(); },
+                               [&]
+                               { return *stack.query(); }),
+                          n);
+        }
+
+        {
+            AggregateStack<std::uint64_t> stack;
+
+            bench::report("AggregateStack sum" + suffix,
+                          walk(values, depth, [&](std::uint32_t value)
+                               { stack.push(value); },
+                               [&]
+                               { stack.pop(); },
+                               [&]
+                               { return *stack.query(); }),
+                          n);
+        }
+    }
+
+    MinStack<std::uint32_t> stack{2'048};
+    auto const before{allocation_count};
+
+    walk(values, 512, [&](std::uint32_t value)
+         { stack.push(value); },
+         [&]
+         { stack.pop(); },
+         [&]
+         { return *stack.query(); });
+
+    std::cout << "\nallocations by a MinStack reserved for 2048: "
+              << allocation_count - before << "\n";
+}
@@ -0,0 +1,95 @@
+/**
+ * @file Benchmark.h
+ * @author Carlos Salguero
+ * @brief Small timing helpers shared by the benchmark drivers
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace bench
+{
+    /**
+     * @brief
+     * Keep the optimizer from discarding a computed value
+     * @tparam T Type of the value
+     * @param value Value that must be considered used
+     */
+    template <class T>
+    inline void do_not_optimize(const T &value)
+    {
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    /**
+     * @brief
+     * Run a callable once and measure its wall time
+     * @tparam Function Callable with no arguments
+     * @param function Work to be measured
+     * @return double Elapsed time in milliseconds
+     */
+    template <class Function>
+    double time_ms(Function &&function)
+    {
+        auto const start{std::chrono::steady_clock::now()};
+        function();
+        auto const stop{std::chrono::steady_clock::now()};
+
+        return std::chrono::duration<double, std::milli>(stop - start).count();
+    }
+
+    /**
+     * @brief
+     * Deterministic splitmix64 generator, so every run sees the same input
+     */
+    class Random
+    {
+    public:
+        explicit Random(std::uint64_t seed = 42) : m_state{seed} {}
+
+        std::uint64_t next()
+        {
+            auto z{m_state += 0x9E3779B97F4A7C15ULL};
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+
+            return z ^ (z >> 31);
+        }
+
+        std::uint64_t below(std::uint64_t bound) { return next() % bound; }
+
+    private:
+        std::uint64_t m_state;
+    };
+
+    /**
+     * @brief
+     * Print one aligned result row: label, time and derived throughput
+     * @param label Name of the measured case
+     * @param ms Elapsed milliseconds
+     * @param operations Number of operations done in that time
+     */
+    inline void report(const std::string &label, double ms,
+                       std::uint64_t operations)
+    {
+        std::cout << std::left << std::setw(44) << label << std::right
+                  << std::setw(12) << std::fixed << std::setprecision(3)
+                  << ms << " ms" << std::setw(14) << std::setprecision(2)
+                  << (ms > 0 ? operations / (ms * 1e3) : 0.0)
+                  << " Mops/s\n";
+    }
+}
+
+#endif //! BENCHMARK_H
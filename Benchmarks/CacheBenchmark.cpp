@@ -0,0 +1,144 @@
+/**
+ * @file CacheBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief LRUCache and LFUCache replaying a Zipfian request trace, with the
+ * capacity counted in entries and in bytes
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Cache/LRUCache.cpp"
+#include "../DataStructures/LinearDataStructures/Cache/LFUCache.cpp"
+
+namespace
+{
+    /**
+     * @brief
+     * Values are object sizes, and an entry weighs its object size
+     */
+    struct ByteWeight
+    {
+        std::size_t operator()(std::uint64_t, std::uint32_t size) const
+        {
+            return size;
+        }
+    };
+
+    /**
+     * @brief
+     * Build a trace where key k (0-based rank) is requested with probability
+     * proportional to 1 / (k + 1)^skew. The keys are scrambled so popular
+     * keys do not hash next to each other.
+     * @param keys Number of distinct keys
+     * @param requests Length of the trace
+     * @param skew Zipf exponent
+     * @return std::vector<std::uint64_t> Requested keys
+     */
+    std::vector<std::uint64_t> zipf_trace(std::size_t keys, std::size_t requests,
+                                          double skew)
+    {
+        std::vector<double> cdf(keys);
+        double sum{};
+
+        for (std::size_t k{}; k < keys; ++k)
+            cdf[k] = sum += 1.0 / std::pow(static_cast<double>(k + 1), skew);
+
+        bench::Random random;
+        std::vector<std::uint64_t> trace(requests);
+
+        for (auto &key : trace)
+        {
+            auto const u{(random.next() >> 11) * 0x1.0p-53 * sum};
+            auto const rank{static_cast<std::uint64_t>(
+                std::lower_bound(cdf.begin(), cdf.end(), u) - cdf.begin())};
+
+            key = rank * 0x9E3779B97F4A7C15ULL;
+        }
+
+        return trace;
+    }
+
+    /**
+     * @brief
+     * Object size of a key, 64 B to 4 KiB
+     */
+    std::uint32_t object_size(std::uint64_t key)
+    {
+        return 64 + static_cast<std::uint32_t>((key >> 32) % 4033);
+    }
+
+    /**
+     * @brief
+     * Read-through replay: every request is a get, and a miss fills the key
+     */
+    template <class Cache>
+    void replay(const std::string &label, Cache &cache,
+                const std::vector<std::uint64_t> &trace)
+    {
+        cache.reset_stats();
+
+        auto const ms{bench::time_ms([&]
+                                     { for (auto const key : trace)
+                                           if (!cache.get(key))
+                                               cache.put(key, object_size(key)); })};
+
+        auto const &stats{cache.get_stats()};
+
+        bench::report(label, ms, stats.operations());
+        std::cout << "    hit rate " << std::setprecision(4) << stats.hit_rate()
+                  << ", evictions " << stats.evictions << "\n";
+    }
+}
+
+int main()
+{
+    constexpr std::size_t keys{1'000'000};
+    constexpr std::size_t requests{2'000'000};
+    constexpr double skew{0.99};
+
+    auto const trace{zipf_trace(keys, requests, skew)};
+    constexpr double average_size{64 + 4032 / 2.0};
+
+    std::cout << "Zipf(" << skew << ") over " << keys << " keys, "
+              << requests << " requests\n\n";
+
+    for (auto const fraction : {0.01, 0.10})
+    {
+        auto const entries{static_cast<std::size_t>(keys * fraction)};
+        auto const bytes{static_cast<std::size_t>(entries * average_size)};
+        auto const percent{std::to_string(static_cast<int>(fraction * 100)) + "%"};
+
+        {
+            LRUCache<std::uint64_t, std::uint32_t> cache{entries};
+            replay("LRU, " + percent + " of keys", cache, trace);
+        }
+
+        {
+            LFUCache<std::uint64_t, std::uint32_t> cache{entries};
+            replay("LFU, " + percent + " of keys", cache, trace);
+        }
+
+        {
+            LRUCache<std::uint64_t, std::uint32_t, ByteWeight> cache{bytes};
+            replay("LRU, " + percent + " of bytes", cache, trace);
+        }
+
+        {
+            LFUCache<std::uint64_t, std::uint32_t, ByteWeight> cache{bytes};
+            replay("LFU, " + percent + " of bytes", cache, trace);
+        }
+
+        std::cout << "\n";
+    }
+}
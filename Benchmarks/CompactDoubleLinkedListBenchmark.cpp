@@ -0,0 +1,110 @@
+/**
+ * @file CompactDoubleLinkedListBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief CompactDoubleLinkedList against DoubleLinkedList: memory per
+ * element and end/handle operations
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <vector>
+
+#include "Benchmark.h"
+#include "DoubleLinkedListBaseline.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/CompactDoubleLinkedList/CompactDoubleLinkedList.cpp"
+
+namespace
+{
+    std::size_t allocated_bytes{};
+    std::size_t allocation_count{};
+}
+
+// Count every heap allocation of the process, so the memory of a list is
+// what it asked the allocator for (malloc headers not included).
+void *operator new(std::size_t bytes)
+{
+    allocated_bytes += bytes;
+    ++allocation_count;
+
+    if (auto *pointer = std::malloc(bytes))
+        return pointer;
+
+    throw std::bad_alloc{};
+}
+
+void operator delete(void *pointer) noexcept { std::free(pointer); }
+void operator delete(void *pointer, std::size_t) noexcept { std::free(pointer); }
+
+int main()
+{
+    constexpr std::size_t n{1'000'000};
+
+    std::cout << "n = " << n << " std::uint32_t elements\n\n";
+
+    {
+        DoubleLinkedList<std::uint32_t> list{0};
+        list.pop_front();
+
+        auto const bytes_before{allocated_bytes};
+        auto const count_before{allocation_count};
+
+        bench::report("DoubleLinkedList::push_back", bench::time_ms([&]
+                      { for (std::uint32_t i{}; i < n; ++i) list.push_back(i); }), n);
+
+        std::cout << "  bytes per element: "
+                  << double(allocated_bytes - bytes_before) / n
+                  << ", allocations per element: "
+                  << double(allocation_count - count_before) / n << "\n";
+
+        bench::report("DoubleLinkedList::pop_front", bench::time_ms([&]
+                      { while (!list.is_empty()) list.pop_front(); }), n);
+    }
+
+    {
+        CompactDoubleLinkedList<std::uint32_t> list;
+
+        auto const bytes_before{allocated_bytes};
+        auto const count_before{allocation_count};
+
+        bench::report("CompactDoubleLinkedList::push_back", bench::time_ms([&]
+                      { for (std::uint32_t i{}; i < n; ++i) list.push_back(i); }), n);
+
+        std::cout << "  bytes per element: "
+                  << double(allocated_bytes - bytes_before) / n
+                  << " requested while growing (capacity " << list.capacity() << ", "
+                  << double(list.memory_usage()) / n << " at size " << n
+                  << "), allocations per element: "
+                  << double(allocation_count - count_before) / n << "\n";
+
+        bench::report("CompactDoubleLinkedList::pop_front", bench::time_ms([&]
+                      { while (!list.is_empty()) list.pop_front(); }), n);
+
+        bench::report("CompactDoubleLinkedList::push_back (reused slots)", bench::time_ms([&]
+                      { for (std::uint32_t i{}; i < n; ++i) list.push_back(i); }), n);
+
+        bench::Random random;
+        std::vector<CompactDoubleLinkedList<std::uint32_t>::handle_t> handles(n);
+
+        for (std::uint32_t i{}; i < n; ++i)
+            handles[i] = i;
+
+        bench::report("CompactDoubleLinkedList::move_to_front", bench::time_ms([&]
+                      { for (std::size_t i{}; i < n; ++i)
+                            list.move_to_front(handles[random.below(n)]); }), n);
+
+        for (std::size_t i{n}; i > 1; --i)
+            std::swap(handles[i - 1], handles[random.below(i)]);
+
+        bench::report("CompactDoubleLinkedList::erase (random handle)", bench::time_ms([&]
+                      { for (auto handle : handles) list.erase(handle); }), n);
+    }
+
+    bench::report_remove_at(20'000);
+}
@@ -0,0 +1,153 @@
+/**
+ * @file ConcurrentQueueBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief ConcurrentQueue against a Queue behind a std::mutex under
+ * contention, followed by a reclamation/ABA stress check
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "LockedQueue.h"
+#include "../DataStructures/LinearDataStructures/Queue/ConcurrentQueue/ConcurrentQueue.cpp"
+
+namespace
+{
+    /**
+     * @brief
+     * Every thread alternates one enqueue and one dequeue, the pattern of a
+     * shared work queue where workers also produce work
+     * @return double Elapsed milliseconds
+     */
+    template <class Q>
+    double mixed(Q &queue, unsigned threads, std::uint64_t per_thread)
+    {
+        return bench::time_ms([&]
+                              {
+            std::vector<std::thread> workers;
+
+            for (unsigned t{}; t < threads; ++t)
+                workers.emplace_back([&, t]
+                                     {
+                                         std::uint64_t sum{};
+
+                                         for (std::uint64_t i{}; i < per_thread; ++i)
+                                         {
+                                             queue.enqueue(t * per_thread + i);
+                                             sum += queue.dequeue().value_or(0);
+                                         }
+
+                                         bench::do_not_optimize(sum); });
+
+            for (auto &worker : workers)
+                worker.join(); });
+    }
+
+    /**
+     * @brief
+     * Producers enqueue (producer, sequence) pairs while consumers dequeue.
+     * Every value has to come out exactly once, and each consumer has to
+     * see the values of a producer in increasing order. A node reused too
+     * early shows up as a lost, duplicated or reordered value.
+     * @return bool Whether the check passed
+     */
+    bool stress(unsigned producers, unsigned consumers, std::uint64_t per_producer)
+    {
+        ConcurrentQueue<std::uint64_t> queue;
+        std::vector<std::atomic<std::uint8_t>> seen(producers * per_producer);
+        std::atomic<std::uint64_t> received{0};
+        std::atomic<bool> ordered{true};
+        std::vector<std::thread> threads;
+
+        for (unsigned p{}; p < producers; ++p)
+            threads.emplace_back([&, p]
+                                 { for (std::uint64_t i{}; i < per_producer; ++i)
+                                       queue.enqueue(p * per_producer + i); });
+
+        for (unsigned c{}; c < consumers; ++c)
+            threads.emplace_back([&]
+                                 {
+                                     std::vector<std::int64_t> last(producers, -1);
+
+                                     while (received.load(std::memory_order_relaxed) <
+                                            producers * per_producer)
+                                     {
+                                         auto const value{queue.dequeue()};
+
+                                         if (!value)
+                                         {
+                                             std::this_thread::yield();
+                                             continue;
+                                         }
+
+                                         auto const producer{*value / per_producer};
+                                         auto const sequence{static_cast<std::int64_t>(*value % per_producer)};
+
+                                         if (sequence <= last[producer])
+                                             ordered = false;
+
+                                         last[producer] = sequence;
+                                         seen[*value].fetch_add(1, std::memory_order_relaxed);
+                                         received.fetch_add(1, std::memory_order_relaxed);
+                                     } });
+
+        for (auto &thread : threads)
+            thread.join();
+
+        for (auto const &count : seen)
+            if (count.load() != 1)
+                return false;
+
+        return ordered && queue.is_empty();
+    }
+}
+
+int main()
+{
+    constexpr std::uint64_t total{1'000'000};
+
+    std::cout << "each thread alternates enqueue/dequeue, " << total
+              << " pairs in total, " << std::thread::hardware_concurrency()
+              << " core(s)\n";
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u})
+    {
+        auto const per_thread{total / threads};
+        auto const suffix{" (" + std::to_string(threads) + " threads)"};
+
+        std::cout << "\n";
+
+        {
+            bench::LockedQueue<std::uint64_t> queue;
+            bench::report("mutex + Queue" + suffix,
+                          mixed(queue, threads, per_thread), 2 * per_thread * threads);
+        }
+
+        {
+            ConcurrentQueue<std::uint64_t> queue;
+            bench::report("ConcurrentQueue" + suffix,
+                          mixed(queue, threads, per_thread), 2 * per_thread * threads);
+        }
+    }
+
+    std::cout << "\nstress: 8 producers, 8 consumers, 250000 values each... ";
+
+    if (!stress(8, 8, 250'000))
+    {
+        std::cout << "FAILED\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "ok\n";
+}
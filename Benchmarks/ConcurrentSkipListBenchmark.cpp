@@ -0,0 +1,133 @@
+/**
+ * @file ConcurrentSkipListBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief ConcurrentSkipList against a SkipList behind a std::shared_mutex,
+ * with mixed read/write ratios on 1 to 64 threads
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/SkipList/SkipList.cpp"
+#include "../DataStructures/LinearDataStructures/LinkedLists/ConcurrentSkipList/ConcurrentSkipList.cpp"
+
+namespace
+{
+    constexpr std::uint64_t KEY_RANGE{1 << 16};
+    constexpr std::uint64_t TOTAL_OPERATIONS{1 << 20};
+
+    /**
+     * @brief
+     * SkipList guarded by a reader/writer lock, the baseline
+     */
+    class LockedSkipList
+    {
+    public:
+        bool contains(std::uint64_t key) const
+        {
+            std::shared_lock lock{m_mutex};
+            return m_list.contains(key);
+        }
+
+        bool insert(std::uint64_t key)
+        {
+            std::unique_lock lock{m_mutex};
+
+            if (m_list.contains(key))
+                return false;
+
+            m_list.insert(key);
+            return true;
+        }
+
+        bool remove(std::uint64_t key)
+        {
+            std::unique_lock lock{m_mutex};
+            return m_list.remove(key);
+        }
+
+    private:
+        mutable std::shared_mutex m_mutex;
+        SkipList<std::uint64_t> m_list;
+    };
+
+    template <class Set>
+    double run(Set &set, unsigned threads, unsigned read_percent)
+    {
+        std::vector<std::thread> workers;
+        auto const per_thread{TOTAL_OPERATIONS / threads};
+
+        return bench::time_ms([&]
+                              {
+            for (unsigned t{}; t < threads; ++t)
+                workers.emplace_back([&, t]
+                {
+                    bench::Random random{t + 1};
+                    std::uint64_t hits{};
+
+                    for (std::uint64_t i{}; i < per_thread; ++i)
+                    {
+                        auto const key{random.below(KEY_RANGE)};
+                        auto const dice{random.below(100)};
+
+                        if (dice < read_percent)
+                            hits += set.contains(key);
+                        else if ((dice & 1) == 0)
+                            hits += set.insert(key);
+                        else
+                            hits += set.remove(key);
+                    }
+
+                    bench::do_not_optimize(hits);
+                });
+
+            for (auto &worker : workers)
+                worker.join(); });
+    }
+
+    template <class Set>
+    void prefill(Set &set)
+    {
+        for (std::uint64_t key{}; key < KEY_RANGE; key += 2)
+            set.insert(key);
+    }
+}
+
+int main()
+{
+    std::cout << "hardware threads: " << std::thread::hardware_concurrency()
+              << ", operations per run: " << TOTAL_OPERATIONS << "\n";
+
+    for (unsigned read_percent : {50u, 90u, 99u})
+    {
+        std::cout << "\n"
+                  << read_percent << "% contains, "
+                  << 100 - read_percent << "% insert/remove\n";
+
+        for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+        {
+            auto const suffix{" (" + std::to_string(threads) + " threads)"};
+
+            LockedSkipList locked;
+            prefill(locked);
+            bench::report("SkipList + shared_mutex" + suffix,
+                          run(locked, threads, read_percent), TOTAL_OPERATIONS);
+
+            ConcurrentSkipList<std::uint64_t> lock_free;
+            prefill(lock_free);
+            bench::report("ConcurrentSkipList" + suffix,
+                          run(lock_free, threads, read_percent), TOTAL_OPERATIONS);
+        }
+    }
+}
@@ -0,0 +1,171 @@
+/**
+ * @file ConcurrentStackBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief ConcurrentStack with and without elimination against a Stack
+ * behind a std::mutex, 1 to 64 threads, followed by a stress check
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Stack/Stack.cpp"
+#include "../DataStructures/LinearDataStructures/Stack/ConcurrentStack/ConcurrentStack.cpp"
+
+namespace
+{
+    /**
+     * @brief
+     * Stack<T> guarded by a mutex, the usual shared free list
+     */
+    template <class T>
+    class LockedStack
+    {
+    public:
+        void push(const T &value)
+        {
+            std::lock_guard lock{m_mutex};
+            m_stack.push(value);
+        }
+
+        std::optional<T> pop()
+        {
+            std::lock_guard lock{m_mutex};
+            auto value{m_stack.peek()};
+
+            m_stack.pop();
+
+            return value;
+        }
+
+    private:
+        std::mutex m_mutex;
+
+        // The node Stack counts its remaining capacity down in m_size
+        Stack<T> m_stack{std::numeric_limits<std::size_t>::max()};
+    };
+
+    /**
+     * @brief
+     * Every thread alternates one push and one pop, the pattern of a free
+     * list shared between threads
+     * @return double Elapsed milliseconds
+     */
+    template <class S>
+    double mixed(S &stack, unsigned threads, std::uint64_t per_thread)
+    {
+        return bench::time_ms([&]
+                              {
+            std::vector<std::thread> workers;
+
+            for (unsigned t{}; t < threads; ++t)
+                workers.emplace_back([&, t]
+                                     {
+                                         std::uint64_t sum{};
+
+                                         for (std::uint64_t i{}; i < per_thread; ++i)
+                                         {
+                                             stack.push(t * per_thread + i);
+                                             sum += stack.pop().value_or(0);
+                                         }
+
+                                         bench::do_not_optimize(sum); });
+
+            for (auto &worker : workers)
+                worker.join(); });
+    }
+
+    /**
+     * @brief
+     * Every thread pushes its own values and pops about as many, then the
+     * rest is drained. Every value has to come out exactly once, whether it
+     * went through the head or through an elimination slot.
+     * @return bool Whether the check passed
+     */
+    bool stress(unsigned threads, std::uint64_t per_thread)
+    {
+        ConcurrentStack<std::uint64_t> stack;
+        std::vector<std::atomic<std::uint8_t>> seen(threads * per_thread);
+        std::vector<std::thread> workers;
+
+        for (unsigned t{}; t < threads; ++t)
+            workers.emplace_back([&, t]
+                                 {
+                                     for (std::uint64_t i{}; i < per_thread; ++i)
+                                     {
+                                         stack.push(t * per_thread + i);
+
+                                         if (auto const value{stack.pop()})
+                                             seen[*value].fetch_add(1, std::memory_order_relaxed);
+                                     } });
+
+        for (auto &worker : workers)
+            worker.join();
+
+        while (auto const value{stack.pop()})
+            seen[*value].fetch_add(1, std::memory_order_relaxed);
+
+        for (auto const &count : seen)
+            if (count.load() != 1)
+                return false;
+
+        return stack.is_empty();
+    }
+}
+
+int main()
+{
+    constexpr std::uint64_t total{1'000'000};
+
+    std::cout << "each thread alternates push/pop, " << total
+              << " pairs in total, " << std::thread::hardware_concurrency()
+              << " core(s)\n";
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        auto const per_thread{total / threads};
+        auto const suffix{" (" + std::to_string(threads) + " threads)"};
+
+        std::cout << "\n";
+
+        {
+            LockedStack<std::uint64_t> stack;
+            bench::report("mutex + Stack" + suffix,
+                          mixed(stack, threads, per_thread), 2 * per_thread * threads);
+        }
+
+        {
+            ConcurrentStack<std::uint64_t> stack{false};
+            bench::report("Treiber stack" + suffix,
+                          mixed(stack, threads, per_thread), 2 * per_thread * threads);
+        }
+
+        {
+            ConcurrentStack<std::uint64_t> stack;
+            bench::report("Treiber + elimination" + suffix,
+                          mixed(stack, threads, per_thread), 2 * per_thread * threads);
+        }
+    }
+
+    std::cout << "\nstress: 16 threads, 250000 values each... ";
+
+    if (!stress(16, 250'000))
+    {
+        std::cout << "FAILED\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "ok\n";
+}
@@ -0,0 +1,211 @@
+/**
+ * @file DequeBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief Deque against DoubleLinkedList and std::deque (both ends, sliding
+ * window, random access, iteration)
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <string>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/DoubleLinkedList/DoubleLinkedList.cpp"
+#include "../DataStructures/LinearDataStructures/Deque/Deque.cpp"
+
+namespace
+{
+    constexpr std::size_t n{1'000'000};
+    constexpr std::size_t window{1'000};
+
+    /**
+     * @brief
+     * push_back, push_front, a sliding window (push_back then pop_front
+     * once it is full) and draining from the front, shared by the three
+     * containers
+     */
+    template <class D>
+    void ends(const std::string &name)
+    {
+        {
+            D deque;
+
+            bench::report(name + " push_back", bench::time_ms([&]
+                          { for (std::uint32_t i{}; i < n; ++i) deque.push_back(i); }), n);
+
+            bench::report(name + " pop_front", bench::time_ms([&]
+                          { while (!deque.is_empty()) deque.pop_front(); }), n);
+        }
+
+        {
+            D deque;
+
+            bench::report(name + " push_front", bench::time_ms([&]
+                          { for (std::uint32_t i{}; i < n; ++i) deque.push_front(i); }), n);
+
+            bench::report(name + " pop_back", bench::time_ms([&]
+                          { while (!deque.is_empty()) deque.pop_back(); }), n);
+        }
+
+        {
+            D deque;
+
+            bench::report(name + " sliding window " + std::to_string(window),
+                          bench::time_ms([&]
+                                         {
+                for (std::uint32_t i{}; i < n; ++i)
+                {
+                    deque.push_back(i);
+
+                    if (i >= window)
+                        deque.pop_front();
+                }
+
+                while (!deque.is_empty())
+                    deque.pop_front(); }),
+                          2 * n);
+        }
+    }
+
+    /**
+     * @brief
+     * DoubleLinkedList with the interface the shared benchmark expects. Its
+     * default constructor leaves the size uninitialized, so it is built
+     * with one element that is removed right away.
+     */
+    struct LinkedDeque
+    {
+        LinkedDeque() { list.pop_front(); }
+
+        void push_back(std::uint32_t value) { list.push_back(value); }
+        void push_front(std::uint32_t value) { list.push_front(value); }
+        void pop_back() { list.pop_back(); }
+        void pop_front() { list.pop_front(); }
+        bool is_empty() const { return list.is_empty(); }
+
+        DoubleLinkedList<std::uint32_t> list{0};
+    };
+
+    /**
+     * @brief
+     * std::deque with the names of this project
+     */
+    struct StdDeque : std::deque<std::uint32_t>
+    {
+        bool is_empty() const { return empty(); }
+    };
+}
+
+int main()
+{
+    std::cout << "n = " << n << " std::uint32_t elements\n\n";
+
+    ends<LinkedDeque>("DoubleLinkedList");
+    std::cout << "\n";
+    ends<StdDeque>("std::deque");
+    std::cout << "\n";
+    ends<Deque<std::uint32_t>>("Deque");
+
+    std::cout << "\nrandom access and iteration\n";
+
+    std::deque<std::uint32_t> reference;
+    Deque<std::uint32_t> deque;
+
+    // Half of the elements at each end, so the front block is not aligned
+    for (std::uint32_t i{}; i < n; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            reference.push_back(i);
+            deque.push_back(i);
+        }
+        else
+        {
+            reference.push_front(i);
+            deque.push_front(i);
+        }
+    }
+
+    {
+        bench::Random random;
+        bench::report("std::deque operator[] (random)", bench::time_ms([&]
+                      {
+            std::uint64_t sum{};
+
+            for (std::size_t i{}; i < n; ++i)
+                sum += reference[random.below(n)];
+
+            bench::do_not_optimize(sum); }),
+                      n);
+    }
+
+    {
+        bench::Random random;
+        bench::report("Deque operator[] (random)", bench::time_ms([&]
+                      {
+            std::uint64_t sum{};
+
+            for (std::size_t i{}; i < n; ++i)
+                sum += deque[random.below(n)];
+
+            bench::do_not_optimize(sum); }),
+                      n);
+    }
+
+    {
+        // A linked list has no index, every access walks from the head
+        constexpr std::size_t small{20'000};
+        constexpr std::size_t reads{2'000};
+        LinkedDeque list;
+
+        for (std::uint32_t i{}; i < small; ++i)
+            list.push_back(i);
+
+        bench::Random random;
+        bench::report("DoubleLinkedList walk to index (random, n=20000)", bench::time_ms([&]
+                      {
+            std::uint64_t sum{};
+
+            for (std::size_t i{}; i < reads; ++i)
+            {
+                auto node{list.list.get_head()};
+
+                for (auto steps{random.below(small)}; steps > 0; --steps)
+                    node = node->get_next();
+
+                sum += node->get_data();
+            }
+
+            bench::do_not_optimize(sum); }),
+                      reads);
+
+        while (!list.is_empty())
+            list.pop_front();
+    }
+
+    bench::report("std::deque iteration", bench::time_ms([&]
+                  {
+        std::uint64_t sum{};
+
+        for (auto const value : reference)
+            sum += value;
+
+        bench::do_not_optimize(sum); }),
+                  n);
+
+    bench::report("Deque iteration", bench::time_ms([&]
+                  {
+        std::uint64_t sum{};
+
+        for (auto const value : deque)
+            sum += value;
+
+        bench::do_not_optimize(sum); }),
+                  n);
+}
@@ -0,0 +1,63 @@
+/**
+ * @file DoubleLinkedListBaseline.h
+ * @author Carlos Salguero
+ * @brief Removal by index from DoubleLinkedList, the removal baseline of
+ * the list benchmarks
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef DOUBLE_LINKED_LIST_BASELINE_H
+#define DOUBLE_LINKED_LIST_BASELINE_H
+
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+#include <string>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/DoubleLinkedList/DoubleLinkedList.cpp"
+
+namespace bench
+{
+    /**
+     * @brief
+     * Empty a DoubleLinkedList from the front
+     * @tparam T Type of the values
+     * @param list List to be emptied
+     */
+    template <class T>
+    void drain(DoubleLinkedList<T> &list)
+    {
+        while (!list.is_empty())
+            list.pop_front();
+    }
+
+    /**
+     * @brief
+     * Time remove_at() of random positions of a DoubleLinkedList of size
+     * values until two are left. Every removal walks to its position, which
+     * is what a list without handles or hooks pays to remove a known value.
+     * @param size Number of values
+     */
+    inline void report_remove_at(std::size_t size)
+    {
+        DoubleLinkedList<std::uint64_t> list{0};
+        list.pop_front();
+
+        for (std::uint64_t i{}; i < size; ++i)
+            list.push_back(i);
+
+        Random random;
+        std::size_t left{size};
+
+        report("DoubleLinkedList::remove_at (random, n=" + std::to_string(size) + ")", time_ms([&]
+               { while (left > 2) list.remove_at(random.below(left--)); }), size);
+
+        drain(list);
+    }
+}
+
+#endif //! DOUBLE_LINKED_LIST_BASELINE_H
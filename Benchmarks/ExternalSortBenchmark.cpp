@@ -0,0 +1,136 @@
+/**
+ * @file ExternalSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief external_sort of a generated file of random uint64_t, 20 GB by
+ * default, through the page cache and with O_DIRECT
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/ExternalSort/ExternalSort.h"
+
+namespace
+{
+    // Values per read or write of the driver itself
+    constexpr std::size_t CHUNK{std::size_t{1} << 23};
+
+    /**
+     * @brief
+     * Write n random values to a file
+     * @return std::uint64_t Sum of the values, to check the output against
+     */
+    std::uint64_t generate(const std::filesystem::path &path, std::uint64_t n)
+    {
+        bench::Random random;
+        std::vector<std::uint64_t> chunk(CHUNK);
+        std::ofstream file{path, std::ios::binary};
+        std::uint64_t sum{};
+
+        for (std::uint64_t done{}; done < n; done += CHUNK)
+        {
+            auto const count{static_cast<std::size_t>(std::min<std::uint64_t>(CHUNK, n - done))};
+
+            for (std::size_t i{}; i < count; ++i)
+                sum += chunk[i] = random.next();
+
+            file.write(reinterpret_cast<const char *>(chunk.data()),
+                       static_cast<std::streamsize>(count * sizeof(std::uint64_t)));
+        }
+
+        if (!file)
+            throw std::runtime_error{"Cannot write " + path.string()};
+
+        return sum;
+    }
+
+    /**
+     * @brief
+     * Check that a file holds n values in order that add up to sum
+     */
+    bool verify(const std::filesystem::path &path, std::uint64_t n, std::uint64_t sum)
+    {
+        std::vector<std::uint64_t> chunk(CHUNK);
+        std::ifstream file{path, std::ios::binary};
+        std::uint64_t previous{};
+        std::uint64_t count{};
+
+        while (file.read(reinterpret_cast<char *>(chunk.data()), CHUNK * sizeof(std::uint64_t)) ||
+               file.gcount() > 0)
+        {
+            auto const values{static_cast<std::size_t>(file.gcount()) / sizeof(std::uint64_t)};
+
+            for (std::size_t i{}; i < values; ++i)
+            {
+                if (chunk[i] < previous)
+                    return false;
+
+                previous = chunk[i];
+                sum -= chunk[i];
+            }
+
+            count += values;
+        }
+
+        return count == n && sum == 0;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    double const gigabytes{argc > 1 ? std::stod(argv[1]) : 20.0};
+    std::size_t const budget{argc > 2 ? std::stoull(argv[2]) : 1024};
+    std::filesystem::path const directory{argc > 3 ? argv[3] : std::filesystem::temp_directory_path()};
+
+    auto const n{static_cast<std::uint64_t>(gigabytes * 1e9) / sizeof(std::uint64_t)};
+    auto const input{directory / "external_sort_input.bin"};
+    auto const output{directory / "external_sort_output.bin"};
+
+    std::cout << n << " uint64_t (" << gigabytes << " GB) in " << directory << ", "
+              << budget << " MiB of memory\n\n";
+
+    std::uint64_t sum{};
+
+    bench::report("generate the input", bench::time_ms([&]
+                                                       { sum = generate(input, n); }),
+                  n);
+
+    bool sorted{true};
+
+    for (bool direct : {false, true})
+    {
+        ExternalSortOptions options;
+        options.memory_budget = budget << 20;
+        options.temp_directory = directory;
+        options.direct_io = direct;
+
+        bench::report(direct ? "external_sort (O_DIRECT)" : "external_sort (page cache)",
+                      bench::time_ms([&]
+                                     { external_sort<std::uint64_t>(input, output, std::less<>{}, options); }),
+                      n);
+
+        sorted = sorted && verify(output, n, sum);
+    }
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,133 @@
+/**
+ * @file HeapSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief heap_sort with binary, 4-ary and 8-ary heaps against
+ * std::make_heap + std::sort_heap and std::sort, timed and counting
+ * comparisons, plus Floyd's construction against repeated push_heap
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/HeapSort/HeapSort.h"
+
+namespace
+{
+    bool sorted{true};
+
+    /**
+     * @brief
+     * Time one sort of a copy of the input with a counting comparison, and
+     * report the comparisons per N log2(N)
+     */
+    template <class T, class Sort>
+    void measure(const std::string &label, const std::vector<T> &input, Sort sort)
+    {
+        auto data{input};
+        std::uint64_t comparisons{};
+
+        auto const cmp{[&](const T &a, const T &b)
+                       { ++comparisons;
+                         return a < b; }};
+
+        bench::report(label, bench::time_ms([&]
+                                            { sort(data.begin(), data.end(), cmp); }),
+                      input.size());
+
+        auto const n{static_cast<double>(input.size())};
+
+        std::cout << std::setw(44) << "" << std::setw(12) << std::setprecision(3)
+                  << comparisons / (n * std::log2(n)) << " N log2(N) comparisons\n";
+
+        sorted = sorted && std::is_sorted(data.begin(), data.end());
+    }
+
+    template <class T>
+    void run(const std::string &name, const std::vector<T> &input)
+    {
+        auto const suffix{", " + name};
+
+        std::cout << "\n";
+
+        measure("std::sort" + suffix, input, [](auto first, auto last, auto cmp)
+                { std::sort(first, last, cmp); });
+        measure("std::make_heap + sort_heap" + suffix, input, [](auto first, auto last, auto cmp)
+                { std::make_heap(first, last, cmp);
+                  std::sort_heap(first, last, cmp); });
+        measure("heap_sort<2>" + suffix, input, [](auto first, auto last, auto cmp)
+                { heap_sort<2>(first, last, cmp); });
+        measure("heap_sort<4>" + suffix, input, [](auto first, auto last, auto cmp)
+                { heap_sort<4>(first, last, cmp); });
+        measure("heap_sort<8>" + suffix, input, [](auto first, auto last, auto cmp)
+                { heap_sort<8>(first, last, cmp); });
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 10'000'000};
+
+    bench::Random random;
+    std::vector<std::uint64_t> keys(n);
+    std::vector<std::string> strings(n / 10);
+
+    for (auto &key : keys)
+        key = random.next();
+
+    // Long common prefix, so every comparison walks the string
+    for (auto &string : strings)
+        string = "key-" + std::string(24, 'x') + std::to_string(random.next());
+
+    std::cout << n << " uint64_t and " << strings.size() << " strings\n";
+
+    run("uint64_t", keys);
+    run("string", strings);
+
+    // Heap construction alone, the way heap_sort used to build it. Every
+    // push_heap of an ascending input climbs to the root.
+    std::cout << "\n";
+
+    {
+        std::sort(keys.begin(), keys.end());
+
+        auto data{keys};
+        std::uint64_t comparisons{};
+        auto const cmp{[&](auto a, auto b)
+                       { ++comparisons;
+                         return a < b; }};
+
+        bench::report("push_heap N times, ascending", bench::time_ms([&]
+                                                          { for (auto it{data.begin()}; it != data.end();)
+                                                                std::push_heap(data.begin(), ++it, cmp); }),
+                      n);
+        std::cout << std::setw(56) << comparisons / static_cast<double>(n) << " N comparisons\n";
+
+        data = keys;
+        comparisons = 0;
+
+        bench::report("custom::make_heap (Floyd), ascending", bench::time_ms([&]
+                                                                  { custom::make_heap(data.begin(), data.end(), cmp); }),
+                      n);
+        std::cout << std::setw(56) << comparisons / static_cast<double>(n) << " N comparisons\n";
+
+        sorted = sorted && std::is_heap(data.begin(), data.end());
+    }
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
@@ -0,0 +1,98 @@
+/**
+ * @file IntrusiveListBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief IntrusiveList against DoubleLinkedList: membership in two lists
+ * and removal of a known element
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Benchmark.h"
+#include "DoubleLinkedListBaseline.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/IntrusiveList/IntrusiveList.cpp"
+
+namespace
+{
+    struct Lru
+    {
+    };
+
+    struct Tenant
+    {
+    };
+
+    /**
+     * @brief
+     * 64 bytes of payload that has to be in an LRU list and a tenant list
+     */
+    struct Session : IntrusiveListHook<Lru>, IntrusiveListHook<Tenant>
+    {
+        std::uint64_t id{};
+        char data[56]{};
+    };
+}
+
+int main()
+{
+    constexpr std::size_t n{1'000'000};
+    std::vector<Session> sessions(n);
+
+    for (std::size_t i{}; i < n; ++i)
+        sessions[i].id = i;
+
+    std::cout << "n = " << n << " sessions of " << sizeof(Session)
+              << " bytes, each in two lists\n\n";
+
+    {
+        DoubleLinkedList<Session> lru{Session{}};
+        DoubleLinkedList<Session> tenant{Session{}};
+        lru.pop_front();
+        tenant.pop_front();
+
+        bench::report("DoubleLinkedList::push_back x2 (copies)", bench::time_ms([&]
+                      { for (auto const &session : sessions)
+                        {
+                            lru.push_back(session);
+                            tenant.push_back(session);
+                        } }), 2 * n);
+
+        bench::drain(lru);
+        bench::drain(tenant);
+    }
+
+    {
+        IntrusiveList<Session, Lru> lru;
+        IntrusiveList<Session, Tenant> tenant;
+
+        bench::report("IntrusiveList::push_back x2 (no allocation)", bench::time_ms([&]
+                      { for (auto &session : sessions)
+                        {
+                            lru.push_back(session);
+                            tenant.push_back(session);
+                        } }), 2 * n);
+
+        bench::Random random;
+
+        bench::report("IntrusiveList::move_to_front (LRU touch)", bench::time_ms([&]
+                      { for (std::size_t i{}; i < n; ++i)
+                            lru.move_to_front(sessions[random.below(n)]); }), n);
+
+        bench::report("IntrusiveList::remove (random object)", bench::time_ms([&]
+                      { for (std::size_t i{n}; i > 0; --i)
+                        {
+                            auto &session{sessions[random.below(n)]};
+
+                            if (static_cast<IntrusiveListHook<Lru> &>(session).is_linked())
+                                lru.remove(session);
+                        } }), n);
+    }
+
+    bench::report_remove_at(20'000);
+}
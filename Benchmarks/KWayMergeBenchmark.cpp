@@ -0,0 +1,162 @@
+/**
+ * @file KWayMergeBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief kway_merge and parallel_kway_merge against a binary heap of
+ * sources and rounds of std::inplace_merge, merging k = 2 to 1024 sorted
+ * shards of 16M uint64_t
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <queue>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/MergeSort/KWayMerge.h"
+
+namespace
+{
+    using Shard = std::pair<const std::uint64_t *, const std::uint64_t *>;
+
+    /**
+     * @brief
+     * Merge through a binary heap of (value, source) pairs, one pop and one
+     * push per element
+     */
+    void heap_merge(const std::vector<Shard> &shards, std::uint64_t *out)
+    {
+        using Entry = std::pair<std::uint64_t, std::size_t>;
+
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<>> heap;
+        auto positions{shards};
+
+        for (std::size_t source{}; source < shards.size(); ++source)
+            if (positions[source].first != positions[source].second)
+                heap.push({*positions[source].first++, source});
+
+        while (!heap.empty())
+        {
+            auto const [value, source]{heap.top()};
+            heap.pop();
+
+            *out++ = value;
+
+            if (positions[source].first != positions[source].second)
+                heap.push({*positions[source].first++, source});
+        }
+    }
+
+    /**
+     * @brief
+     * Merge the concatenated shards in place, pairs of neighbours at a
+     * time, log2(k) rounds over the whole data
+     */
+    void inplace_merges(std::vector<std::uint64_t> &data, std::vector<std::size_t> bounds)
+    {
+        while (bounds.size() > 2)
+        {
+            std::vector<std::size_t> merged{0};
+
+            for (std::size_t i{}; i + 1 < bounds.size(); i += 2)
+            {
+                if (i + 2 < bounds.size())
+                {
+                    std::inplace_merge(data.begin() + static_cast<std::ptrdiff_t>(bounds[i]),
+                                       data.begin() + static_cast<std::ptrdiff_t>(bounds[i + 1]),
+                                       data.begin() + static_cast<std::ptrdiff_t>(bounds[i + 2]));
+                    merged.push_back(bounds[i + 2]);
+                }
+                else
+                    merged.push_back(bounds[i + 1]);
+            }
+
+            bounds = std::move(merged);
+        }
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 16'000'000};
+
+    bench::Random random;
+    std::vector<std::uint64_t> input(n);
+
+    for (auto &value : input)
+        value = random.next();
+
+    std::vector<std::uint64_t> expected{input};
+    std::sort(expected.begin(), expected.end());
+
+    std::vector<std::uint64_t> output(n);
+    bool sorted{true};
+
+    auto const check{[&](const std::vector<std::uint64_t> &result)
+                     { sorted = sorted && result == expected; }};
+
+    std::cout << n << " uint64_t in k sorted shards, " << std::thread::hardware_concurrency()
+              << " core(s)\n";
+
+    for (std::size_t k{2}; k <= 1024; k *= 2)
+    {
+        // Shards of equal size, each sorted on its own
+        auto shards_data{input};
+        std::vector<std::size_t> bounds;
+        std::vector<Shard> shards;
+
+        for (std::size_t shard{}; shard <= k; ++shard)
+            bounds.push_back(n * shard / k);
+
+        for (std::size_t shard{}; shard < k; ++shard)
+        {
+            auto *const first{shards_data.data() + bounds[shard]};
+            auto *const last{shards_data.data() + bounds[shard + 1]};
+
+            std::sort(first, last);
+            shards.emplace_back(first, last);
+        }
+
+        auto const suffix{" (k = " + std::to_string(k) + ")"};
+
+        std::cout << "\n";
+
+        bench::report("kway_merge" + suffix, bench::time_ms([&]
+                                                            { kway_merge(shards, output.begin()); }),
+                      n);
+        check(output);
+
+        bench::report("parallel_kway_merge" + suffix, bench::time_ms([&]
+                                                                     { parallel_kway_merge(shards, output.begin()); }),
+                      n);
+        check(output);
+
+        bench::report("binary heap of sources" + suffix, bench::time_ms([&]
+                                                                        { heap_merge(shards, output.data()); }),
+                      n);
+        check(output);
+
+        auto data{shards_data};
+
+        bench::report("rounds of std::inplace_merge" + suffix, bench::time_ms([&]
+                                                                              { inplace_merges(data, bounds); }),
+                      n);
+        check(data);
+    }
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
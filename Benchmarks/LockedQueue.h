@@ -0,0 +1,107 @@
+/**
+ * @file LockedQueue.h
+ * @author Carlos Salguero
+ * @brief Mutex-guarded Queue, the baseline of the concurrent queue
+ * benchmarks
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef LOCKED_QUEUE_H
+#define LOCKED_QUEUE_H
+
+#include <mutex>
+#include <optional> // std::optional, std::nullopt
+#include <thread>   // std::this_thread::yield()
+
+#include "../DataStructures/LinearDataStructures/Queue/Queue.cpp"
+
+namespace bench
+{
+    /**
+     * @brief
+     * Queue<T> guarded by a mutex, the way it is shared between threads
+     * without a concurrent queue. It answers to the names of every queue it
+     * is measured against, so the same benchmark code drives both.
+     * @tparam T Type of the values
+     */
+    template <class T>
+    class LockedQueue
+    {
+    public:
+        /**
+         * @brief
+         * Add a value at the back
+         * @param value Value to be added
+         */
+        void enqueue(const T &value)
+        {
+            std::lock_guard lock{m_mutex};
+            m_queue.enqueue(value);
+        }
+
+        /**
+         * @brief
+         * Remove the value at the front, if any
+         * @return std::optional<T> The value, or nullopt if the queue is
+         * empty
+         */
+        std::optional<T> dequeue()
+        {
+            std::lock_guard lock{m_mutex};
+
+            if (m_queue.is_empty())
+                return std::nullopt;
+
+            return m_queue.dequeue();
+        }
+
+        /**
+         * @brief
+         * Same as enqueue(), the queue being unbounded
+         * @return true Always
+         */
+        bool try_push(const T &value)
+        {
+            enqueue(value);
+            return true;
+        }
+
+        /**
+         * @brief
+         * Same as dequeue()
+         */
+        std::optional<T> try_pop() { return dequeue(); }
+
+        /**
+         * @brief
+         * Same as enqueue()
+         */
+        void push(const T &value) { enqueue(value); }
+
+        /**
+         * @brief
+         * Remove the value at the front, yielding until there is one
+         * @return T The value
+         */
+        T pop()
+        {
+            while (true)
+            {
+                if (auto value{dequeue()})
+                    return *value;
+
+                std::this_thread::yield();
+            }
+        }
+
+    private:
+        std::mutex m_mutex;
+        Queue<T> m_queue{0};
+    };
+}
+
+#endif //! LOCKED_QUEUE_H
@@ -0,0 +1,112 @@
+/**
+ * @file MPMCQueueBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief MPMCQueue against a Queue behind a std::mutex, with 1 to 32
+ * producers and as many consumers
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "LockedQueue.h"
+#include "../DataStructures/LinearDataStructures/Queue/MPMCQueue.cpp"
+
+namespace
+{
+    /**
+     * @brief
+     * Every producer pushes per_thread values and every consumer pops as
+     * many
+     * @return double Elapsed milliseconds until every thread is done
+     */
+    template <class Push, class Pop>
+    double run(unsigned threads, std::uint64_t per_thread, Push push, Pop pop)
+    {
+        return bench::time_ms([&]
+                              {
+            std::vector<std::thread> workers;
+            std::vector<std::uint64_t> sums(threads);
+
+            for (unsigned t{}; t < threads; ++t)
+            {
+                workers.emplace_back([&, t]
+                                     { for (std::uint64_t i{}; i < per_thread; ++i)
+                                           push(t * per_thread + i); });
+                workers.emplace_back([&, t]
+                                     { for (std::uint64_t i{}; i < per_thread; ++i)
+                                           sums[t] += pop(); });
+            }
+
+            for (auto &worker : workers)
+                worker.join();
+
+            bench::do_not_optimize(sums); });
+    }
+}
+
+int main()
+{
+    constexpr std::uint64_t total{1'000'000};
+    constexpr std::size_t capacity{1'024};
+
+    std::cout << total << " uint64 through each queue, capacity " << capacity
+              << ", " << std::thread::hardware_concurrency() << " core(s)\n";
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u, 32u})
+    {
+        auto const per_thread{total / threads};
+        auto const suffix{" (" + std::to_string(threads) + "P/" +
+                          std::to_string(threads) + "C)"};
+
+        std::cout << "\n";
+
+        {
+            bench::LockedQueue<std::uint64_t> queue;
+
+            bench::report("mutex + Queue" + suffix,
+                          run(threads, per_thread, [&](std::uint64_t value)
+                              { queue.push(value); },
+                              [&]
+                              { return queue.pop(); }),
+                          2 * per_thread * threads);
+        }
+
+        {
+            MPMCQueue<std::uint64_t> queue{capacity};
+
+            bench::report("MPMCQueue::try_push/try_pop" + suffix,
+                          run(threads, per_thread, [&](std::uint64_t value)
+                              { while (!queue.try_push(value))
+                                    std::this_thread::yield(); },
+                              [&]
+                              {
+                                  std::optional<std::uint64_t> value;
+
+                                  while (!(value = queue.try_pop()))
+                                      std::this_thread::yield();
+
+                                  return *value; }),
+                          2 * per_thread * threads);
+        }
+
+        {
+            MPMCQueue<std::uint64_t> queue{capacity};
+
+            bench::report("MPMCQueue::push/pop (blocking)" + suffix,
+                          run(threads, per_thread, [&](std::uint64_t value)
+                              { queue.push(value); },
+                              [&]
+                              { return queue.pop(); }),
+                          2 * per_thread * threads);
+        }
+    }
+}
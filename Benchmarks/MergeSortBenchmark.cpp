@@ -0,0 +1,93 @@
+/**
+ * @file MergeSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief parallel_merge_sort with 1 to 64 workers against merge_sort,
+ * std::stable_sort and std::sort on 100M uint64_t
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/MergeSort/MergeSort.h"
+#include "../Algorithms/ModenC++/Sort/MergeSort/ParallelMergeSort.h"
+
+namespace
+{
+    /**
+     * @brief
+     * Copy the input, time one sort of the copy and check the result
+     * @return double Elapsed milliseconds, negative if the output is not sorted
+     */
+    template <class Sort>
+    double measure(const std::vector<std::uint64_t> &input, std::vector<std::uint64_t> &data,
+                   Sort sort)
+    {
+        std::copy(input.begin(), input.end(), data.begin());
+
+        auto const ms{bench::time_ms([&]
+                                     { sort(data); })};
+
+        return std::is_sorted(data.begin(), data.end()) ? ms : -1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 100'000'000};
+
+    bench::Random random;
+    std::vector<std::uint64_t> input(n);
+
+    for (auto &value : input)
+        value = random.next();
+
+    std::vector<std::uint64_t> data(n);
+    std::vector<std::uint64_t> buffer(n);
+    bool sorted{true};
+
+    auto const report{[&](const std::string &label, double ms)
+                      {
+                          sorted = sorted && ms >= 0;
+                          bench::report(label, ms, n);
+                      }};
+
+    std::cout << n << " random uint64_t, " << std::thread::hardware_concurrency()
+              << " core(s)\n\n";
+
+    report("std::sort", measure(input, data, [](auto &v)
+                                { std::sort(v.begin(), v.end()); }));
+    report("std::stable_sort", measure(input, data, [](auto &v)
+                                       { std::stable_sort(v.begin(), v.end()); }));
+    report("merge_sort", measure(input, data, [](auto &v)
+                                 { merge_sort(v.begin(), v.end()); }));
+
+    std::cout << "\n";
+
+    for (std::size_t threads : {1u, 2u, 4u, 8u, 16u, 32u, 64u})
+    {
+        ThreadPool pool{threads};
+
+        // The buffer is preallocated, so only the sort itself is timed
+        report("parallel_merge_sort (" + std::to_string(threads) + " threads)",
+               measure(input, data, [&](auto &v)
+                       { parallel_merge_sort(v.begin(), v.end(), buffer.begin(),
+                                             std::less<>{}, pool); }));
+    }
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
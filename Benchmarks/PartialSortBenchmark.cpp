@@ -0,0 +1,144 @@
+/**
+ * @file PartialSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief Top-K selection with intro_select, partial_heap_sort and TopK
+ * against full sorts and their std counterparts
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/PartialSort/PartialSort.h"
+#include "../Algorithms/ModenC++/Sort/QuickSort/QuickSort.h"
+#include "../Algorithms/ModenC++/Sort/SimdSort/SimdSort.h"
+
+namespace
+{
+    bool sorted{true};
+
+    /**
+     * @brief
+     * Time one selection on a copy of the input, which returns the k
+     * largest values in descending order, and check them
+     */
+    template <class Select>
+    void measure(const std::string &label, const std::vector<std::uint64_t> &input,
+                 const std::vector<std::uint64_t> &expected, Select select)
+    {
+        auto data{input};
+        std::vector<std::uint64_t> top;
+
+        bench::report(label, bench::time_ms([&]
+                                            { top = select(data); }),
+                      input.size());
+
+        sorted = sorted && top == expected;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 100'000'000};
+    std::size_t const k{argc > 2 ? std::stoull(argv[2]) : 100};
+
+    using key = std::uint64_t;
+    using std::ptrdiff_t;
+
+    bench::Random random;
+    std::vector<key> input(n);
+
+    for (auto &value : input)
+        value = random.next();
+
+    auto const K{static_cast<ptrdiff_t>(std::min(k, n))};
+
+    std::vector<key> expected{input};
+    std::sort(expected.begin(), expected.end(), std::greater<>{});
+    expected.resize(static_cast<std::size_t>(K));
+
+    auto const prefix{[K](const std::vector<key> &data)
+                      { return std::vector<key>(data.begin(), data.begin() + K); }};
+
+    std::cout << "top " << K << " of " << n << " uint64_t\n\n";
+
+    // Full sorts, the way the dashboards used to do it
+    measure("std::sort, full", input, expected, [&](auto &v)
+            { std::sort(v.begin(), v.end(), std::greater<>{});
+              return prefix(v); });
+    measure("quick_sort, full", input, expected, [&](auto &v)
+            { quick_sort(v.begin(), v.end(), std::greater<>{});
+              return prefix(v); });
+    measure("simd_sort, full", input, expected, [&](auto &v)
+            { simd_sort(v.begin(), v.end());
+              return std::vector<key>(v.rbegin(), v.rbegin() + K); });
+
+    std::cout << "\n";
+
+    // Select the k-th, then sort the k before it
+    measure("std::nth_element + std::sort", input, expected, [&](auto &v)
+            { std::nth_element(v.begin(), v.begin() + K, v.end(), std::greater<>{});
+              std::sort(v.begin(), v.begin() + K, std::greater<>{});
+              return prefix(v); });
+    measure("intro_select + quick_sort", input, expected, [&](auto &v)
+            { intro_select(v.begin(), v.begin() + K, v.end(), std::greater<>{});
+              quick_sort(v.begin(), v.begin() + K, std::greater<>{});
+              return prefix(v); });
+
+    std::cout << "\n";
+
+    measure("std::partial_sort", input, expected, [&](auto &v)
+            { std::partial_sort(v.begin(), v.begin() + K, v.end(), std::greater<>{});
+              return prefix(v); });
+    measure("partial_heap_sort", input, expected, [&](auto &v)
+            { partial_heap_sort(v.begin(), v.begin() + K, v.end(), std::greater<>{});
+              return prefix(v); });
+
+    std::cout << "\n";
+
+    // Streaming: the input is only read, one value or one batch at a time
+    measure("TopK, one value at a time", input, expected, [&](auto &v)
+            { TopK<key, std::greater<>> top{k};
+
+              for (auto const value : v)
+                  top.push(value);
+
+              return top.get_sorted(); });
+    measure("TopK, batches of 64K, SIMD filter", input, expected, [&](auto &v)
+            { TopK<key, std::greater<>> top{k};
+
+              for (std::size_t i{}; i < v.size(); i += 65536)
+                  top.push(v.begin() + static_cast<ptrdiff_t>(i),
+                           v.begin() + static_cast<ptrdiff_t>(std::min(i + 65536, v.size())));
+
+              return top.get_sorted(); });
+
+    // Ranges that never fill the heap, an empty one and one shorter than
+    // k + 1, which the filter has no threshold for
+    {
+        std::vector<key> const none;
+        std::vector<key> const few(input.begin(), input.begin() + K);
+
+        auto few_expected{few};
+        std::sort(few_expected.begin(), few_expected.end(), std::greater<>{});
+
+        sorted = sorted && top_k(none.begin(), none.end(), k, std::greater<>{}).empty() &&
+                 top_k(few.begin(), few.end(), k + 1, std::greater<>{}) == few_expected;
+    }
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
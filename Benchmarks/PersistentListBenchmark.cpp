@@ -0,0 +1,216 @@
+/**
+ * @file PersistentListBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief Snapshots of a PersistentList against deep copies of a
+ * SinglyLinkedList, and PersistentStack with atomic and plain counts
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/SinglyLinkedList/SinglyLinkedList.cpp"
+#include "../DataStructures/LinearDataStructures/LinkedLists/PersistentList/PersistentList.cpp"
+#include "../DataStructures/LinearDataStructures/Stack/PersistentStack.cpp"
+
+namespace
+{
+    constexpr std::size_t versions{500};
+
+    /**
+     * @brief
+     * Copy of a SinglyLinkedList that owns its own nodes. The copy
+     * constructor would share the head, so it is rebuilt front to back.
+     */
+    SinglyLinkedList<std::uint64_t> deep_copy(const SinglyLinkedList<std::uint64_t> &list)
+    {
+        SinglyLinkedList<std::uint64_t> copy;
+
+        for (auto node{list.get_head()}; node != nullptr; node = node->get_next())
+            copy.push_front(node->get_data());
+
+        copy.reverse();
+
+        return copy;
+    }
+
+    /**
+     * @brief
+     * The shared_ptr nodes are freed recursively, so long lists are emptied
+     * one node at a time
+     */
+    void drain(SinglyLinkedList<std::uint64_t> &list)
+    {
+        while (!list.is_empty())
+            list.pop_front();
+    }
+
+    /**
+     * @brief
+     * Starting from a list of a given size, push a value and keep a
+     * snapshot of the result, the way an editor keeps its undo history
+     * @return double Elapsed milliseconds
+     */
+    double history_persistent(std::size_t size)
+    {
+        return bench::time_ms([&]
+                              {
+            PersistentList<std::uint64_t, false> current;
+            std::vector<PersistentList<std::uint64_t, false>> history;
+
+            for (std::size_t i{}; i < size; ++i)
+                current = current.push_front(i);
+
+            for (std::size_t i{}; i < versions; ++i)
+            {
+                current = current.push_front(i);
+                history.push_back(current);
+            }
+
+            bench::do_not_optimize(history.back().front()); });
+    }
+
+    double history_singly(std::size_t size)
+    {
+        return bench::time_ms([&]
+                              {
+            SinglyLinkedList<std::uint64_t> current;
+            std::vector<SinglyLinkedList<std::uint64_t>> history;
+
+            for (std::size_t i{}; i < size; ++i)
+                current.push_front(i);
+
+            for (std::size_t i{}; i < versions; ++i)
+            {
+                current.push_front(i);
+                history.push_back(deep_copy(current));
+            }
+
+            bench::do_not_optimize(history.back().get_front());
+
+            drain(current);
+
+            for (auto &list : history)
+                drain(list); });
+    }
+
+    /**
+     * @brief
+     * Push every value and pop them back, keeping one version at a time
+     * @return double Elapsed milliseconds
+     */
+    template <bool ThreadSafe>
+    double push_pop(const std::vector<std::uint64_t> &values)
+    {
+        return bench::time_ms([&]
+                              {
+            PersistentStack<std::uint64_t, ThreadSafe> stack;
+            std::uint64_t sum{};
+
+            for (auto const value : values)
+                stack = stack.push(value);
+
+            while (!stack.is_empty())
+            {
+                sum += stack.peek().value_or(0);
+                stack = stack.pop();
+            }
+
+            bench::do_not_optimize(sum); });
+    }
+
+    /**
+     * @brief
+     * Threads derive versions from a shared one and drop them again, while
+     * the shared version stays the same. A count touched without atomics
+     * shows up as a freed shared node or a wrong sum.
+     * @return bool Whether the check passed
+     */
+    bool stress(unsigned threads, std::size_t size, std::size_t rounds)
+    {
+        PersistentStack<std::uint64_t> shared;
+        std::uint64_t expected{};
+
+        for (std::uint64_t i{}; i < size; ++i)
+        {
+            shared = shared.push(i);
+            expected += i;
+        }
+
+        std::vector<std::thread> workers;
+        std::vector<char> passed(threads, 1);
+
+        for (unsigned t{}; t < threads; ++t)
+            workers.emplace_back([&, t]
+                                 {
+                                     for (std::size_t r{}; r < rounds; ++r)
+                                     {
+                                         auto stack{shared.push(t).push(r)};
+                                         std::uint64_t sum{};
+
+                                         for (stack = stack.pop().pop(); !stack.is_empty(); stack = stack.pop())
+                                             sum += stack.peek().value_or(0);
+
+                                         if (sum != expected)
+                                             passed[t] = 0;
+                                     } });
+
+        for (auto &worker : workers)
+            worker.join();
+
+        for (auto const ok : passed)
+            if (!ok)
+                return false;
+
+        return shared.get_size() == size;
+    }
+}
+
+int main()
+{
+    std::cout << versions << " snapshots, each after one push_front\n\n";
+
+    // The persistent runs go first: freeing millions of shared_ptr nodes
+    // leaves the allocator slow for the allocations that follow
+    for (std::size_t size : {1'000u, 4'000u, 10'000u})
+        bench::report("PersistentList (" + std::to_string(size) + " values)",
+                      history_persistent(size), versions);
+
+    std::cout << "\n";
+
+    for (std::size_t size : {1'000u, 4'000u, 10'000u})
+        bench::report("SinglyLinkedList deep copy (" + std::to_string(size) + " values)",
+                      history_singly(size), versions);
+
+    constexpr std::size_t n{2'000'000};
+
+    bench::Random random;
+    std::vector<std::uint64_t> values(n);
+
+    for (auto &value : values)
+        value = random.next();
+
+    std::cout << "\npush then pop " << n << " values\n";
+
+    bench::report("PersistentStack, atomic count", push_pop<true>(values), 2 * n);
+    bench::report("PersistentStack, plain count", push_pop<false>(values), 2 * n);
+
+    std::cout << "\nstress: 8 threads sharing one version... ";
+
+    if (!stress(8, 1'000, 2'000))
+    {
+        std::cout << "FAILED\n";
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "ok\n";
+}
@@ -0,0 +1,158 @@
+/**
+ * @file QuickSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief quick_sort against std::sort on random and adversarial inputs
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/QuickSort/QuickSort.h"
+
+namespace
+{
+    /**
+     * @brief
+     * McIlroy's adversary: the values are decided while the sort runs,
+     * always in the way that makes the current pivot as bad as possible.
+     * Sorting the indices with it gives an input that is adversarial for
+     * that particular sort.
+     */
+    class Adversary
+    {
+    public:
+        explicit Adversary(std::size_t n) : m_values(n, static_cast<int>(n)), m_gas{static_cast<int>(n)} {}
+
+        bool operator()(std::size_t x, std::size_t y)
+        {
+            if (m_values[x] == m_gas && m_values[y] == m_gas)
+                m_values[x == m_candidate ? x : y] = m_solid++;
+
+            if (m_values[x] == m_gas)
+                m_candidate = x;
+            else if (m_values[y] == m_gas)
+                m_candidate = y;
+
+            return m_values[x] < m_values[y];
+        }
+
+        std::vector<int> &values() { return m_values; }
+
+    private:
+        std::vector<int> m_values;
+        int m_gas;
+        int m_solid{};
+        std::size_t m_candidate{};
+    };
+
+    std::vector<int> adversarial(std::size_t n)
+    {
+        Adversary adversary{n};
+        std::vector<std::size_t> indices(n);
+
+        for (std::size_t i{}; i < n; ++i)
+            indices[i] = i;
+
+        quick_sort(indices.begin(), indices.end(), std::ref(adversary));
+
+        return adversary.values();
+    }
+
+    /**
+     * @brief
+     * Time one sort of a copy of the input and check the result
+     * @return double Elapsed milliseconds, negative if the output is not sorted
+     */
+    template <class Sort>
+    double measure(const std::vector<int> &input, Sort sort)
+    {
+        auto data{input};
+        auto const ms{bench::time_ms([&]
+                                     { sort(data); })};
+
+        return std::is_sorted(data.begin(), data.end()) ? ms : -1;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 10'000'000};
+
+    bench::Random random;
+    std::vector<std::pair<std::string, std::vector<int>>> inputs;
+
+    auto const generate{[&](const std::string &name, auto value)
+                        {
+                            std::vector<int> input(n);
+
+                            for (std::size_t i{}; i < n; ++i)
+                                input[i] = static_cast<int>(value(i));
+
+                            inputs.emplace_back(name, std::move(input));
+                        }};
+
+    generate("random", [&](std::size_t)
+             { return random.next(); });
+    generate("sorted", [](std::size_t i)
+             { return i; });
+    generate("reversed", [&](std::size_t i)
+             { return n - i; });
+    generate("all equal", [](std::size_t)
+             { return 7; });
+    generate("16 distinct", [&](std::size_t)
+             { return random.below(16); });
+    generate("organ pipe", [&](std::size_t i)
+             { return i < n / 2 ? i : n - i; });
+    generate("sawtooth", [](std::size_t i)
+             { return i % 1'000; });
+    generate("sorted, random tail", [&](std::size_t i)
+             { return i < n - n / 100 ? i : random.below(n); });
+    inputs.emplace_back("McIlroy adversary", adversarial(n));
+
+    bool sorted{true};
+
+    std::cout << n << " int per input\n";
+
+    for (auto const &[name, input] : inputs)
+    {
+        auto const std_ms{measure(input, [](auto &v)
+                                  { std::sort(v.begin(), v.end()); })};
+        auto const quick_ms{measure(input, [](auto &v)
+                                    { quick_sort(v.begin(), v.end()); })};
+
+        sorted = sorted && std_ms >= 0 && quick_ms >= 0;
+
+        std::cout << "\n";
+        bench::report("std::sort, " + name, std_ms, n);
+        bench::report("quick_sort, " + name, quick_ms, n);
+    }
+
+    // Comparisons made on the adversary, against N log2(N)
+    auto input{inputs.back().second};
+    std::uint64_t comparisons{};
+
+    quick_sort(input.begin(), input.end(), [&](int a, int b)
+               { ++comparisons;
+                 return a < b; });
+
+    std::cout << "\ncomparisons on the adversary: " << comparisons << " ("
+              << comparisons / (n * std::log2(static_cast<double>(n))) << " N log2(N))\n";
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
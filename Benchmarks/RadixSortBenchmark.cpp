@@ -0,0 +1,131 @@
+/**
+ * @file RadixSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief LSD radix sort with 8, 11 and 16-bit digits and the American flag
+ * MSD radix sort against std::sort, quick_sort and counting_sort on
+ * uniform and skewed 64-bit keys
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/CountingSort/CountingSort.h"
+#include "../Algorithms/ModenC++/Sort/QuickSort/QuickSort.h"
+#include "../Algorithms/ModenC++/Sort/RadixSort/RadixSort.h"
+
+namespace
+{
+    bool sorted{true};
+
+    /**
+     * @brief
+     * Time one sort of a copy of the input and check the result
+     * @return double Elapsed milliseconds
+     */
+    template <class T, class Sort>
+    double measure(const std::vector<T> &input, const std::vector<T> &expected, Sort sort)
+    {
+        auto data{input};
+        auto const ms{bench::time_ms([&]
+                                     { sort(data); })};
+
+        sorted = sorted && data == expected;
+
+        return ms;
+    }
+
+    template <class T>
+    void run(const std::string &name, const std::vector<T> &input, bool counting)
+    {
+        auto expected{input};
+        std::sort(expected.begin(), expected.end());
+
+        auto const suffix{", " + name};
+        auto const n{input.size()};
+
+        std::cout << "\n";
+        bench::report("std::sort" + suffix, measure(input, expected, [](auto &v)
+                                                    { std::sort(v.begin(), v.end()); }),
+                      n);
+        bench::report("quick_sort" + suffix, measure(input, expected, [](auto &v)
+                                                     { quick_sort(v.begin(), v.end()); }),
+                      n);
+        bench::report("lsd_radix_sort<8>" + suffix, measure(input, expected, [](auto &v)
+                                                            { lsd_radix_sort<8>(v.begin(), v.end()); }),
+                      n);
+        bench::report("lsd_radix_sort<11>" + suffix, measure(input, expected, [](auto &v)
+                                                             { lsd_radix_sort<11>(v.begin(), v.end()); }),
+                      n);
+        bench::report("lsd_radix_sort<16>" + suffix, measure(input, expected, [](auto &v)
+                                                             { lsd_radix_sort<16>(v.begin(), v.end()); }),
+                      n);
+        bench::report("msd_radix_sort" + suffix, measure(input, expected, [](auto &v)
+                                                         { msd_radix_sort(v.begin(), v.end()); }),
+                      n);
+
+        if (counting)
+            bench::report("counting_sort" + suffix, measure(input, expected, [](auto &v)
+                                                            { counting_sort(v.begin(), v.end()); }),
+                          n);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 10'000'000};
+
+    bench::Random random;
+    std::vector<std::uint64_t> keys(n);
+
+    std::cout << n << " keys per input\n";
+
+    for (auto &key : keys)
+        key = random.next();
+
+    run("uniform uint64_t", keys, false);
+
+    // Magnitudes spread evenly over 1 to 64 bits, most keys are small
+    for (auto &key : keys)
+        key = random.next() >> random.below(64);
+
+    run("skewed uint64_t", keys, false);
+
+    // Keys below 2^20 in a 64-bit type, the upper digits are skipped
+    for (auto &key : keys)
+        key = random.below(std::uint64_t{1} << 20);
+
+    run("20-bit uint64_t", keys, true);
+
+    // The same with a single outlier, counting_sort would need 2^63 counters
+    keys[n / 2] = std::uint64_t{1} << 63;
+
+    run("20-bit uint64_t, one outlier", keys, true);
+
+    std::vector<std::int64_t> signed_keys(n);
+    std::vector<double> doubles(n);
+
+    for (std::size_t i{}; i < n; ++i)
+    {
+        signed_keys[i] = static_cast<std::int64_t>(random.next());
+        doubles[i] = static_cast<double>(signed_keys[i]) / 1e6;
+    }
+
+    run("int64_t", signed_keys, false);
+    run("double", doubles, true);
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
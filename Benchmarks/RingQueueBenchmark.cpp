@@ -0,0 +1,91 @@
+/**
+ * @file RingQueueBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief RingQueue against the node-based Queue
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Queue/Queue.cpp"
+#include "../DataStructures/LinearDataStructures/Queue/RingQueue.cpp"
+
+int main()
+{
+    constexpr std::size_t n{1'000'000};
+    constexpr std::size_t window{1'024};
+    constexpr std::size_t batch{64};
+
+    std::vector<std::uint64_t> values(n);
+    bench::Random random;
+
+    for (auto &value : values)
+        value = random.next();
+
+    std::cout << "n = " << n << " enqueues then dequeues, then a steady "
+              << window << "-element window\n\n";
+
+    {
+        Queue<std::uint64_t> queue{0};
+
+        bench::report("Queue::enqueue", bench::time_ms([&]
+                      { for (auto const value : values) queue.enqueue(value); }), n);
+
+        bench::report("Queue::dequeue", bench::time_ms([&]
+                      { while (!queue.is_empty())
+                            bench::do_not_optimize(queue.dequeue()); }), n);
+
+        for (std::size_t i{}; i < window; ++i)
+            queue.enqueue(values[i]);
+
+        bench::report("Queue::enqueue + dequeue (window)", bench::time_ms([&]
+                      { for (auto const value : values)
+                        {
+                            queue.enqueue(value);
+                            bench::do_not_optimize(queue.dequeue());
+                        } }), 2 * n);
+
+        while (!queue.is_empty())
+            queue.dequeue();
+    }
+
+    {
+        RingQueue<std::uint64_t> queue;
+
+        bench::report("RingQueue::enqueue (growing)", bench::time_ms([&]
+                      { for (auto const value : values) queue.enqueue(value); }), n);
+
+        bench::report("RingQueue::dequeue", bench::time_ms([&]
+                      { while (!queue.is_empty())
+                            bench::do_not_optimize(queue.dequeue()); }), n);
+
+        for (std::size_t i{}; i < window; ++i)
+            queue.enqueue(values[i]);
+
+        bench::report("RingQueue::enqueue + dequeue (window)", bench::time_ms([&]
+                      { for (auto const value : values)
+                        {
+                            queue.enqueue(value);
+                            bench::do_not_optimize(queue.dequeue());
+                        } }), 2 * n);
+
+        std::vector<std::uint64_t> out(batch);
+
+        bench::report("RingQueue::push_range + pop_n (64, window)", bench::time_ms([&]
+                      { for (std::size_t i{}; i < n; i += batch)
+                        {
+                            queue.push_range(values.begin() + i,
+                                             values.begin() + std::min(i + batch, n));
+                            queue.pop_n(out.begin(), batch);
+                            bench::do_not_optimize(out[0]);
+                        } }), 2 * n);
+    }
+}
@@ -0,0 +1,77 @@
+/**
+ * @file RingStackBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief RingStack against the node-based Stack
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Stack/Stack.cpp"
+#include "../DataStructures/LinearDataStructures/Stack/RingStack.cpp"
+
+int main()
+{
+    constexpr std::size_t n{1'000'000};
+    constexpr std::size_t batch{64};
+
+    std::vector<std::uint64_t> values(n);
+    bench::Random random;
+
+    for (auto &value : values)
+        value = random.next();
+
+    std::cout << "n = " << n << " pushes then pops\n\n";
+
+    {
+        // The node Stack counts its remaining capacity down in m_size
+        Stack<std::uint64_t> stack{n};
+
+        bench::report("Stack::push", bench::time_ms([&]
+                      { for (auto const value : values) stack.push(value); }), n);
+
+        bench::report("Stack::peek + pop", bench::time_ms([&]
+                      { while (!stack.is_empty())
+                        {
+                            bench::do_not_optimize(stack.peek());
+                            stack.pop();
+                        } }), n);
+    }
+
+    {
+        RingStack<std::uint64_t> stack;
+
+        bench::report("RingStack::push (growing)", bench::time_ms([&]
+                      { for (auto const value : values) stack.push(value); }), n);
+
+        bench::report("RingStack::peek + pop", bench::time_ms([&]
+                      { while (!stack.is_empty())
+                        {
+                            bench::do_not_optimize(stack.peek());
+                            stack.pop();
+                        } }), n);
+
+        bench::report("RingStack::push (reserved)", bench::time_ms([&]
+                      { for (auto const value : values) stack.push(value); }), n);
+
+        std::vector<std::uint64_t> out(batch);
+
+        bench::report("RingStack::pop_n (64 at a time)", bench::time_ms([&]
+                      { while (stack.pop_n(out.begin(), batch) != 0)
+                            bench::do_not_optimize(out[0]); }), n);
+
+        bench::report("RingStack::push_range (64 at a time)", bench::time_ms([&]
+                      { for (std::size_t i{}; i < n; i += batch)
+                            stack.push_range(values.begin() + i,
+                                             values.begin() + std::min(i + batch, n)); }), n);
+    }
+}
@@ -0,0 +1,200 @@
+/**
+ * @file SPSCQueueBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief SPSCQueue against a Queue behind a std::mutex: producer/consumer
+ * throughput and ping-pong latency with both threads pinned to cores
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <pthread.h>
+#include <sched.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "LockedQueue.h"
+#include "../DataStructures/LinearDataStructures/Queue/SPSCQueue.cpp"
+
+namespace
+{
+    /**
+     * @brief
+     * Pin the calling thread to a core, wrapping around the available ones
+     * @param core Index of the core
+     */
+    void pin(unsigned core)
+    {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(core % std::thread::hardware_concurrency(), &set);
+        pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    }
+
+    /**
+     * @brief
+     * Run a producer loop and a consumer loop on two pinned threads
+     * @return double Elapsed milliseconds until both are done
+     */
+    template <class Producer, class Consumer>
+    double transfer(Producer producer, Consumer consumer)
+    {
+        return bench::time_ms([&]
+                              {
+            std::thread thread{[&]
+                               {
+                                   pin(0);
+                                   producer(); }};
+
+            pin(1);
+            consumer();
+            thread.join(); });
+    }
+
+    /**
+     * @brief
+     * Bounce a token between two threads through two queues
+     * @return double Average round trip in nanoseconds
+     */
+    template <class Channel>
+    double ping_pong(std::uint64_t rounds, Channel &ping, Channel &pong)
+    {
+        auto const ms{bench::time_ms([&]
+                                     {
+            std::thread echo{[&]
+                             {
+                                 pin(1);
+
+                                 for (std::uint64_t i{}; i < rounds; ++i)
+                                 {
+                                     std::optional<std::uint64_t> token;
+
+                                     while (!(token = ping.try_pop()))
+                                         std::this_thread::yield();
+
+                                     pong.try_push(*token);
+                                 } }};
+
+            pin(0);
+
+            for (std::uint64_t i{}; i < rounds; ++i)
+            {
+                ping.try_push(i);
+
+                while (!pong.try_pop())
+                    std::this_thread::yield();
+            }
+
+            echo.join(); })};
+
+        return ms * 1e6 / rounds;
+    }
+}
+
+int main()
+{
+    constexpr std::uint64_t count{2'000'000};
+    constexpr std::uint64_t rounds{100'000};
+    constexpr std::size_t capacity{1'024};
+    constexpr std::size_t batch{64};
+
+    std::cout << "1 producer, 1 consumer, " << count << " uint64, "
+              << std::thread::hardware_concurrency() << " core(s)\n\n";
+
+    {
+        bench::LockedQueue<std::uint64_t> queue;
+        std::uint64_t sum{};
+
+        bench::report("mutex + Queue", transfer([&]
+                                                { for (std::uint64_t i{}; i < count; ++i)
+                                                      queue.try_push(i); },
+                                                [&]
+                                                { for (std::uint64_t received{}; received < count;)
+                                                      if (auto const value{queue.try_pop()})
+                                                      {
+                                                          sum += *value;
+                                                          ++received;
+                                                      }
+                                                      else
+                                                          std::this_thread::yield(); }),
+                      count);
+
+        bench::do_not_optimize(sum);
+    }
+
+    {
+        SPSCQueue<std::uint64_t> queue{capacity};
+        std::uint64_t sum{};
+
+        bench::report("SPSCQueue::try_push/try_pop", transfer([&]
+                                                              { for (std::uint64_t i{}; i < count;)
+                                                                    if (queue.try_push(i))
+                                                                        ++i;
+                                                                    else
+                                                                        std::this_thread::yield(); },
+                                                              [&]
+                                                              { for (std::uint64_t received{}; received < count;)
+                                                                    if (auto const value{queue.try_pop()})
+                                                                    {
+                                                                        sum += *value;
+                                                                        ++received;
+                                                                    }
+                                                                    else
+                                                                        std::this_thread::yield(); }),
+                      count);
+
+        bench::do_not_optimize(sum);
+    }
+
+    {
+        SPSCQueue<std::uint64_t> queue{capacity};
+        std::vector<std::uint64_t> in(count);
+        std::vector<std::uint64_t> out(batch);
+        std::uint64_t sum{};
+
+        for (std::uint64_t i{}; i < count; ++i)
+            in[i] = i;
+
+        bench::report("SPSCQueue::try_push_n/try_pop_n (64)", transfer([&]
+                                                                       { for (std::uint64_t sent{}; sent < count;)
+                                                                             if (auto const n{queue.try_push_n(in.begin() + sent, std::min<std::uint64_t>(batch, count - sent))})
+                                                                                 sent += n;
+                                                                             else
+                                                                                 std::this_thread::yield(); },
+                                                                       [&]
+                                                                       { for (std::uint64_t received{}; received < count;)
+                                                                             if (auto const n{queue.try_pop_n(out.begin(), batch)})
+                                                                             {
+                                                                                 for (std::size_t i{}; i < n; ++i)
+                                                                                     sum += out[i];
+
+                                                                                 received += n;
+                                                                             }
+                                                                             else
+                                                                                 std::this_thread::yield(); }),
+                      count);
+
+        bench::do_not_optimize(sum);
+    }
+
+    std::cout << "\nping-pong round trip, " << rounds << " rounds\n\n";
+
+    {
+        bench::LockedQueue<std::uint64_t> ping, pong;
+        std::cout << "mutex + Queue                " << ping_pong(rounds, ping, pong)
+                  << " ns\n";
+    }
+
+    {
+        SPSCQueue<std::uint64_t> ping{capacity}, pong{capacity};
+        std::cout << "SPSCQueue                    " << ping_pong(rounds, ping, pong)
+                  << " ns\n";
+    }
+}
@@ -0,0 +1,129 @@
+/**
+ * @file SimdSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief simd_sort with AVX-512 and AVX2 against quick_sort and std::sort
+ * on int32_t, uint64_t and float keys
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/QuickSort/QuickSort.h"
+#include "../Algorithms/ModenC++/Sort/SimdSort/SimdSort.h"
+
+namespace
+{
+    bool sorted{true};
+
+    /**
+     * @brief
+     * Time one sort of a copy of the input and check the result against
+     * std::sort
+     * @return double Elapsed milliseconds
+     */
+    template <class T, class Sort>
+    double measure(const std::vector<T> &input, const std::vector<T> &expected, Sort sort)
+    {
+        auto data{input};
+        auto const ms{bench::time_ms([&]
+                                     { sort(data); })};
+
+        sorted = sorted && data == expected;
+
+        return ms;
+    }
+
+    template <class T, class Generate>
+    void run(const std::string &name, std::size_t n, Generate generate)
+    {
+        std::vector<T> input(n);
+
+        for (auto &value : input)
+            value = generate();
+
+        auto expected{input};
+        std::sort(expected.begin(), expected.end());
+
+        auto const suffix{", " + name};
+
+        std::cout << "\n";
+        bench::report("std::sort" + suffix, measure(input, expected, [](auto &v)
+                                                    { std::sort(v.begin(), v.end()); }),
+                      n);
+        bench::report("quick_sort" + suffix, measure(input, expected, [](auto &v)
+                                                     { quick_sort(v.begin(), v.end()); }),
+                      n);
+
+        if (simd_supported_level() >= SimdLevel::avx2)
+            bench::report("simd_sort AVX2" + suffix, measure(input, expected, [](auto &v)
+                                                             { simd_sort(v.begin(), v.end(), SimdLevel::avx2); }),
+                          n);
+
+        if (simd_supported_level() >= SimdLevel::avx512)
+            bench::report("simd_sort AVX-512" + suffix, measure(input, expected, [](auto &v)
+                                                                { simd_sort(v.begin(), v.end(), SimdLevel::avx512); }),
+                          n);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const n{argc > 1 ? std::stoull(argv[1]) : 10'000'000};
+
+    bench::Random random;
+
+    static char const *const levels[]{"scalar", "AVX2", "AVX-512"};
+
+    std::cout << n << " keys per input, best instruction set: "
+              << levels[static_cast<int>(simd_supported_level())] << "\n";
+
+    run<std::int32_t>("int32_t random", n, [&]
+                      { return static_cast<std::int32_t>(random.next()); });
+    run<std::int32_t>("int32_t 100 distinct", n, [&]
+                      { return static_cast<std::int32_t>(random.below(100)); });
+    run<std::uint64_t>("uint64_t random", n, [&]
+                       { return random.next(); });
+    run<float>("float random", n, [&]
+               { return static_cast<float>(static_cast<std::int32_t>(random.next())) / 1024.0f; });
+
+    // Small arrays, the size of the blocks a column store sorts at once
+    std::uint64_t const small_n{1'000};
+    std::vector<std::int32_t> small(small_n * 1'000);
+
+    for (auto &value : small)
+        value = static_cast<std::int32_t>(random.next());
+
+    auto const batches{[&](auto sort)
+                       {
+                           auto data{small};
+
+                           return bench::time_ms([&]
+                                                 {
+                               for (auto it{data.begin()}; it != data.end(); it += small_n)
+                                   sort(it, it + small_n); });
+                       }};
+
+    std::cout << "\n";
+    bench::report("std::sort, 1000 x 1000 int32_t", batches([](auto first, auto last)
+                                                          { std::sort(first, last); }),
+                  small.size());
+    bench::report("simd_sort, 1000 x 1000 int32_t", batches([](auto first, auto last)
+                                                          { simd_sort(first, last); }),
+                  small.size());
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
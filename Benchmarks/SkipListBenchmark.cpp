@@ -0,0 +1,77 @@
+/**
+ * @file SkipListBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief SkipList against SinglyLinkedList: search and indexed access
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/LinkedLists/SinglyLinkedList/SinglyLinkedList.cpp"
+#include "../DataStructures/LinearDataStructures/LinkedLists/SkipList/SkipList.cpp"
+
+int main()
+{
+    constexpr std::size_t queries{2'000};
+
+    for (std::size_t n : {1'000, 10'000, 50'000})
+    {
+        bench::Random random{n};
+        std::vector<int> values(n);
+
+        for (auto &value : values)
+            value = static_cast<int>(random.below(n * 4));
+
+        std::cout << "n = " << n << "\n";
+
+        SinglyLinkedList<int> list;
+        SkipList<int> skip_list;
+
+        bench::report("SinglyLinkedList::push_front", bench::time_ms([&]
+                      { for (auto value : values) list.push_front(value); }), n);
+        bench::report("SkipList::insert", bench::time_ms([&]
+                      { for (auto value : values) skip_list.insert(value); }), n);
+
+        std::size_t found{};
+        bench::report("SinglyLinkedList::contains", bench::time_ms([&]
+                      { for (std::size_t i{}; i < queries; ++i)
+                            found += list.contains(static_cast<int>(random.below(n * 4))); }),
+                      queries);
+        bench::report("SkipList::contains", bench::time_ms([&]
+                      { for (std::size_t i{}; i < queries; ++i)
+                            found += skip_list.contains(static_cast<int>(random.below(n * 4))); }),
+                      queries);
+
+        long long sum{};
+        bench::report("SinglyLinkedList::get_at_index", bench::time_ms([&]
+                      { for (std::size_t i{}; i < queries; ++i)
+                            sum += list.get_at_index(random.below(n)); }),
+                      queries);
+        bench::report("SkipList::at", bench::time_ms([&]
+                      { for (std::size_t i{}; i < queries; ++i)
+                            sum += skip_list.at(random.below(n)); }),
+                      queries);
+        bench::report("SkipList::rank (lower_bound walk)", bench::time_ms([&]
+                      { for (std::size_t i{}; i < queries; ++i)
+                            sum += skip_list.rank(static_cast<int>(random.below(n * 4))); }),
+                      queries);
+        bench::report("SkipList::slice (top 100)", bench::time_ms([&]
+                      { for (std::size_t i{}; i < queries; ++i)
+                            for (auto value : skip_list.slice(n - 100, 100))
+                                sum += value; }),
+                      queries * 100);
+
+        bench::do_not_optimize(found);
+        bench::do_not_optimize(sum);
+        std::cout << "SkipList pool: " << skip_list.reserved_bytes()
+                  << " bytes reserved, height " << skip_list.get_height()
+                  << "\n\n";
+    }
+}
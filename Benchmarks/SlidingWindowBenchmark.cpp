@@ -0,0 +1,165 @@
+/**
+ * @file SlidingWindowBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief MonotonicQueue and WindowAggregator against a std::multiset over
+ * sliding windows of 1K to 1M values, one at a time and in batches
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Queue/SlidingWindow/MonotonicQueue.cpp"
+#include "../DataStructures/LinearDataStructures/Queue/SlidingWindow/WindowAggregator.cpp"
+
+namespace
+{
+    constexpr std::size_t n{4'000'000};
+    constexpr std::size_t batch{4'096};
+
+    struct Min
+    {
+        std::uint32_t operator()(std::uint32_t lhs, std::uint32_t rhs) const
+        {
+            return std::min(lhs, rhs);
+        }
+    };
+
+    /**
+     * @brief
+     * Push every value and read the aggregate after each one
+     * @return double Elapsed milliseconds
+     */
+    template <class Push, class Query>
+    double stream(const std::vector<std::uint32_t> &values, Push push, Query query)
+    {
+        return bench::time_ms([&]
+                              {
+            std::uint64_t checksum{};
+
+            for (auto const value : values)
+            {
+                push(value);
+                checksum += query();
+            }
+
+            bench::do_not_optimize(checksum); });
+    }
+
+    /**
+     * @brief
+     * Push the values in batches and read the aggregate after each batch
+     * @return double Elapsed milliseconds
+     */
+    template <class Window, class Query>
+    double batches(const std::vector<std::uint32_t> &values, Window &window, Query query)
+    {
+        return bench::time_ms([&]
+                              {
+            std::uint64_t checksum{};
+
+            for (std::size_t i{}; i < values.size(); i += batch)
+            {
+                auto const end{std::min(values.size(), i + batch)};
+
+                window.push_range(values.begin() + i, values.begin() + end);
+                checksum += query();
+            }
+
+            bench::do_not_optimize(checksum); });
+    }
+}
+
+int main()
+{
+    std::vector<std::uint32_t> values(n);
+    bench::Random random;
+
+    for (auto &value : values)
+        value = static_cast<std::uint32_t>(random.next());
+
+    std::cout << n << " values per run, batches of " << batch << "\n";
+
+    for (std::size_t window : {1'000u, 10'000u, 100'000u, 1'000'000u})
+    {
+        auto const suffix{" (window " + std::to_string(window) + ")"};
+
+        std::cout << "\n";
+
+        {
+            std::multiset<std::uint32_t> set;
+            std::size_t oldest{};
+
+            bench::report("std::multiset min" + suffix,
+                          stream(values, [&](std::uint32_t value)
+                                 {
+                                     if (set.size() == window)
+                                         set.erase(set.find(values[oldest++]));
+
+                                     set.insert(value); },
+                                 [&]
+                                 { return *set.begin(); }),
+                          n);
+        }
+
+        {
+            MonotonicQueue<std::uint32_t> queue{window};
+
+            bench::report("MonotonicQueue min" + suffix,
+                          stream(values, [&](std::uint32_t value)
+                                 { queue.push(value); },
+                                 [&]
+                                 { return *queue.peek(); }),
+                          n);
+        }
+
+        {
+            WindowAggregator<std::uint32_t, Min> aggregator{window, UINT32_MAX};
+
+            bench::report("WindowAggregator min" + suffix,
+                          stream(values, [&](std::uint32_t value)
+                                 { aggregator.push(value); },
+                                 [&]
+                                 { return aggregator.query(); }),
+                          n);
+        }
+
+        {
+            WindowAggregator<std::uint64_t> aggregator{window};
+
+            bench::report("WindowAggregator sum" + suffix,
+                          stream(values, [&](std::uint32_t value)
+                                 { aggregator.push(value); },
+                                 [&]
+                                 { return aggregator.query(); }),
+                          n);
+        }
+
+        {
+            MonotonicQueue<std::uint32_t> queue{window};
+
+            bench::report("MonotonicQueue min, push_range" + suffix,
+                          batches(values, queue, [&]
+                                  { return *queue.peek(); }),
+                          n);
+        }
+
+        {
+            WindowAggregator<std::uint64_t> aggregator{window};
+
+            bench::report("WindowAggregator sum, push_range" + suffix,
+                          batches(values, aggregator, [&]
+                                  { return aggregator.query(); }),
+                          n);
+        }
+    }
+}
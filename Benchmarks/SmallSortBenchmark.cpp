@@ -0,0 +1,145 @@
+/**
+ * @file SmallSortBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief small_sort (sorting networks up to 16 elements), insertion sorts
+ * and std::sort on batches of arrays of 2 to 64 elements, plus the
+ * comparisons of binary insertion sort on strings
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../Algorithms/ModenC++/Sort/InsertionSort/InsertionSort.h"
+#include "../Algorithms/ModenC++/Sort/SmallSort/SmallSort.h"
+
+namespace
+{
+    bool sorted{true};
+
+    /**
+     * @brief
+     * Sort every array of a copy of the batch and check them. The arrays
+     * are laid out every n + 1 elements, each one after a 0 that serves as
+     * the sentinel of unguarded_insertion_sort().
+     * @return double Elapsed milliseconds
+     */
+    template <class Sort>
+    double measure(const std::vector<std::uint32_t> &batch, std::size_t n, Sort sort)
+    {
+        auto data{batch};
+
+        auto const ms{bench::time_ms([&]
+                                     {
+            for (auto it{data.begin()}; it != data.end(); it += n + 1)
+                sort(it + 1, it + 1 + n); })};
+
+        for (auto it{data.begin()}; it != data.end(); it += n + 1)
+            sorted = sorted && std::is_sorted(it + 1, it + 1 + n);
+
+        return ms;
+    }
+
+    /**
+     * @brief
+     * Average comparisons to sort arrays of n strings that share a long
+     * prefix, so that every comparison walks most of the string
+     */
+    template <class Sort>
+    double comparisons(std::size_t n, Sort sort)
+    {
+        constexpr std::size_t ARRAYS{1000};
+
+        bench::Random random;
+        std::uint64_t count{};
+
+        auto const cmp{[&](const std::string &a, const std::string &b)
+                       { ++count;
+                         return a < b; }};
+
+        for (std::size_t array{}; array < ARRAYS; ++array)
+        {
+            std::vector<std::string> strings(n);
+
+            for (auto &string : strings)
+                string = std::string(32, 'x') + std::to_string(random.next());
+
+            sort(strings.begin(), strings.end(), cmp);
+            sorted = sorted && std::is_sorted(strings.begin(), strings.end());
+        }
+
+        return static_cast<double>(count) / ARRAYS;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    std::size_t const total{argc > 1 ? std::stoull(argv[1]) : 10'000'000};
+
+    bench::Random random;
+
+    std::cout << "about " << total << " uint32_t per size, in arrays of n\n";
+
+    for (std::size_t n : {2u, 3u, 4u, 6u, 8u, 12u, 16u, 24u, 32u, 48u, 64u})
+    {
+        auto const arrays{total / n};
+        std::vector<std::uint32_t> batch(arrays * (n + 1));
+
+        for (std::size_t i{}; i < batch.size(); ++i)
+            batch[i] = i % (n + 1) == 0 ? 0 : static_cast<std::uint32_t>(random.below(1u << 31)) + 1;
+
+        auto const suffix{" (n = " + std::to_string(n) + ")"};
+        auto const elements{arrays * n};
+
+        std::cout << "\n";
+
+        bench::report("std::sort" + suffix, measure(batch, n, [](auto first, auto last)
+                                                    { std::sort(first, last); }),
+                      elements);
+        bench::report("insertion_sort" + suffix, measure(batch, n, [](auto first, auto last)
+                                                         { insertion_sort(first, last); }),
+                      elements);
+        bench::report("unguarded_insertion_sort" + suffix, measure(batch, n, [](auto first, auto last)
+                                                                   { unguarded_insertion_sort(first, last); }),
+                      elements);
+        bench::report("binary_insertion_sort" + suffix, measure(batch, n, [](auto first, auto last)
+                                                                { binary_insertion_sort(first, last); }),
+                      elements);
+        bench::report("small_sort" + suffix, measure(batch, n, [](auto first, auto last)
+                                                     { small_sort(first, last); }),
+                      elements);
+    }
+
+    std::cout << "\ncomparisons per array of strings\n"
+              << std::setw(8) << "n" << std::setw(18) << "insertion_sort"
+              << std::setw(24) << "binary_insertion_sort" << std::setw(14) << "small_sort"
+              << std::setw(12) << "std::sort\n";
+
+    for (std::size_t n : {4u, 8u, 16u, 32u, 64u})
+        std::cout << std::setw(8) << n << std::fixed << std::setprecision(1)
+                  << std::setw(18) << comparisons(n, [](auto first, auto last, auto cmp)
+                                                  { insertion_sort(first, last, cmp); })
+                  << std::setw(24) << comparisons(n, [](auto first, auto last, auto cmp)
+                                                  { binary_insertion_sort(first, last, cmp); })
+                  << std::setw(14) << comparisons(n, [](auto first, auto last, auto cmp)
+                                                  { small_sort(first, last, cmp); })
+                  << std::setw(11) << comparisons(n, [](auto first, auto last, auto cmp)
+                                                  { std::sort(first, last, cmp); })
+                  << "\n";
+
+    if (!sorted)
+    {
+        std::cout << "\noutput not sorted\n";
+        return EXIT_FAILURE;
+    }
+}
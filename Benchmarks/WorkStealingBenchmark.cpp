@@ -0,0 +1,161 @@
+/**
+ * @file WorkStealingBenchmark.cpp
+ * @author Carlos Salguero
+ * @brief WorkStealingDeque owner operations and the fork-join ThreadPool
+ * on a recursive fib and a parallel sum
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "Benchmark.h"
+#include "../DataStructures/LinearDataStructures/Stack/Stack.cpp"
+#include "../DataStructures/Concurrency/ThreadPool.h"
+
+namespace
+{
+    constexpr int FIB_CUTOFF = 20;
+
+    std::uint64_t fib(int n)
+    {
+        return n < 2 ? n : fib(n - 1) + fib(n - 2);
+    }
+
+    /**
+     * @brief
+     * Fork both recursive calls down to the cutoff, then finish sequentially
+     */
+    std::uint64_t fib(ThreadPool &pool, int n)
+    {
+        if (n < FIB_CUTOFF)
+            return fib(n);
+
+        std::uint64_t left{}, right{};
+        pool.invoke([&]
+                    { left = fib(pool, n - 1); },
+                    [&]
+                    { right = fib(pool, n - 2); });
+
+        return left + right;
+    }
+
+    /**
+     * @brief
+     * Sum of a range, split in halves with invoke() down to the grain
+     */
+    std::uint64_t sum(ThreadPool &pool, const std::uint64_t *first,
+                      const std::uint64_t *last, std::size_t grain)
+    {
+        if (static_cast<std::size_t>(last - first) <= grain)
+            return std::accumulate(first, last, std::uint64_t{});
+
+        auto const *middle{first + (last - first) / 2};
+        std::uint64_t left{}, right{};
+
+        pool.invoke([&]
+                    { left = sum(pool, first, middle, grain); },
+                    [&]
+                    { right = sum(pool, middle, last, grain); });
+
+        return left + right;
+    }
+}
+
+int main()
+{
+    constexpr std::uint64_t n{10'000'000};
+    // volatile so that the sequential fib is not folded at compile time
+    volatile int fib_n{34};
+    constexpr std::size_t values{1 << 24};
+    constexpr std::size_t grain{1 << 14};
+
+    std::cout << std::thread::hardware_concurrency() << " core(s)\n\n"
+              << "owner push then pop, " << n << " elements\n";
+
+    {
+        // The node Stack counts its remaining capacity down in m_size
+        Stack<std::uint64_t> stack{n};
+        bench::report("Stack push/pop", bench::time_ms([&]
+                                                       {
+            for (std::uint64_t i{}; i < n; ++i)
+                stack.push(i);
+
+            std::uint64_t total{};
+
+            while (!stack.is_empty())
+            {
+                total += stack.peek().value_or(0);
+                stack.pop();
+            }
+
+            bench::do_not_optimize(total); }),
+                      2 * n);
+    }
+
+    {
+        WorkStealingDeque<std::uint64_t> deque;
+        bench::report("WorkStealingDeque push/pop", bench::time_ms([&]
+                                                                   {
+            for (std::uint64_t i{}; i < n; ++i)
+                deque.push(i);
+
+            std::uint64_t total{};
+
+            while (auto const value{deque.pop()})
+                total += *value;
+
+            bench::do_not_optimize(total); }),
+                      2 * n);
+    }
+
+    auto const expected_fib{fib(fib_n)};
+    std::vector<std::uint64_t> data(values);
+    std::iota(data.begin(), data.end(), std::uint64_t{});
+    auto const expected_sum{std::accumulate(data.begin(), data.end(), std::uint64_t{})};
+
+    std::cout << "\nfib(" << fib_n << "), sequential below " << FIB_CUTOFF
+              << "; sum of " << values << " values, grain " << grain << "\n";
+
+    bench::report("sequential fib", bench::time_ms([&]
+                                                   { bench::do_not_optimize(fib(fib_n)); }),
+                  expected_fib);
+    bench::report("sequential sum", bench::time_ms([&]
+                                                   { bench::do_not_optimize(std::accumulate(
+                                                         data.begin(), data.end(), std::uint64_t{})); }),
+                  values);
+
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u})
+    {
+        ThreadPool pool{threads};
+        auto const suffix{" (" + std::to_string(threads) + " workers)"};
+        std::uint64_t fib_result{}, sum_result{};
+
+        std::cout << "\n";
+
+        bench::report("ThreadPool fib" + suffix, bench::time_ms([&]
+                                                               { pool.run([&]
+                                                                          { fib_result = fib(pool, fib_n); }); }),
+                      expected_fib);
+        bench::report("ThreadPool sum" + suffix, bench::time_ms([&]
+                                                               { pool.run([&]
+                                                                          { sum_result = sum(pool, data.data(),
+                                                                                             data.data() + data.size(), grain); }); }),
+                      values);
+
+        if (fib_result != expected_fib || sum_result != expected_sum)
+        {
+            std::cout << "wrong result\n";
+            return EXIT_FAILURE;
+        }
+    }
+}
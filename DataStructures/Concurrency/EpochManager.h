@@ -0,0 +1,305 @@
+/**
+ * @file EpochManager.h
+ * @author Carlos Salguero
+ * @brief Epoch-based memory reclamation for the lock-free data structures
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef EPOCH_MANAGER_H
+#define EPOCH_MANAGER_H
+
+#include <algorithm> // std::max()
+#include <array>
+#include <atomic>
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <limits>    // std::numeric_limits
+#include <mutex>     // std::mutex, std::lock_guard
+#include <stdexcept> // std::runtime_error
+#include <vector>
+
+/**
+ * @brief
+ * Process-wide epoch-based reclamation domain.
+ *
+ * A thread pins the current epoch (through a Guard) before reading shared
+ * nodes and unpins it when it is done. Unlinked nodes are retired instead
+ * of deleted; a node retired in epoch e is deleted once the global epoch
+ * reaches e + 2, because by then every thread that could still see it has
+ * unpinned. The global epoch only advances when every pinned thread has
+ * observed the current one.
+ */
+class EpochManager
+{
+public:
+    static constexpr std::size_t MAX_THREADS = 256;
+    static constexpr std::size_t COLLECT_THRESHOLD = 64;
+
+    /**
+     * @brief
+     * RAII pin of the current epoch. Guards may be nested.
+     */
+    class Guard
+    {
+    public:
+        explicit Guard(EpochManager &manager) : m_manager{manager}
+        {
+            m_manager.enter();
+        }
+
+        Guard(const Guard &) = delete;
+        Guard &operator=(const Guard &) = delete;
+
+        ~Guard() { m_manager.exit(); }
+
+    private:
+        EpochManager &m_manager;
+    };
+
+    EpochManager(const EpochManager &) = delete;
+    EpochManager &operator=(const EpochManager &) = delete;
+
+    /**
+     * @brief
+     * Get the process-wide manager
+     * @return EpochManager& The manager
+     */
+    static EpochManager &instance()
+    {
+        static EpochManager manager;
+        return manager;
+    }
+
+    /**
+     * @brief
+     * Pin the current epoch for the lifetime of the returned guard
+     * @return Guard Pin of the calling thread
+     * @time complexity O(1)
+     * @space complexity O(1)
+     */
+    Guard pin() { return Guard{*this}; }
+
+    /**
+     * @brief
+     * Defer the deletion of an unlinked node until no pinned thread can
+     * reach it
+     * @param pointer Node that is no longer reachable from the structure
+     * @param deleter Function releasing the node
+     * @time complexity O(1) amortized
+     * @space complexity O(1)
+     */
+    void retire(void *pointer, void (*deleter)(void *))
+    {
+        auto &slot{local()};
+
+        slot.retired.push_back(
+            Retired{pointer, deleter, m_epoch.load(std::memory_order_seq_cst)});
+
+        if (slot.retired.size() >= slot.collect_at)
+        {
+            collect(slot);
+
+            // If a pinned thread holds the epoch back, most nodes survive the
+            // collection; waiting for the list to double keeps retire O(1)
+            // amortized instead of rescanning it on every call
+            slot.collect_at = std::max(COLLECT_THRESHOLD, 2 * slot.retired.size());
+        }
+    }
+
+    /**
+     * @brief
+     * Retire a node allocated with new
+     * @tparam T Type of the node
+     * @param pointer Node that is no longer reachable from the structure
+     */
+    template <class T>
+    void retire(T *pointer)
+    {
+        retire(pointer, [](void *node)
+               { delete static_cast<T *>(node); });
+    }
+
+    /**
+     * @brief
+     * Try to advance the epoch and delete whatever the calling thread
+     * retired that is already safe to delete
+     * @time complexity O(MAX_THREADS + r), r retired nodes
+     * @space complexity O(1)
+     */
+    void flush() { collect(local()); }
+
+    /**
+     * @brief
+     * Get the current global epoch
+     * @return std::uint64_t Global epoch
+     */
+    std::uint64_t get_epoch() const
+    {
+        return m_epoch.load(std::memory_order_acquire);
+    }
+
+private:
+    static constexpr std::uint64_t QUIESCENT =
+        std::numeric_limits<std::uint64_t>::max();
+
+    struct Retired
+    {
+        void *pointer;
+        void (*deleter)(void *);
+        std::uint64_t epoch;
+    };
+
+    struct alignas(64) Slot
+    {
+        std::atomic<std::uint64_t> epoch{QUIESCENT};
+        std::atomic<bool> claimed{false};
+        std::size_t depth{};
+        std::size_t collect_at{COLLECT_THRESHOLD};
+        std::vector<Retired> retired;
+    };
+
+    /**
+     * @brief
+     * Registration of a thread. Releases the slot when the thread exits and
+     * hands whatever is still pending to the orphan list.
+     */
+    struct Registration
+    {
+        EpochManager *manager{};
+        Slot *slot{};
+
+        ~Registration()
+        {
+            if (slot == nullptr)
+                return;
+
+            {
+                std::lock_guard lock{manager->m_orphans_mutex};
+                manager->m_orphans.insert(manager->m_orphans.end(),
+                                          slot->retired.begin(),
+                                          slot->retired.end());
+            }
+
+            slot->retired.clear();
+            slot->collect_at = COLLECT_THRESHOLD;
+            slot->epoch.store(QUIESCENT, std::memory_order_release);
+            slot->claimed.store(false, std::memory_order_release);
+        }
+    };
+
+    EpochManager() = default;
+
+    ~EpochManager()
+    {
+        for (auto &slot : m_slots)
+            release_all(slot.retired);
+
+        release_all(m_orphans);
+    }
+
+    Slot &local()
+    {
+        thread_local Registration registration;
+
+        if (registration.slot != nullptr)
+            return *registration.slot;
+
+        for (auto &slot : m_slots)
+        {
+            bool expected{false};
+
+            if (!slot.claimed.load(std::memory_order_relaxed) &&
+                slot.claimed.compare_exchange_strong(expected, true,
+                                                     std::memory_order_acq_rel))
+            {
+                registration.manager = this;
+                registration.slot = &slot;
+                return slot;
+            }
+        }
+
+        throw std::runtime_error("EpochManager: too many threads");
+    }
+
+    void enter()
+    {
+        auto &slot{local()};
+
+        if (slot.depth++ == 0)
+            slot.epoch.store(m_epoch.load(std::memory_order_seq_cst),
+                             std::memory_order_seq_cst);
+    }
+
+    void exit()
+    {
+        auto &slot{local()};
+
+        if (--slot.depth == 0)
+            slot.epoch.store(QUIESCENT, std::memory_order_release);
+    }
+
+    bool try_advance()
+    {
+        auto current{m_epoch.load(std::memory_order_seq_cst)};
+
+        for (auto const &slot : m_slots)
+        {
+            auto const observed{slot.epoch.load(std::memory_order_seq_cst)};
+
+            if (observed != QUIESCENT && observed != current)
+                return false;
+        }
+
+        return m_epoch.compare_exchange_strong(current, current + 1,
+                                               std::memory_order_seq_cst);
+    }
+
+    void collect(Slot &slot)
+    {
+        try_advance();
+
+        auto const safe{m_epoch.load(std::memory_order_seq_cst)};
+
+        release_expired(slot.retired, safe);
+
+        std::unique_lock lock{m_orphans_mutex, std::try_to_lock};
+
+        if (lock.owns_lock())
+            release_expired(m_orphans, safe);
+    }
+
+    static void release_expired(std::vector<Retired> &retired,
+                                std::uint64_t epoch)
+    {
+        std::size_t kept{};
+
+        for (auto const &node : retired)
+        {
+            if (node.epoch + 2 <= epoch)
+                node.deleter(node.pointer);
+            else
+                retired[kept++] = node;
+        }
+
+        retired.resize(kept);
+    }
+
+    static void release_all(std::vector<Retired> &retired)
+    {
+        for (auto const &node : retired)
+            node.deleter(node.pointer);
+
+        retired.clear();
+    }
+
+    alignas(64) std::atomic<std::uint64_t> m_epoch{0};
+    std::array<Slot, MAX_THREADS> m_slots{};
+    std::mutex m_orphans_mutex;
+    std::vector<Retired> m_orphans;
+};
+
+#endif //! EPOCH_MANAGER_H
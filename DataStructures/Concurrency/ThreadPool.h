@@ -0,0 +1,444 @@
+/**
+ * @file ThreadPool.h
+ * @author Carlos Salguero
+ * @brief Fork-join thread pool on top of work-stealing deques
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>   // std::size_t
+#include <cstdint>   // std::uint64_t
+#include <exception> // std::exception_ptr
+#include <memory>    // std::unique_ptr
+#include <mutex>
+#include <thread>
+#include <utility> // std::forward()
+#include <vector>
+
+// Custom Headers
+#include "EpochManager.h"
+#include "../LinearDataStructures/Deque/WorkStealingDeque.cpp"
+#include "../LinearDataStructures/Queue/ConcurrentQueue/ConcurrentQueue.cpp"
+
+/**
+ * @brief
+ * Fork-join thread pool. Every worker owns a WorkStealingDeque: invoke()
+ * pushes its second function at the bottom of the deque of the calling
+ * worker, runs the first one itself and then pops the second one back
+ * unless an idle worker stole it in the meantime. Idle workers steal from
+ * the top of the other deques, which holds the oldest and therefore
+ * largest pieces of work. While a worker waits for a stolen task it steals
+ * work too instead of blocking.
+ *
+ * Threads outside the pool hand their work over through run(), which
+ * blocks until it is done. Workers that find no work spin for a while and
+ * then sleep until new work is pushed.
+ */
+class ThreadPool
+{
+public:
+    static constexpr std::size_t SPIN_LIMIT = 64;
+
+    /**
+     * @brief
+     * Construct a new ThreadPool object and start its workers
+     * @param threads Number of workers, at least one
+     */
+    explicit ThreadPool(std::size_t threads = std::thread::hardware_concurrency())
+    {
+        // The workers register with the EpochManager through the injection
+        // queue, and the queue retires its nodes there when destroyed.
+        // Creating it before the pool is finished makes it outlive the pool,
+        // even a pool at namespace scope.
+        EpochManager::instance();
+
+        threads = threads == 0 ? 1 : threads;
+
+        for (std::size_t index{}; index < threads; ++index)
+            m_workers.push_back(std::make_unique<Worker>());
+
+        for (std::size_t index{}; index < threads; ++index)
+            m_workers[index]->thread = std::thread{[this, index]
+                                                   { work(index); }};
+    }
+
+    ThreadPool(const ThreadPool &) = delete;
+    ThreadPool &operator=(const ThreadPool &) = delete;
+
+    /**
+     * @brief
+     * Destroy the ThreadPool object. Waits for the workers to finish the
+     * work they already have.
+     */
+    ~ThreadPool()
+    {
+        m_stop.store(true, std::memory_order_seq_cst);
+
+        {
+            std::lock_guard lock{m_mutex};
+        }
+
+        m_condition.notify_all();
+
+        for (auto &worker : m_workers)
+            worker->thread.join();
+    }
+
+    /**
+     * @brief
+     * Get the process-wide pool, with one worker per hardware thread
+     * @return ThreadPool& The pool
+     */
+    static ThreadPool &instance()
+    {
+        static ThreadPool pool;
+        return pool;
+    }
+
+    /**
+     * @brief
+     * Get the number of workers
+     * @return std::size_t Number of workers
+     */
+    std::size_t get_size() const { return m_workers.size(); }
+
+    /**
+     * @brief
+     * Run a function inside the pool and wait for it, so that the invoke()
+     * calls it makes run in parallel. Called from a worker of this pool,
+     * the function simply runs in place.
+     * @tparam F Type of the function
+     * @param function Function to be run
+     * @throw Whatever the function throws
+     */
+    template <class F>
+    void run(F &&function)
+    {
+        if (context().pool == this)
+        {
+            function();
+            return;
+        }
+
+        RootTask<F> task{function};
+
+        m_injected.enqueue(&task);
+        wake();
+
+        {
+            std::unique_lock lock{task.mutex};
+            task.finished.wait(lock, [&]
+                               { return task.done.load(std::memory_order_acquire); });
+        }
+
+        if (task.error)
+            std::rethrow_exception(task.error);
+    }
+
+    /**
+     * @brief
+     * Run two functions, possibly in parallel, and return once both are
+     * done. If both throw, the exception of the first one is rethrown.
+     * @tparam F Type of the first function
+     * @tparam G Type of the second function
+     * @param first Function run by the calling thread
+     * @param second Function offered to the other workers
+     * @throw Whatever one of the functions throws
+     * @time complexity O(1) overhead
+     * @space complexity O(1)
+     */
+    template <class F, class G>
+    void invoke(F &&first, G &&second)
+    {
+        auto &local{context()};
+
+        if (local.pool != this)
+        {
+            run([&]
+                { invoke(first, second); });
+            return;
+        }
+
+        auto &deque{m_workers[local.index]->deque};
+        FunctionTask<G> task{second};
+
+        deque.push(&task);
+        wake();
+
+        std::exception_ptr error;
+
+        try
+        {
+            first();
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        // Everything first() forked has been joined, so the task is at the
+        // bottom of the deque unless a thief took it
+        if (auto const popped{deque.pop()}; popped == &task)
+            task.run();
+        else
+        {
+            if (popped)
+                deque.push(*popped);
+
+            while (!task.done.load(std::memory_order_acquire))
+            {
+                if (auto *const other{steal(local)})
+                    other->run();
+                else
+                    std::this_thread::yield();
+            }
+        }
+
+        if (error)
+            std::rethrow_exception(error);
+
+        if (task.error)
+            std::rethrow_exception(task.error);
+    }
+
+    /**
+     * @brief
+     * Call body(begin, end) on consecutive ranges covering [first, last),
+     * splitting the range in halves with invoke() down to the grain
+     * @tparam Index Type of the indices
+     * @tparam F Type of the body
+     * @param first Beginning of the range
+     * @param last End of the range
+     * @param grain Largest range handed to the body at once
+     * @param body Function taking the bounds of one range
+     * @time complexity O(n / grain) overhead
+     * @space complexity O(log(n / grain)) stack
+     */
+    template <class Index, class F>
+    void parallel_for(Index first, Index last, Index grain, F &&body)
+    {
+        if (last - first <= (grain < Index{1} ? Index{1} : grain))
+        {
+            if (first < last)
+                body(first, last);
+
+            return;
+        }
+
+        auto const middle{first + (last - first) / 2};
+
+        invoke([&]
+               { parallel_for(first, middle, grain, body); },
+               [&]
+               { parallel_for(middle, last, grain, body); });
+    }
+
+private:
+    struct Task
+    {
+        virtual void execute() = 0;
+
+        /**
+         * @brief
+         * Publish that the task is done. The thread waiting for it may
+         * destroy the task as soon as it sees done, so nothing may touch
+         * the task afterwards.
+         */
+        virtual void finish() { done.store(true, std::memory_order_release); }
+
+        void run()
+        {
+            try
+            {
+                execute();
+            }
+            catch (...)
+            {
+                error = std::current_exception();
+            }
+
+            finish();
+        }
+
+        std::atomic<bool> done{false};
+        std::exception_ptr error;
+
+    protected:
+        ~Task() = default;
+    };
+
+    template <class F>
+    struct FunctionTask : Task
+    {
+        explicit FunctionTask(F &function) : function{function} {}
+
+        void execute() override { function(); }
+
+        F &function;
+    };
+
+    /**
+     * @brief
+     * Task handed over by a thread outside the pool, which sleeps on the
+     * condition variable until it is done
+     */
+    template <class F>
+    struct RootTask final : FunctionTask<F>
+    {
+        using FunctionTask<F>::FunctionTask;
+
+        void finish() override
+        {
+            // Notify under the lock, so the waiter cannot return and destroy
+            // the task before the notification is over
+            std::lock_guard lock{mutex};
+            this->done.store(true, std::memory_order_release);
+            finished.notify_one();
+        }
+
+        std::mutex mutex;
+        std::condition_variable finished;
+    };
+
+    struct alignas(64) Worker
+    {
+        WorkStealingDeque<Task *> deque;
+        std::thread thread;
+    };
+
+    /**
+     * @brief
+     * Pool and worker index of the calling thread, nullptr outside any
+     * pool, plus the state of its victim selection
+     */
+    struct Context
+    {
+        ThreadPool *pool;
+        std::size_t index;
+        std::uint64_t seed;
+    };
+
+    static Context &context()
+    {
+        thread_local Context context{nullptr, 0, 0x9E3779B97F4A7C15ULL};
+        return context;
+    }
+
+    void work(std::size_t index)
+    {
+        auto &local{context()};
+        local = Context{this, index, 0x9E3779B97F4A7C15ULL * (index + 1)};
+
+        for (std::size_t spins{};;)
+        {
+            if (auto *const task{find(local)})
+            {
+                task->run();
+                spins = 0;
+                continue;
+            }
+
+            if (m_stop.load(std::memory_order_acquire))
+                return;
+
+            if (++spins < SPIN_LIMIT)
+            {
+                std::this_thread::yield();
+                continue;
+            }
+
+            spins = 0;
+
+            std::unique_lock lock{m_mutex};
+            m_sleeping.fetch_add(1, std::memory_order_seq_cst);
+
+            // Pairs with the fence in wake(): either this check sees the new
+            // work or the pusher sees the sleeper
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if (!has_work() && !m_stop.load(std::memory_order_relaxed))
+                m_condition.wait(lock);
+
+            m_sleeping.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    Task *find(Context &local)
+    {
+        if (auto const task{m_workers[local.index]->deque.pop()})
+            return *task;
+
+        if (auto const task{m_injected.dequeue()})
+            return *task;
+
+        return steal(local);
+    }
+
+    Task *steal(Context &local)
+    {
+        auto const size{m_workers.size()};
+
+        local.seed ^= local.seed << 13;
+        local.seed ^= local.seed >> 7;
+        local.seed ^= local.seed << 17;
+
+        auto const start{static_cast<std::size_t>(local.seed % size)};
+
+        for (std::size_t offset{}; offset < size; ++offset)
+        {
+            auto const victim{(start + offset) % size};
+
+            if (victim == local.index)
+                continue;
+
+            if (auto const task{m_workers[victim]->deque.steal()})
+                return *task;
+        }
+
+        return nullptr;
+    }
+
+    bool has_work() const
+    {
+        if (!m_injected.is_empty())
+            return true;
+
+        for (auto const &worker : m_workers)
+            if (!worker->deque.is_empty())
+                return true;
+
+        return false;
+    }
+
+    void wake()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_sleeping.load(std::memory_order_relaxed) == 0)
+            return;
+
+        {
+            std::lock_guard lock{m_mutex};
+        }
+
+        m_condition.notify_one();
+    }
+
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    ConcurrentQueue<Task *> m_injected;
+
+    alignas(64) std::atomic<std::size_t> m_sleeping{0};
+    std::atomic<bool> m_stop{false};
+    std::mutex m_mutex;
+    std::condition_variable m_condition;
+};
+
+#endif //! THREAD_POOL_H
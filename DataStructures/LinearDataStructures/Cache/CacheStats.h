@@ -0,0 +1,83 @@
+/**
+ * @file CacheStats.h
+ * @author Carlos Salguero
+ * @brief Counters shared by the LRUCache and LFUCache classes
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CACHE_STATS_H
+#define CACHE_STATS_H
+
+#include <chrono>
+#include <cstddef> // std::size_t
+#include <cstdint> // std::uint64_t
+
+/**
+ * @brief
+ * Hit/miss and eviction counters of a cache, plus the time they started
+ * counting so the throughput since the last reset can be derived.
+ */
+struct CacheStats
+{
+    std::uint64_t hits{};
+    std::uint64_t misses{};
+    std::uint64_t insertions{};
+    std::uint64_t updates{};
+    std::uint64_t evictions{};
+    std::uint64_t rejections{};
+    std::chrono::steady_clock::time_point since{std::chrono::steady_clock::now()};
+
+    /**
+     * @brief
+     * Fraction of lookups that found their key
+     * @return double Hit rate in [0, 1], 0 without lookups
+     */
+    double hit_rate() const
+    {
+        auto const lookups{hits + misses};
+
+        return lookups == 0 ? 0.0 : static_cast<double>(hits) / lookups;
+    }
+
+    /**
+     * @brief
+     * Number of get and put calls counted
+     * @return std::uint64_t Operations since the last reset
+     */
+    std::uint64_t operations() const
+    {
+        return hits + misses + insertions + updates + rejections;
+    }
+
+    /**
+     * @brief
+     * Operations per second since the last reset
+     * @return double Throughput
+     */
+    double operations_per_second() const
+    {
+        std::chrono::duration<double> const elapsed{
+            std::chrono::steady_clock::now() - since};
+
+        return elapsed.count() > 0 ? operations() / elapsed.count() : 0.0;
+    }
+};
+
+/**
+ * @brief
+ * Default weigher: every entry weighs 1, so the capacity is a count
+ */
+struct UnitWeight
+{
+    template <class Key, class Value>
+    std::size_t operator()(const Key &, const Value &) const
+    {
+        return 1;
+    }
+};
+
+#endif //! CACHE_STATS_H
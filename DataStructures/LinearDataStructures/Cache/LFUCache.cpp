@@ -0,0 +1,419 @@
+/**
+ * @file LFUCache.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the LFUCache class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "LFUCache.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new LFUCache< Key, Value, Weigher, Hash>:: LFUCache object
+ * @tparam Key Type of the keys
+ * @tparam Value Type of the values
+ * @tparam Weigher Weight of an entry
+ * @tparam Hash Hash of the keys
+ * @param capacity Maximum total weight (entries, for UnitWeight)
+ * @param weigher Weight function
+ */
+template <class Key, class Value, class Weigher, class Hash>
+LFUCache<Key, Value, Weigher, Hash>::LFUCache(std::size_t capacity,
+                                              const Weigher &weigher)
+    : m_capacity{capacity}, m_weigher{weigher}
+{
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator, least frequently used entry first
+ * @param os Output stream
+ * @param cache Cache to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class key_t, class value_t, class weigher_t, class hash_t>
+std::ostream &operator<<(std::ostream &os,
+                         const LFUCache<key_t, value_t, weigher_t, hash_t> &cache)
+{
+    for (const auto &entry : cache.m_entries)
+        os << entry.key << ":" << entry.value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of entries
+ * @return std::size_t Number of cached entries
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::size_t LFUCache<Key, Value, Weigher, Hash>::get_size() const
+{
+    return m_entries.get_size();
+}
+
+/**
+ * @brief
+ * Get the total weight of the entries
+ * @return std::size_t Sum of the weights
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::size_t LFUCache<Key, Value, Weigher, Hash>::get_weight() const
+{
+    return m_weight;
+}
+
+/**
+ * @brief
+ * Get the maximum total weight
+ * @return std::size_t Capacity of the cache
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::size_t LFUCache<Key, Value, Weigher, Hash>::get_capacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * @brief
+ * Get the hit/miss and eviction counters
+ * @return const CacheStats& Counters since construction or last reset
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+const CacheStats &LFUCache<Key, Value, Weigher, Hash>::get_stats() const
+{
+    return m_stats;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the cache is empty
+ * @return true If there are no entries
+ * @return false Otherwise
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+bool LFUCache<Key, Value, Weigher, Hash>::is_empty() const
+{
+    return m_entries.is_empty();
+}
+
+/**
+ * @brief
+ * Checks if a key is cached, without touching its count or the stats
+ * @param key Key to be searched
+ * @return true If the key is cached
+ * @return false Otherwise
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+bool LFUCache<Key, Value, Weigher, Hash>::contains(const Key &key) const
+{
+    return m_index.find(key) != m_index.end();
+}
+
+/**
+ * @brief
+ * Get how many times a key has been used since it was inserted
+ * @param key Key to be searched
+ * @return std::optional<std::uint64_t> Access count, std::nullopt if absent
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::optional<std::uint64_t>
+LFUCache<Key, Value, Weigher, Hash>::get_frequency(const Key &key) const
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+        return std::nullopt;
+
+    return m_entries.get(found->second).frequency;
+}
+
+/**
+ * @brief
+ * Look a key up and increase its access count
+ * @param key Key to be searched
+ * @return std::optional<Value> Cached value, std::nullopt on a miss
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::optional<Value> LFUCache<Key, Value, Weigher, Hash>::get(const Key &key)
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+    {
+        ++m_stats.misses;
+        return std::nullopt;
+    }
+
+    ++m_stats.hits;
+    touch(found->second);
+
+    return m_entries.get(found->second).value;
+}
+
+/**
+ * @brief
+ * Look a key up without touching its count or the stats
+ * @param key Key to be searched
+ * @return std::optional<Value> Cached value, std::nullopt if absent
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::optional<Value> LFUCache<Key, Value, Weigher, Hash>::peek(const Key &key) const
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+        return std::nullopt;
+
+    return m_entries.get(found->second).value;
+}
+
+/**
+ * @brief
+ * Insert an entry with a count of 1, or update one and increase its count,
+ * evicting the least frequently used entries (oldest first among ties)
+ * while the capacity is exceeded. An entry heavier than the whole capacity
+ * is rejected.
+ * @param key Key of the entry
+ * @param value Value of the entry
+ * @time complexity O(1) average, plus O(1) per eviction
+ * @space complexity O(1) amortized
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::put(const Key &key, const Value &value)
+{
+    auto const weight{m_weigher(key, value)};
+
+    if (weight > m_capacity)
+    {
+        ++m_stats.rejections;
+        erase(key);
+        return;
+    }
+
+    if (auto const found{m_index.find(key)}; found != m_index.end())
+    {
+        auto &entry{m_entries.get(found->second)};
+
+        m_weight = m_weight - entry.weight + weight;
+        entry.value = value;
+        entry.weight = weight;
+        touch(found->second);
+        ++m_stats.updates;
+    }
+    else
+    {
+        evict_until(m_capacity - weight);
+
+        Entry entry{key, value, weight, 1};
+        auto const ones{m_bucket_tails.find(1)};
+        auto const handle{ones == m_bucket_tails.end()
+                              ? m_entries.push_front(entry)
+                              : m_entries.insert_after(ones->second, entry)};
+
+        m_bucket_tails[1] = handle;
+        m_index.emplace(key, handle);
+        m_weight += weight;
+        ++m_stats.insertions;
+    }
+
+    evict_until(m_capacity);
+}
+
+/**
+ * @brief
+ * Remove an entry
+ * @param key Key of the entry
+ * @return true If the key was cached
+ * @return false Otherwise
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+bool LFUCache<Key, Value, Weigher, Hash>::erase(const Key &key)
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+        return false;
+
+    auto const handle{found->second};
+
+    m_index.erase(found);
+    unlink(handle);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Change the capacity, evicting entries if it shrinks
+ * @param capacity New maximum total weight
+ * @time complexity O(k) for k evictions
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::set_capacity(std::size_t capacity)
+{
+    m_capacity = capacity;
+    evict_until(m_capacity);
+}
+
+/**
+ * @brief
+ * Remove every entry. The stats are kept.
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::clear()
+{
+    m_entries.clear();
+    m_index.clear();
+    m_bucket_tails.clear();
+    m_weight = 0;
+}
+
+/**
+ * @brief
+ * Zero the counters and restart the throughput clock
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::reset_stats()
+{
+    m_stats = CacheStats{};
+}
+
+/**
+ * @brief
+ * Prints the cache to a string
+ * @return std::string String representation of the cache
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::string LFUCache<Key, Value, Weigher, Hash>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Increase the count of an entry from f to f + 1 and move it to the end of
+ * the entries with count f + 1. That place is right after the last entry
+ * with count f + 1 if there is one, otherwise right after the last entry
+ * with count f.
+ * @param handle Handle of the entry
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::touch(handle_t handle)
+{
+    auto &entry{m_entries.get(handle)};
+    auto const frequency{entry.frequency};
+
+    auto const higher{m_bucket_tails.find(frequency + 1)};
+    auto const anchor{higher != m_bucket_tails.end()
+                          ? higher->second
+                          : m_bucket_tails[frequency]};
+
+    if (m_bucket_tails[frequency] == handle)
+    {
+        auto const previous{m_entries.prev(handle)};
+
+        if (previous != list_t::NIL && m_entries.get(previous).frequency == frequency)
+            m_bucket_tails[frequency] = previous;
+        else
+            m_bucket_tails.erase(frequency);
+    }
+
+    if (anchor != handle)
+        m_entries.splice(m_entries.next(anchor), handle);
+
+    entry.frequency = frequency + 1;
+    m_bucket_tails[frequency + 1] = handle;
+}
+
+/**
+ * @brief
+ * Remove an entry from the list, fixing the tail of its count bucket and
+ * the total weight. The index is left to the caller.
+ * @param handle Handle of the entry
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::unlink(handle_t handle)
+{
+    auto const &entry{m_entries.get(handle)};
+    auto const tail{m_bucket_tails.find(entry.frequency)};
+
+    if (tail->second == handle)
+    {
+        auto const previous{m_entries.prev(handle)};
+
+        if (previous != list_t::NIL &&
+            m_entries.get(previous).frequency == entry.frequency)
+            tail->second = previous;
+        else
+            m_bucket_tails.erase(tail);
+    }
+
+    m_weight -= entry.weight;
+    m_entries.erase(handle);
+}
+
+/**
+ * @brief
+ * Evict the least frequently used entries until the weight is at most limit
+ * @param limit Weight to get down to
+ * @time complexity O(k) for k evictions
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LFUCache<Key, Value, Weigher, Hash>::evict_until(std::size_t limit)
+{
+    while (m_weight > limit && !m_entries.is_empty())
+    {
+        auto const victim{m_entries.get_head()};
+
+        m_index.erase(m_entries.get(victim).key);
+        unlink(victim);
+        ++m_stats.evictions;
+    }
+}
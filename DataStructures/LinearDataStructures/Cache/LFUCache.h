@@ -0,0 +1,102 @@
+/**
+ * @file LFUCache.h
+ * @author Carlos Salguero
+ * @brief Declaration of the LFUCache class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef LFU_CACHE_H
+#define LFU_CACHE_H
+
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::hash<>
+#include <optional>   // C++17, std::optional encapsulation
+#include <sstream>    // std::stringstream for to_string()
+#include <string>
+#include <unordered_map>
+
+// Custom Headers
+#include "CacheStats.h"
+#include "../LinkedLists/CompactDoubleLinkedList/CompactDoubleLinkedList.cpp"
+
+/**
+ * @brief
+ * Least frequently used cache with O(1) operations. A single
+ * CompactDoubleLinkedList holds every entry sorted by ascending access
+ * count, oldest first among equal counts, so the victim is always the head.
+ * A second hash map remembers the last entry of each count, which is where
+ * an entry that reaches that count is spliced.
+ * @tparam Key Type of the keys
+ * @tparam Value Type of the values
+ * @tparam Weigher Weight of an entry; capacity is measured in this unit
+ * @tparam Hash Hash of the keys
+ */
+template <class Key, class Value, class Weigher = UnitWeight,
+          class Hash = std::hash<Key>>
+class LFUCache
+{
+public:
+    // Constructor
+    LFUCache(std::size_t, const Weigher &weigher = Weigher{});
+
+    // Destructor
+    ~LFUCache() = default;
+
+    // Operator Overload
+    template <class key_t, class value_t, class weigher_t, class hash_t>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const LFUCache<key_t, value_t, weigher_t, hash_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t get_weight() const;
+    std::size_t get_capacity() const;
+    const CacheStats &get_stats() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const Key &) const;
+    std::optional<std::uint64_t> get_frequency(const Key &) const;
+
+    std::optional<Value> get(const Key &);
+    std::optional<Value> peek(const Key &) const;
+
+    void put(const Key &, const Value &);
+    bool erase(const Key &);
+    void set_capacity(std::size_t);
+    void clear();
+    void reset_stats();
+
+    std::string to_string() const;
+
+private:
+    struct Entry
+    {
+        Key key;
+        Value value;
+        std::size_t weight;
+        std::uint64_t frequency;
+    };
+
+    using list_t = CompactDoubleLinkedList<Entry>;
+    using handle_t = typename list_t::handle_t;
+
+    list_t m_entries;
+    std::unordered_map<Key, handle_t, Hash> m_index;
+    std::unordered_map<std::uint64_t, handle_t> m_bucket_tails;
+    std::size_t m_capacity;
+    std::size_t m_weight{};
+    Weigher m_weigher;
+    CacheStats m_stats;
+
+    void touch(handle_t);
+    void unlink(handle_t);
+    void evict_until(std::size_t);
+};
+
+#endif //! LFU_CACHE_H
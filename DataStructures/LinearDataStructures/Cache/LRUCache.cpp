@@ -0,0 +1,323 @@
+/**
+ * @file LRUCache.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the LRUCache class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include "LRUCache.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new LRUCache< Key, Value, Weigher, Hash>:: LRUCache object
+ * @tparam Key Type of the keys
+ * @tparam Value Type of the values
+ * @tparam Weigher Weight of an entry
+ * @tparam Hash Hash of the keys
+ * @param capacity Maximum total weight (entries, for UnitWeight)
+ * @param weigher Weight function
+ */
+template <class Key, class Value, class Weigher, class Hash>
+LRUCache<Key, Value, Weigher, Hash>::LRUCache(std::size_t capacity,
+                                              const Weigher &weigher)
+    : m_capacity{capacity}, m_weigher{weigher}
+{
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator, most recently used entry first
+ * @param os Output stream
+ * @param cache Cache to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class key_t, class value_t, class weigher_t, class hash_t>
+std::ostream &operator<<(std::ostream &os,
+                         const LRUCache<key_t, value_t, weigher_t, hash_t> &cache)
+{
+    for (const auto &entry : cache.m_recency)
+        os << entry.key << ":" << entry.value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of entries
+ * @return std::size_t Number of cached entries
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::size_t LRUCache<Key, Value, Weigher, Hash>::get_size() const
+{
+    return m_recency.get_size();
+}
+
+/**
+ * @brief
+ * Get the total weight of the entries
+ * @return std::size_t Sum of the weights
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::size_t LRUCache<Key, Value, Weigher, Hash>::get_weight() const
+{
+    return m_weight;
+}
+
+/**
+ * @brief
+ * Get the maximum total weight
+ * @return std::size_t Capacity of the cache
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::size_t LRUCache<Key, Value, Weigher, Hash>::get_capacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * @brief
+ * Get the hit/miss and eviction counters
+ * @return const CacheStats& Counters since construction or last reset
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+const CacheStats &LRUCache<Key, Value, Weigher, Hash>::get_stats() const
+{
+    return m_stats;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the cache is empty
+ * @return true If there are no entries
+ * @return false Otherwise
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+bool LRUCache<Key, Value, Weigher, Hash>::is_empty() const
+{
+    return m_recency.is_empty();
+}
+
+/**
+ * @brief
+ * Checks if a key is cached, without touching its recency or the stats
+ * @param key Key to be searched
+ * @return true If the key is cached
+ * @return false Otherwise
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+bool LRUCache<Key, Value, Weigher, Hash>::contains(const Key &key) const
+{
+    return m_index.find(key) != m_index.end();
+}
+
+/**
+ * @brief
+ * Look a key up and mark it as the most recently used
+ * @param key Key to be searched
+ * @return std::optional<Value> Cached value, std::nullopt on a miss
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::optional<Value> LRUCache<Key, Value, Weigher, Hash>::get(const Key &key)
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+    {
+        ++m_stats.misses;
+        return std::nullopt;
+    }
+
+    ++m_stats.hits;
+    m_recency.move_to_front(found->second);
+
+    return m_recency.get(found->second).value;
+}
+
+/**
+ * @brief
+ * Look a key up without touching its recency or the stats
+ * @param key Key to be searched
+ * @return std::optional<Value> Cached value, std::nullopt if absent
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::optional<Value> LRUCache<Key, Value, Weigher, Hash>::peek(const Key &key) const
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+        return std::nullopt;
+
+    return m_recency.get(found->second).value;
+}
+
+/**
+ * @brief
+ * Insert or update an entry and make it the most recently used, evicting
+ * the least recently used entries while the capacity is exceeded. An entry
+ * heavier than the whole capacity is rejected.
+ * @param key Key of the entry
+ * @param value Value of the entry
+ * @time complexity O(1) average, plus O(1) per eviction
+ * @space complexity O(1) amortized
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LRUCache<Key, Value, Weigher, Hash>::put(const Key &key, const Value &value)
+{
+    auto const weight{m_weigher(key, value)};
+
+    if (weight > m_capacity)
+    {
+        ++m_stats.rejections;
+        erase(key);
+        return;
+    }
+
+    if (auto const found{m_index.find(key)}; found != m_index.end())
+    {
+        auto &entry{m_recency.get(found->second)};
+
+        m_weight = m_weight - entry.weight + weight;
+        entry.value = value;
+        entry.weight = weight;
+        m_recency.move_to_front(found->second);
+        ++m_stats.updates;
+    }
+    else
+    {
+        evict_until(m_capacity - weight);
+        m_index.emplace(key, m_recency.push_front(Entry{key, value, weight}));
+        m_weight += weight;
+        ++m_stats.insertions;
+    }
+
+    evict_until(m_capacity);
+}
+
+/**
+ * @brief
+ * Remove an entry
+ * @param key Key of the entry
+ * @return true If the key was cached
+ * @return false Otherwise
+ * @time complexity O(1) average
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+bool LRUCache<Key, Value, Weigher, Hash>::erase(const Key &key)
+{
+    auto const found{m_index.find(key)};
+
+    if (found == m_index.end())
+        return false;
+
+    m_weight -= m_recency.get(found->second).weight;
+    m_recency.erase(found->second);
+    m_index.erase(found);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Change the capacity, evicting entries if it shrinks
+ * @param capacity New maximum total weight
+ * @time complexity O(k) for k evictions
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LRUCache<Key, Value, Weigher, Hash>::set_capacity(std::size_t capacity)
+{
+    m_capacity = capacity;
+    evict_until(m_capacity);
+}
+
+/**
+ * @brief
+ * Remove every entry. The stats are kept.
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LRUCache<Key, Value, Weigher, Hash>::clear()
+{
+    m_recency.clear();
+    m_index.clear();
+    m_weight = 0;
+}
+
+/**
+ * @brief
+ * Zero the counters and restart the throughput clock
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LRUCache<Key, Value, Weigher, Hash>::reset_stats()
+{
+    m_stats = CacheStats{};
+}
+
+/**
+ * @brief
+ * Prints the cache to a string
+ * @return std::string String representation of the cache
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+std::string LRUCache<Key, Value, Weigher, Hash>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Evict least recently used entries until the weight is at most limit
+ * @param limit Weight to get down to
+ * @time complexity O(k) for k evictions
+ * @space complexity O(1)
+ */
+template <class Key, class Value, class Weigher, class Hash>
+void LRUCache<Key, Value, Weigher, Hash>::evict_until(std::size_t limit)
+{
+    while (m_weight > limit && !m_recency.is_empty())
+    {
+        auto const victim{m_recency.get_tail()};
+        auto const &entry{m_recency.get(victim)};
+
+        m_weight -= entry.weight;
+        m_index.erase(entry.key);
+        m_recency.erase(victim);
+        ++m_stats.evictions;
+    }
+}
@@ -0,0 +1,613 @@
+/**
+ * @file Deque.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the Deque class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef DEQUE_CPP
+#define DEQUE_CPP
+
+#include <memory>      // std::construct_at(), std::destroy_at()
+#include <stdexcept>   // std::runtime_error
+#include <type_traits> // std::is_trivially_destructible_v
+#include <utility>     // std::exchange(), std::forward(), std::swap()
+
+#include "Deque.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new Deque< T>:: Deque object from a list of values, front
+ * first
+ * @tparam T Type of the data
+ * @param values Values to be copied
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+Deque<T>::Deque(std::initializer_list<T> values)
+{
+    for (auto const &value : values)
+        push_back(value);
+}
+
+/**
+ * @brief
+ * Construct a new Deque< T>:: Deque object as a copy of other
+ * @tparam T Type of the data
+ * @param other Deque to be copied
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+Deque<T>::Deque(const Deque &other)
+{
+    for (auto const &value : other)
+        push_back(value);
+}
+
+/**
+ * @brief
+ * Construct a new Deque< T>:: Deque object taking the blocks of other,
+ * which is left empty
+ * @tparam T Type of the data
+ * @param other Deque to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+Deque<T>::Deque(Deque &&other) noexcept
+    : m_map{std::move(other.m_map)},
+      m_first_block{std::exchange(other.m_first_block, 0)},
+      m_blocks{std::exchange(other.m_blocks, 0)},
+      m_begin{std::exchange(other.m_begin, 0)},
+      m_size{std::exchange(other.m_size, 0)},
+      m_spare{std::exchange(other.m_spare, nullptr)}
+{
+    other.m_map.clear();
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the Deque< T>:: Deque object
+ * @tparam T Type of the data
+ * @time complexity O(n), O(n / BLOCK_SIZE) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T>
+Deque<T>::~Deque()
+{
+    clear();
+
+    if (m_spare != nullptr)
+        allocator_t{}.deallocate(m_spare, BLOCK_SIZE);
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Copy and move assignment
+ * @tparam T Type of the data
+ * @param other Deque to be assigned
+ * @return Deque& Reference to this deque
+ */
+template <class T>
+Deque<T> &Deque<T>::operator=(Deque other)
+{
+    std::swap(m_map, other.m_map);
+    std::swap(m_first_block, other.m_first_block);
+    std::swap(m_blocks, other.m_blocks);
+    std::swap(m_begin, other.m_begin);
+    std::swap(m_size, other.m_size);
+    std::swap(m_spare, other.m_spare);
+
+    return *this;
+}
+
+/**
+ * @brief
+ * Access the element at an index, 0 being the front. The index is not
+ * checked.
+ * @tparam T Type of the data
+ * @param index Index of the element
+ * @return T& Element at the index
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &Deque<T>::operator[](std::size_t index)
+{
+    return *address(m_begin + static_cast<std::int64_t>(index));
+}
+
+template <class T>
+const T &Deque<T>::operator[](std::size_t index) const
+{
+    return *address(m_begin + static_cast<std::int64_t>(index));
+}
+
+/**
+ * @brief
+ * Overload the << operator, front first
+ * @tparam ostream_t Type of the data
+ * @param os Output stream
+ * @param deque Deque to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t>
+std::ostream &operator<<(std::ostream &os, const Deque<ostream_t> &deque)
+{
+    for (auto const &value : deque)
+        os << value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @return std::size_t Number of elements
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t Deque<T>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the first element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the deque is empty
+ * @return T& First element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &Deque<T>::front()
+{
+    if (is_empty())
+        throw std::runtime_error("Deque is empty");
+
+    return *address(m_begin);
+}
+
+template <class T>
+const T &Deque<T>::front() const
+{
+    if (is_empty())
+        throw std::runtime_error("Deque is empty");
+
+    return *address(m_begin);
+}
+
+/**
+ * @brief
+ * Get the last element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the deque is empty
+ * @return T& Last element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &Deque<T>::back()
+{
+    if (is_empty())
+        throw std::runtime_error("Deque is empty");
+
+    return *address(m_begin + static_cast<std::int64_t>(m_size) - 1);
+}
+
+template <class T>
+const T &Deque<T>::back() const
+{
+    if (is_empty())
+        throw std::runtime_error("Deque is empty");
+
+    return *address(m_begin + static_cast<std::int64_t>(m_size) - 1);
+}
+
+// Iterators
+/**
+ * @brief
+ * Get an iterator to the first element. It stays valid while elements are
+ * added or removed at either end, unless the element it points to is
+ * removed.
+ * @tparam T Type of the data
+ * @return iterator Iterator to the first element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename Deque<T>::iterator Deque<T>::begin()
+{
+    return iterator{this, m_begin};
+}
+
+template <class T>
+typename Deque<T>::iterator Deque<T>::end()
+{
+    return iterator{this, m_begin + static_cast<std::int64_t>(m_size)};
+}
+
+template <class T>
+typename Deque<T>::const_iterator Deque<T>::begin() const
+{
+    return const_iterator{this, m_begin};
+}
+
+template <class T>
+typename Deque<T>::const_iterator Deque<T>::end() const
+{
+    return const_iterator{this, m_begin + static_cast<std::int64_t>(m_size)};
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the deque is empty
+ * @tparam T Type of the data
+ * @return true If the deque is empty
+ * @return false If the deque is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool Deque<T>::is_empty() const
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief
+ * Checks if the deque contains a value
+ * @tparam T Type of the data
+ * @param value Value to be searched
+ * @return true If the value is in the deque
+ * @return false If the value is not in the deque
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+bool Deque<T>::contains(const T &value) const
+{
+    for (auto const &element : *this)
+        if (element == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief
+ * Destroy every element and release the blocks. The map is kept.
+ * @tparam T Type of the data
+ * @time complexity O(n), O(n / BLOCK_SIZE) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T>
+void Deque<T>::clear()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        for (auto position{m_begin}; position < m_begin + static_cast<std::int64_t>(m_size);
+             ++position)
+            std::destroy_at(address(position));
+
+    while (m_blocks > 0)
+        release_block(m_first_block + static_cast<std::int64_t>(m_blocks) - 1);
+
+    m_size = 0;
+}
+
+/**
+ * @brief
+ * Construct an element in place at the back
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return T& The new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+template <class... Args>
+T &Deque<T>::emplace_back(Args &&...args)
+{
+    auto const position{m_begin + static_cast<std::int64_t>(m_size)};
+    auto const block{position >> BLOCK_SHIFT};
+    bool const added{m_blocks == 0 ||
+                     block >= m_first_block + static_cast<std::int64_t>(m_blocks)};
+
+    if (added)
+        add_block(block);
+
+    auto *const slot{address(position)};
+
+    try
+    {
+        std::construct_at(slot, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        if (added)
+            release_block(block);
+
+        throw;
+    }
+
+    ++m_size;
+
+    return *slot;
+}
+
+/**
+ * @brief
+ * Construct an element in place at the front
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return T& The new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+template <class... Args>
+T &Deque<T>::emplace_front(Args &&...args)
+{
+    auto const position{m_begin - 1};
+    auto const block{position >> BLOCK_SHIFT};
+    bool const added{m_blocks == 0 || block < m_first_block};
+
+    if (added)
+        add_block(block);
+
+    auto *const slot{address(position)};
+
+    try
+    {
+        std::construct_at(slot, std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        if (added)
+        {
+            release_block(block);
+            ++m_first_block;
+        }
+
+        throw;
+    }
+
+    m_begin = position;
+    ++m_size;
+
+    return *slot;
+}
+
+/**
+ * @brief
+ * Add a value at the back
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void Deque<T>::push_back(const T &value)
+{
+    emplace_back(value);
+}
+
+/**
+ * @brief
+ * Add a value at the back
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void Deque<T>::push_back(T &&value)
+{
+    emplace_back(std::move(value));
+}
+
+/**
+ * @brief
+ * Add a value at the front
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void Deque<T>::push_front(const T &value)
+{
+    emplace_front(value);
+}
+
+/**
+ * @brief
+ * Add a value at the front
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void Deque<T>::push_front(T &&value)
+{
+    emplace_front(std::move(value));
+}
+
+/**
+ * @brief
+ * Remove the last element, releasing its block once it is empty
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the deque is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void Deque<T>::pop_back()
+{
+    if (is_empty())
+        throw std::runtime_error("Deque is empty");
+
+    auto const position{m_begin + static_cast<std::int64_t>(m_size) - 1};
+
+    std::destroy_at(address(position));
+    --m_size;
+
+    // The element was the first one of the last block
+    if ((position & BLOCK_MASK) == 0)
+        release_block(position >> BLOCK_SHIFT);
+}
+
+/**
+ * @brief
+ * Remove the first element, releasing its block once it is empty
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the deque is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void Deque<T>::pop_front()
+{
+    if (is_empty())
+        throw std::runtime_error("Deque is empty");
+
+    auto const position{m_begin};
+
+    std::destroy_at(address(position));
+    ++m_begin;
+    --m_size;
+
+    // The element was the last one of the first block
+    if ((position & BLOCK_MASK) == BLOCK_MASK)
+    {
+        release_block(position >> BLOCK_SHIFT);
+        ++m_first_block;
+    }
+}
+
+/**
+ * @brief
+ * Prints the deque to a string, front first
+ * @tparam T Type of the data
+ * @return std::string String representation of the deque
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string Deque<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Get the address of the slot at an absolute position. Its block has to
+ * be allocated.
+ * @tparam T Type of the data
+ * @param position Absolute position
+ * @return T* Address of the slot
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T *Deque<T>::address(std::int64_t position) const
+{
+    auto const block{static_cast<std::size_t>(position >> BLOCK_SHIFT) & (m_map.size() - 1)};
+
+    return m_map[block] + (position & BLOCK_MASK);
+}
+
+/**
+ * @brief
+ * Allocate a block right before the first one or right after the last
+ * one, reusing the spare block if there is one
+ * @tparam T Type of the data
+ * @param block Number of the new block
+ * @time complexity O(1) amortized
+ * @space complexity O(BLOCK_SIZE)
+ */
+template <class T>
+void Deque<T>::add_block(std::int64_t block)
+{
+    if (m_blocks == m_map.size())
+        grow_map();
+
+    m_map[static_cast<std::size_t>(block) & (m_map.size() - 1)] =
+        m_spare != nullptr ? std::exchange(m_spare, nullptr)
+                           : allocator_t{}.allocate(BLOCK_SIZE);
+
+    if (m_blocks == 0 || block < m_first_block)
+        m_first_block = block;
+
+    ++m_blocks;
+}
+
+/**
+ * @brief
+ * Release the first or the last block, which holds no element any more.
+ * Releasing the first block leaves moving m_first_block to the caller.
+ * @tparam T Type of the data
+ * @param block Number of the block
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void Deque<T>::release_block(std::int64_t block)
+{
+    auto &slot{m_map[static_cast<std::size_t>(block) & (m_map.size() - 1)]};
+
+    if (m_spare == nullptr)
+        m_spare = slot;
+    else
+        allocator_t{}.deallocate(slot, BLOCK_SIZE);
+
+    slot = nullptr;
+    --m_blocks;
+}
+
+/**
+ * @brief
+ * Double the map and place every block at its slot in the new ring
+ * @tparam T Type of the data
+ * @time complexity O(b), b number of blocks
+ * @space complexity O(b)
+ */
+template <class T>
+void Deque<T>::grow_map()
+{
+    std::vector<T *> map(std::max(MIN_MAP_SIZE, 2 * m_map.size()), nullptr);
+
+    for (std::size_t i{}; i < m_blocks; ++i)
+    {
+        auto const block{static_cast<std::size_t>(m_first_block) + i};
+        map[block & (map.size() - 1)] = m_map[block & (m_map.size() - 1)];
+    }
+
+    m_map.swap(map);
+}
+
+#endif //! DEQUE_CPP
@@ -0,0 +1,214 @@
+/**
+ * @file Deque.h
+ * @author Carlos Salguero
+ * @brief Declaration of the Deque class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <algorithm>   // std::max()
+#include <bit>         // C++20, std::bit_floor(), std::countr_zero()
+#include <compare>     // C++20, std::strong_ordering
+#include <cstddef>     // std::size_t, std::ptrdiff_t
+#include <cstdint>     // std::int64_t
+#include <initializer_list>
+#include <iterator>    // std::random_access_iterator_tag
+#include <memory>      // std::allocator
+#include <sstream>     // std::stringstream for to_string()
+#include <string>
+#include <type_traits> // std::conditional_t
+#include <vector>
+
+/**
+ * @brief
+ * Double-ended queue made of fixed-size blocks. A central map holds a
+ * pointer per block; both ends grow or shrink one block at a time, so
+ * elements never move once constructed and push/pop at either end is O(1).
+ * Every element has an absolute position that does not change while it is
+ * in the deque: position p is slot p % BLOCK_SIZE of block p / BLOCK_SIZE,
+ * and the map is a ring indexed by block number, so indexing is two shifts
+ * and two loads. Iterators hold a position, which keeps them valid across
+ * insertions and removals at the ends, except for the removed element.
+ * @tparam T Type of the data
+ */
+template <class T>
+class Deque
+{
+public:
+    static constexpr std::size_t BLOCK_SIZE =
+        std::bit_floor(std::max<std::size_t>(16, 4096 / sizeof(T)));
+
+private:
+    template <bool Const>
+    class basic_iterator
+    {
+        using deque_t = std::conditional_t<Const, const Deque, Deque>;
+
+    public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        basic_iterator() = default;
+        basic_iterator(deque_t *deque, std::int64_t position)
+            : m_deque{deque}, m_position{position}
+        {
+        }
+
+        operator basic_iterator<true>() const { return {m_deque, m_position}; }
+
+        reference operator*() const { return *m_deque->address(m_position); }
+        pointer operator->() const { return m_deque->address(m_position); }
+        reference operator[](difference_type n) const
+        {
+            return *m_deque->address(m_position + n);
+        }
+
+        basic_iterator &operator++()
+        {
+            ++m_position;
+            return *this;
+        }
+
+        basic_iterator &operator--()
+        {
+            --m_position;
+            return *this;
+        }
+
+        basic_iterator operator++(int)
+        {
+            auto copy{*this};
+            ++m_position;
+            return copy;
+        }
+
+        basic_iterator operator--(int)
+        {
+            auto copy{*this};
+            --m_position;
+            return copy;
+        }
+
+        basic_iterator &operator+=(difference_type n)
+        {
+            m_position += n;
+            return *this;
+        }
+
+        basic_iterator &operator-=(difference_type n)
+        {
+            m_position -= n;
+            return *this;
+        }
+
+        friend basic_iterator operator+(basic_iterator it, difference_type n) { return it += n; }
+        friend basic_iterator operator+(difference_type n, basic_iterator it) { return it += n; }
+        friend basic_iterator operator-(basic_iterator it, difference_type n) { return it -= n; }
+
+        friend difference_type operator-(const basic_iterator &lhs, const basic_iterator &rhs)
+        {
+            return lhs.m_position - rhs.m_position;
+        }
+
+        bool operator==(const basic_iterator &other) const { return m_position == other.m_position; }
+        std::strong_ordering operator<=>(const basic_iterator &other) const
+        {
+            return m_position <=> other.m_position;
+        }
+
+    private:
+        deque_t *m_deque{};
+        std::int64_t m_position{};
+    };
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // Constructor
+    Deque() = default;
+    Deque(std::initializer_list<T>);
+    Deque(const Deque &);
+    Deque(Deque &&) noexcept;
+
+    // Destructor
+    ~Deque();
+
+    // Operator overloads
+    Deque &operator=(Deque);
+    T &operator[](std::size_t);
+    const T &operator[](std::size_t) const;
+
+    template <class ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const Deque<ostream_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+
+    T &front();
+    const T &front() const;
+    T &back();
+    const T &back() const;
+
+    // Iterators
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    void clear();
+
+    template <class... Args>
+    T &emplace_back(Args &&...);
+    template <class... Args>
+    T &emplace_front(Args &&...);
+
+    void push_back(const T &);
+    void push_back(T &&);
+    void push_front(const T &);
+    void push_front(T &&);
+
+    void pop_back();
+    void pop_front();
+
+    std::string to_string() const;
+
+private:
+    using allocator_t = std::allocator<T>;
+
+    static constexpr std::size_t BLOCK_SHIFT = std::countr_zero(BLOCK_SIZE);
+    static constexpr std::int64_t BLOCK_MASK = BLOCK_SIZE - 1;
+    static constexpr std::size_t MIN_MAP_SIZE = 8;
+
+    // Ring of block pointers, block k lives at m_map[k & (size - 1)]
+    std::vector<T *> m_map;
+    std::int64_t m_first_block{};
+    std::size_t m_blocks{};
+
+    std::int64_t m_begin{};
+    std::size_t m_size{};
+
+    // Last released block, kept to avoid an allocation per block boundary
+    // when the deque slides in one direction
+    T *m_spare{};
+
+    T *address(std::int64_t) const;
+    void add_block(std::int64_t);
+    void release_block(std::int64_t);
+    void grow_map();
+};
+
+#endif //! DEQUE_H
@@ -0,0 +1,211 @@
+/**
+ * @file WorkStealingDeque.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the WorkStealingDeque class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef WORK_STEALING_DEQUE_CPP
+#define WORK_STEALING_DEQUE_CPP
+
+#include <bit> // C++20, std::bit_ceil()
+
+#include "WorkStealingDeque.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new WorkStealingDeque< T>:: WorkStealingDeque object
+ * @tparam T Type of the data
+ * @param capacity Initial capacity, rounded up to a power of two
+ * @time complexity O(capacity)
+ * @space complexity O(capacity)
+ */
+template <class T>
+WorkStealingDeque<T>::WorkStealingDeque(std::size_t capacity)
+{
+    m_arrays.push_back(std::make_unique<Array>(
+        std::bit_ceil(capacity < MIN_CAPACITY ? MIN_CAPACITY : capacity)));
+
+    m_array.store(m_arrays.back().get(), std::memory_order_relaxed);
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements, as a snapshot
+ * @tparam T Type of the data
+ * @return std::size_t Number of elements
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t WorkStealingDeque<T>::get_size() const
+{
+    auto const bottom{m_bottom.load(std::memory_order_relaxed)};
+    auto const top{m_top.load(std::memory_order_relaxed)};
+
+    return bottom > top ? static_cast<std::size_t>(bottom - top) : 0;
+}
+
+/**
+ * @brief
+ * Get the number of elements the current array can hold
+ * @tparam T Type of the data
+ * @return std::size_t Capacity
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t WorkStealingDeque<T>::capacity() const
+{
+    return static_cast<std::size_t>(m_array.load(std::memory_order_relaxed)->mask) + 1;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the deque is empty, as a snapshot
+ * @tparam T Type of the data
+ * @return true If the deque is empty
+ * @return false If the deque is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool WorkStealingDeque<T>::is_empty() const
+{
+    return get_size() == 0;
+}
+
+/**
+ * @brief
+ * Add an element at the bottom. Owner thread only.
+ * @tparam T Type of the data
+ * @param value Element to be added
+ * @time complexity O(1) amortized, wait-free unless the array grows
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void WorkStealingDeque<T>::push(T value)
+{
+    auto const bottom{m_bottom.load(std::memory_order_relaxed)};
+    auto const top{m_top.load(std::memory_order_acquire)};
+    auto *array{m_array.load(std::memory_order_relaxed)};
+
+    if (bottom - top > array->mask)
+        array = grow(array, top, bottom);
+
+    array->put(bottom, value);
+
+    // The element has to be visible before a thief can see the new bottom
+    m_bottom.store(bottom + 1, std::memory_order_release);
+}
+
+/**
+ * @brief
+ * Remove the element at the bottom, the one pushed last. Owner thread only.
+ * @tparam T Type of the data
+ * @return std::optional<T> Element removed, std::nullopt if the deque is
+ * empty or a thief took the last element
+ * @time complexity O(1), wait-free
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> WorkStealingDeque<T>::pop()
+{
+    auto const bottom{m_bottom.load(std::memory_order_relaxed) - 1};
+    auto *const array{m_array.load(std::memory_order_relaxed)};
+
+    // Claim the bottom slot first, then look at what thieves have taken
+    // Every store of the bottom is a release, so a thief that reads any of
+    // them also sees the elements pushed before it
+    m_bottom.store(bottom, std::memory_order_release);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    auto top{m_top.load(std::memory_order_relaxed)};
+
+    if (top > bottom)
+    {
+        m_bottom.store(bottom + 1, std::memory_order_release);
+        return std::nullopt;
+    }
+
+    std::optional<T> value{array->get(bottom)};
+
+    // Last element: thieves may be after it too, the top decides
+    if (top == bottom)
+    {
+        if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                           std::memory_order_relaxed))
+            value.reset();
+
+        m_bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    return value;
+}
+
+/**
+ * @brief
+ * Remove the element at the top, the oldest one. Any thread.
+ * @tparam T Type of the data
+ * @return std::optional<T> Element removed, std::nullopt if the deque is
+ * empty or another thread won the race for the top element
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> WorkStealingDeque<T>::steal()
+{
+    auto top{m_top.load(std::memory_order_acquire)};
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto const bottom{m_bottom.load(std::memory_order_acquire)};
+
+    if (top >= bottom)
+        return std::nullopt;
+
+    // Read before the compare-and-swap: once the top moves, the owner may
+    // overwrite the slot
+    auto const value{m_array.load(std::memory_order_acquire)->get(top)};
+
+    if (!m_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                       std::memory_order_relaxed))
+        return std::nullopt;
+
+    return value;
+}
+
+// Private Functions
+/**
+ * @brief
+ * Copy the live elements into an array twice as large and publish it. The
+ * old array stays allocated for thieves that are still reading it.
+ * @tparam T Type of the data
+ * @param array Current array
+ * @param top Index of the top element
+ * @param bottom Index one past the bottom element
+ * @return Array* The new array
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+typename WorkStealingDeque<T>::Array *
+WorkStealingDeque<T>::grow(Array *array, std::int64_t top, std::int64_t bottom)
+{
+    auto grown{std::make_unique<Array>(2 * (static_cast<std::size_t>(array->mask) + 1))};
+
+    for (auto index{top}; index < bottom; ++index)
+        grown->put(index, array->get(index));
+
+    m_arrays.push_back(std::move(grown));
+    m_array.store(m_arrays.back().get(), std::memory_order_release);
+
+    return m_arrays.back().get();
+}
+
+#endif //! WORK_STEALING_DEQUE_CPP
@@ -0,0 +1,98 @@
+/**
+ * @file WorkStealingDeque.h
+ * @author Carlos Salguero
+ * @brief Declaration of the WorkStealingDeque class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef WORK_STEALING_DEQUE_H
+#define WORK_STEALING_DEQUE_H
+
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::int64_t
+#include <memory>   // std::unique_ptr
+#include <optional> // C++17, std::optional encapsulation
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief
+ * Chase-Lev work-stealing deque. One owner thread pushes and pops at the
+ * bottom like a stack, while any number of thief threads steal from the
+ * top. The owner only needs a compare-and-swap when it races a thief for
+ * the last element. The elements live in a circular array that the owner
+ * doubles when it is full; replaced arrays are kept until the deque is
+ * destroyed because a thief may still be reading them.
+ * @tparam T Type of the data, trivially copyable (typically a pointer)
+ */
+template <class T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "WorkStealingDeque stores its elements in atomics");
+
+public:
+    static constexpr std::size_t MIN_CAPACITY = 64;
+
+    // Constructor
+    explicit WorkStealingDeque(std::size_t capacity = MIN_CAPACITY);
+    WorkStealingDeque(const WorkStealingDeque &) = delete;
+
+    // Destructor
+    ~WorkStealingDeque() = default;
+
+    // Operator overloads
+    WorkStealingDeque &operator=(const WorkStealingDeque &) = delete;
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    // Functions
+    bool is_empty() const;
+
+    // Owner
+    void push(T);
+    std::optional<T> pop();
+
+    // Thieves
+    std::optional<T> steal();
+
+private:
+    struct Array
+    {
+        explicit Array(std::size_t size)
+            : mask{static_cast<std::int64_t>(size) - 1}, slots{std::make_unique<std::atomic<T>[]>(size)}
+        {
+        }
+
+        T get(std::int64_t index) const
+        {
+            return slots[index & mask].load(std::memory_order_relaxed);
+        }
+
+        void put(std::int64_t index, T value)
+        {
+            slots[index & mask].store(value, std::memory_order_relaxed);
+        }
+
+        std::int64_t mask;
+        std::unique_ptr<std::atomic<T>[]> slots;
+    };
+
+    alignas(64) std::atomic<std::int64_t> m_top{0};
+    alignas(64) std::atomic<std::int64_t> m_bottom{0};
+    std::atomic<Array *> m_array;
+
+    // Owner only: every array ever used, the current one last
+    std::vector<std::unique_ptr<Array>> m_arrays;
+
+    Array *grow(Array *, std::int64_t, std::int64_t);
+};
+
+#endif //! WORK_STEALING_DEQUE_H
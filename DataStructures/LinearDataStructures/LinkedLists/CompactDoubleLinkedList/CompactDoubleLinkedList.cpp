@@ -0,0 +1,778 @@
+/**
+ * @file CompactDoubleLinkedList.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the CompactDoubleLinkedList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef COMPACT_DOUBLE_LINKED_LIST_CPP
+#define COMPACT_DOUBLE_LINKED_LIST_CPP
+
+#include <algorithm>   // std::max(), std::min()
+#include <cstring>     // std::memcpy()
+#include <new>         // placement new
+#include <type_traits> // std::is_trivially_copyable_v
+#include <utility>     // std::exchange(), std::move(), std::swap()
+
+#include "CompactDoubleLinkedList.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new CompactDoubleLinkedList< T>:: CompactDoubleLinkedList
+ * object as a copy of other. The copy is compacted, so its handles start at
+ * 0 and follow the list order.
+ * @tparam T Type of the data
+ * @param other List to be copied
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+CompactDoubleLinkedList<T>::CompactDoubleLinkedList(
+    const CompactDoubleLinkedList &other)
+{
+    reserve(other.m_size);
+
+    for (const auto &value : other)
+        push_back(value);
+}
+
+/**
+ * @brief
+ * Construct a new CompactDoubleLinkedList< T>:: CompactDoubleLinkedList
+ * object taking the storage of other, which is left empty. Handles stay
+ * valid and now refer to this list.
+ * @tparam T Type of the data
+ * @param other List to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+CompactDoubleLinkedList<T>::CompactDoubleLinkedList(
+    CompactDoubleLinkedList &&other) noexcept
+    : m_slots{std::move(other.m_slots)},
+      m_capacity{std::exchange(other.m_capacity, 0)},
+      m_used{std::exchange(other.m_used, 0)},
+      m_free{std::exchange(other.m_free, NIL)},
+      m_head{std::exchange(other.m_head, NIL)},
+      m_tail{std::exchange(other.m_tail, NIL)},
+      m_size{std::exchange(other.m_size, 0)}
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the CompactDoubleLinkedList< T>:: CompactDoubleLinkedList object
+ * @tparam T Type of the data
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T>
+CompactDoubleLinkedList<T>::~CompactDoubleLinkedList()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        clear();
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Copy and move assignment
+ * @tparam T Type of the data
+ * @param other List to be assigned
+ * @return CompactDoubleLinkedList& Reference to this list
+ */
+template <class T>
+CompactDoubleLinkedList<T> &
+CompactDoubleLinkedList<T>::operator=(CompactDoubleLinkedList other)
+{
+    std::swap(m_slots, other.m_slots);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_used, other.m_used);
+    std::swap(m_free, other.m_free);
+    std::swap(m_head, other.m_head);
+    std::swap(m_tail, other.m_tail);
+    std::swap(m_size, other.m_size);
+
+    return *this;
+}
+
+/**
+ * @brief
+ * Overload the << operator
+ * @tparam ostream_t Type of the data
+ * @param os Output stream
+ * @param list List to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t>
+std::ostream &operator<<(std::ostream &os,
+                         const CompactDoubleLinkedList<ostream_t> &list)
+{
+    for (const auto &value : list)
+        os << value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements in the list
+ * @tparam T Type of the data
+ * @return std::size_t Size of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t CompactDoubleLinkedList<T>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the number of slots allocated
+ * @tparam T Type of the data
+ * @return std::size_t Capacity of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t CompactDoubleLinkedList<T>::capacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * @brief
+ * Get the bytes used by the list, including unused capacity
+ * @tparam T Type of the data
+ * @return std::size_t Memory in bytes
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t CompactDoubleLinkedList<T>::memory_usage() const
+{
+    return sizeof(*this) + m_capacity * sizeof(Slot);
+}
+
+/**
+ * @brief
+ * Get the handle of the first element
+ * @tparam T Type of the data
+ * @return handle_t Handle of the head, NIL if the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::get_head() const
+{
+    return m_head;
+}
+
+/**
+ * @brief
+ * Get the handle of the last element
+ * @tparam T Type of the data
+ * @return handle_t Handle of the tail, NIL if the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::get_tail() const
+{
+    return m_tail;
+}
+
+/**
+ * @brief
+ * Get the handle that follows the given one
+ * @tparam T Type of the data
+ * @param handle Handle of an element
+ * @return handle_t Next handle, NIL after the tail
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::next(handle_t handle) const
+{
+    return m_slots[handle].next;
+}
+
+/**
+ * @brief
+ * Get the handle that precedes the given one
+ * @tparam T Type of the data
+ * @param handle Handle of an element
+ * @return handle_t Previous handle, NIL before the head
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::prev(handle_t handle) const
+{
+    return m_slots[handle].prev;
+}
+
+/**
+ * @brief
+ * Get the element stored under a handle
+ * @tparam T Type of the data
+ * @param handle Handle of the element
+ * @throw std::out_of_range If the handle does not refer to an element
+ * @return T& Element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &CompactDoubleLinkedList<T>::get(handle_t handle)
+{
+    check(handle);
+
+    return *value_at(handle);
+}
+
+template <class T>
+const T &CompactDoubleLinkedList<T>::get(handle_t handle) const
+{
+    check(handle);
+
+    return *value_at(handle);
+}
+
+/**
+ * @brief
+ * Get the first element
+ * @tparam T Type of the data
+ * @return std::optional<T> First element, std::nullopt if empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> CompactDoubleLinkedList<T>::get_front() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return *value_at(m_head);
+}
+
+/**
+ * @brief
+ * Get the last element
+ * @tparam T Type of the data
+ * @return std::optional<T> Last element, std::nullopt if empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> CompactDoubleLinkedList<T>::get_last() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return *value_at(m_tail);
+}
+
+// Iterators
+/**
+ * @brief
+ * Iterator to the first element
+ * @tparam T Type of the data
+ * @return const_iterator Iterator to the head
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::const_iterator
+CompactDoubleLinkedList<T>::begin() const
+{
+    return const_iterator{this, m_head};
+}
+
+/**
+ * @brief
+ * Past-the-end iterator
+ * @tparam T Type of the data
+ * @return const_iterator Iterator past the tail
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::const_iterator
+CompactDoubleLinkedList<T>::end() const
+{
+    return const_iterator{this, NIL};
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the list is empty
+ * @tparam T Type of the data
+ * @return true If the list is empty
+ * @return false If the list is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool CompactDoubleLinkedList<T>::is_empty() const
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief
+ * Checks if the list contains the given data
+ * @tparam T Type of the data
+ * @param data Data to be searched
+ * @return true If the list contains the data
+ * @return false If the list does not contain the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+bool CompactDoubleLinkedList<T>::contains(const T &data) const
+{
+    for (const auto &value : *this)
+        if (value == data)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief
+ * Make room for at least the given number of elements
+ * @tparam T Type of the data
+ * @param count Number of elements
+ * @throw std::length_error If count exceeds MAX_SIZE
+ * @time complexity O(n) when the storage grows
+ * @space complexity O(count)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::reserve(std::size_t count)
+{
+    if (count > MAX_SIZE)
+        throw std::length_error("CompactDoubleLinkedList capacity exceeded");
+
+    if (count > m_capacity)
+        grow(count);
+}
+
+/**
+ * @brief
+ * Remove every element. The storage is kept and handles restart from 0.
+ * @tparam T Type of the data
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::clear()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        for (auto handle{m_head}; handle != NIL; handle = m_slots[handle].next)
+            value_at(handle)->~T();
+
+    m_used = 0;
+    m_free = NIL;
+    m_head = NIL;
+    m_tail = NIL;
+    m_size = 0;
+}
+
+/**
+ * @brief
+ * Add an element to the front of the list
+ * @tparam T Type of the data
+ * @param data Data to be stored
+ * @return handle_t Handle of the new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::push_front(const T &data)
+{
+    auto const handle{allocate(data)};
+    link_before(handle, m_head);
+
+    return handle;
+}
+
+/**
+ * @brief
+ * Add an element to the back of the list
+ * @tparam T Type of the data
+ * @param data Data to be stored
+ * @return handle_t Handle of the new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::push_back(const T &data)
+{
+    auto const handle{allocate(data)};
+    link_before(handle, NIL);
+
+    return handle;
+}
+
+/**
+ * @brief
+ * Add an element before the given one
+ * @tparam T Type of the data
+ * @param position Handle of the element that will follow the new one
+ * @param data Data to be stored
+ * @throw std::out_of_range If position does not refer to an element
+ * @return handle_t Handle of the new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::insert_before(handle_t position, const T &data)
+{
+    check(position);
+
+    auto const handle{allocate(data)};
+    link_before(handle, position);
+
+    return handle;
+}
+
+/**
+ * @brief
+ * Add an element after the given one
+ * @tparam T Type of the data
+ * @param position Handle of the element that will precede the new one
+ * @param data Data to be stored
+ * @throw std::out_of_range If position does not refer to an element
+ * @return handle_t Handle of the new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::insert_after(handle_t position, const T &data)
+{
+    check(position);
+
+    auto const handle{allocate(data)};
+    link_before(handle, m_slots[position].next);
+
+    return handle;
+}
+
+/**
+ * @brief
+ * Remove the first element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::pop_front()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    erase(m_head);
+}
+
+/**
+ * @brief
+ * Remove the last element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::pop_back()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    erase(m_tail);
+}
+
+/**
+ * @brief
+ * Remove the element with the given handle and recycle its slot
+ * @tparam T Type of the data
+ * @param handle Handle of the element
+ * @throw std::out_of_range If the handle does not refer to an element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::erase(handle_t handle)
+{
+    check(handle);
+    unlink(handle);
+    value_at(handle)->~T();
+
+    m_slots[handle].prev = FREED;
+    m_slots[handle].next = m_free;
+    m_free = handle;
+    --m_size;
+}
+
+/**
+ * @brief
+ * Move an element of this list right before another one
+ * @tparam T Type of the data
+ * @param position Handle of the element that will follow, NIL for the back
+ * @param handle Handle of the element to be moved
+ * @throw std::out_of_range If a handle does not refer to an element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::splice(handle_t position, handle_t handle)
+{
+    check(handle);
+
+    if (position != NIL)
+        check(position);
+
+    if (position == handle || m_slots[handle].next == position)
+        return;
+
+    unlink(handle);
+    link_before(handle, position);
+}
+
+/**
+ * @brief
+ * Move an element to the front of the list
+ * @tparam T Type of the data
+ * @param handle Handle of the element
+ * @throw std::out_of_range If the handle does not refer to an element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::move_to_front(handle_t handle)
+{
+    splice(m_head, handle);
+}
+
+/**
+ * @brief
+ * Move an element to the back of the list
+ * @tparam T Type of the data
+ * @param handle Handle of the element
+ * @throw std::out_of_range If the handle does not refer to an element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::move_to_back(handle_t handle)
+{
+    splice(NIL, handle);
+}
+
+/**
+ * @brief
+ * Prints the list to a string
+ * @tparam T Type of the data
+ * @return std::string String representation of the list
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string CompactDoubleLinkedList<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+template <class T>
+T *CompactDoubleLinkedList<T>::value_at(handle_t handle)
+{
+    return std::launder(reinterpret_cast<T *>(m_slots[handle].storage));
+}
+
+template <class T>
+const T *CompactDoubleLinkedList<T>::value_at(handle_t handle) const
+{
+    return std::launder(reinterpret_cast<const T *>(m_slots[handle].storage));
+}
+
+/**
+ * @brief
+ * Throw if a handle does not refer to a live element
+ * @tparam T Type of the data
+ * @param handle Handle to be checked
+ * @throw std::out_of_range If the slot is unused or was erased
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::check(handle_t handle) const
+{
+    if (handle >= m_used || m_slots[handle].prev == FREED)
+        throw std::out_of_range("Invalid handle");
+}
+
+/**
+ * @brief
+ * Take a slot, from the free list if possible, and construct data in it
+ * @tparam T Type of the data
+ * @param data Data to be stored
+ * @return handle_t Handle of the detached slot
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+typename CompactDoubleLinkedList<T>::handle_t
+CompactDoubleLinkedList<T>::allocate(const T &data)
+{
+    handle_t handle;
+
+    if (m_free != NIL)
+    {
+        handle = m_free;
+        new (m_slots[handle].storage) T(data);
+        m_free = m_slots[handle].next;
+    }
+    else
+    {
+        if (m_used == m_capacity)
+        {
+            if (m_capacity == MAX_SIZE)
+                throw std::length_error("CompactDoubleLinkedList capacity exceeded");
+
+            // data may be an element of the list, which grow() moves and
+            // frees, so it is copied out first
+            T copy{data};
+
+            grow(std::min(std::max<std::size_t>(16, m_capacity * 2), MAX_SIZE));
+
+            handle = m_used;
+            new (m_slots[handle].storage) T(std::move(copy));
+        }
+        else
+        {
+            handle = m_used;
+            new (m_slots[handle].storage) T(data);
+        }
+
+        ++m_used;
+    }
+
+    ++m_size;
+
+    return handle;
+}
+
+/**
+ * @brief
+ * Link a detached slot before position, at the back for NIL
+ * @tparam T Type of the data
+ * @param handle Detached slot
+ * @param position Handle of the element that will follow, or NIL
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::link_before(handle_t handle, handle_t position)
+{
+    auto const before{position == NIL ? m_tail : m_slots[position].prev};
+
+    m_slots[handle].prev = before;
+    m_slots[handle].next = position;
+
+    if (before == NIL)
+        m_head = handle;
+    else
+        m_slots[before].next = handle;
+
+    if (position == NIL)
+        m_tail = handle;
+    else
+        m_slots[position].prev = handle;
+}
+
+/**
+ * @brief
+ * Detach a slot from its neighbours
+ * @tparam T Type of the data
+ * @param handle Slot to be detached
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::unlink(handle_t handle)
+{
+    auto const before{m_slots[handle].prev};
+    auto const after{m_slots[handle].next};
+
+    if (before == NIL)
+        m_head = after;
+    else
+        m_slots[before].next = after;
+
+    if (after == NIL)
+        m_tail = before;
+    else
+        m_slots[after].prev = before;
+}
+
+/**
+ * @brief
+ * Move the slots to a bigger array. Links are copied as they are, so every
+ * handle keeps referring to the same element.
+ * @tparam T Type of the data
+ * @param capacity New number of slots
+ * @time complexity O(n)
+ * @space complexity O(capacity)
+ */
+template <class T>
+void CompactDoubleLinkedList<T>::grow(std::size_t capacity)
+{
+    auto slots{std::make_unique_for_overwrite<Slot[]>(capacity)};
+
+    if constexpr (std::is_trivially_copyable_v<T>)
+    {
+        if (m_used != 0)
+            std::memcpy(slots.get(), m_slots.get(), m_used * sizeof(Slot));
+    }
+    else
+    {
+        for (handle_t handle{}; handle < m_used; ++handle)
+        {
+            slots[handle].prev = m_slots[handle].prev;
+            slots[handle].next = m_slots[handle].next;
+        }
+
+        for (auto handle{m_head}; handle != NIL; handle = m_slots[handle].next)
+        {
+            new (slots[handle].storage) T(std::move(*value_at(handle)));
+            value_at(handle)->~T();
+        }
+    }
+
+    m_slots = std::move(slots);
+    m_capacity = capacity;
+}
+
+#endif //! COMPACT_DOUBLE_LINKED_LIST_CPP
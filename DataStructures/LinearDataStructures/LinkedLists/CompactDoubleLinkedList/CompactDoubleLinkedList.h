@@ -0,0 +1,177 @@
+/**
+ * @file CompactDoubleLinkedList.h
+ * @author Carlos Salguero
+ * @brief Declaration of the CompactDoubleLinkedList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef COMPACT_DOUBLE_LINKED_LIST_H
+#define COMPACT_DOUBLE_LINKED_LIST_H
+
+#include <cstddef>   // std::size_t, std::byte
+#include <cstdint>   // std::uint32_t
+#include <iterator>  // std::bidirectional_iterator_tag
+#include <limits>    // std::numeric_limits
+#include <memory>    // std::unique_ptr
+#include <optional>  // C++17, std::optional encapsulation
+#include <sstream>   // std::stringstream for to_string() function
+#include <stdexcept> // std::runtime_error, std::length_error
+#include <string>
+
+/**
+ * @brief
+ * Doubly linked list whose nodes live in one contiguous array and link to
+ * each other with 32-bit indices. Erased slots go to a free list and are
+ * reused by the next insertion. Every insertion returns a handle (the slot
+ * index) that stays valid until that element is erased, also across growth.
+ * @tparam T Type of the data
+ */
+template <class T>
+class CompactDoubleLinkedList
+{
+public:
+    using handle_t = std::uint32_t;
+
+    static constexpr handle_t NIL = std::numeric_limits<handle_t>::max();
+    static constexpr std::size_t MAX_SIZE = NIL - 1;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+        const_iterator(const CompactDoubleLinkedList *list, handle_t handle)
+            : m_list{list}, m_handle{handle} {}
+
+        reference operator*() const { return *m_list->value_at(m_handle); }
+        pointer operator->() const { return m_list->value_at(m_handle); }
+
+        const_iterator &operator++()
+        {
+            m_handle = m_list->next(m_handle);
+            return *this;
+        }
+
+        const_iterator &operator--()
+        {
+            m_handle = m_handle == NIL ? m_list->m_tail : m_list->prev(m_handle);
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        const_iterator operator--(int)
+        {
+            auto copy{*this};
+            --*this;
+            return copy;
+        }
+
+        handle_t get_handle() const { return m_handle; }
+
+        bool operator==(const const_iterator &) const = default;
+
+    private:
+        const CompactDoubleLinkedList *m_list{};
+        handle_t m_handle{NIL};
+    };
+
+    // Constructor
+    CompactDoubleLinkedList() = default;
+    CompactDoubleLinkedList(const CompactDoubleLinkedList &);
+    CompactDoubleLinkedList(CompactDoubleLinkedList &&) noexcept;
+
+    // Destructor
+    ~CompactDoubleLinkedList();
+
+    // Operator Overloads
+    CompactDoubleLinkedList &operator=(CompactDoubleLinkedList);
+
+    template <class ostream_t>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const CompactDoubleLinkedList<ostream_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+    std::size_t memory_usage() const;
+
+    handle_t get_head() const;
+    handle_t get_tail() const;
+    handle_t next(handle_t) const;
+    handle_t prev(handle_t) const;
+
+    T &get(handle_t);
+    const T &get(handle_t) const;
+    std::optional<T> get_front() const;
+    std::optional<T> get_last() const;
+
+    // Iterators
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    void reserve(std::size_t);
+    void clear();
+
+    handle_t push_front(const T &);
+    handle_t push_back(const T &);
+    handle_t insert_before(handle_t, const T &);
+    handle_t insert_after(handle_t, const T &);
+
+    void pop_front();
+    void pop_back();
+    void erase(handle_t);
+
+    void splice(handle_t, handle_t);
+    void move_to_front(handle_t);
+    void move_to_back(handle_t);
+
+    std::string to_string() const;
+
+private:
+    struct Slot
+    {
+        handle_t prev;
+        handle_t next;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    std::unique_ptr<Slot[]> m_slots;
+    std::size_t m_capacity{};
+    handle_t m_used{};
+    handle_t m_free{NIL};
+    handle_t m_head{NIL};
+    handle_t m_tail{NIL};
+    std::size_t m_size{};
+
+    static constexpr handle_t FREED = NIL - 1;
+
+    T *value_at(handle_t);
+    const T *value_at(handle_t) const;
+    void check(handle_t) const;
+
+    handle_t allocate(const T &);
+    void link_before(handle_t, handle_t);
+    void unlink(handle_t);
+    void grow(std::size_t);
+};
+
+#endif //! COMPACT_DOUBLE_LINKED_LIST_H
@@ -0,0 +1,490 @@
+/**
+ * @file ConcurrentSkipList.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the ConcurrentSkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <bit>     // C++20, std::countr_zero()
+#include <cstdint> // std::uint64_t
+
+#include "ConcurrentSkipList.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new ConcurrentSkipList< T, Compare>:: ConcurrentSkipList object
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param cmp Comparison object
+ */
+template <class T, class Compare>
+ConcurrentSkipList<T, Compare>::ConcurrentSkipList(const Compare &cmp)
+    : m_cmp{cmp}
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the ConcurrentSkipList< T, Compare>:: ConcurrentSkipList object.
+ * No other thread may be using the list.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+ConcurrentSkipList<T, Compare>::~ConcurrentSkipList()
+{
+    auto *current{node_t::pointer(m_head[0].load(std::memory_order_acquire))};
+
+    while (current != nullptr)
+    {
+        auto *next{node_t::pointer(
+            current->links()[0].load(std::memory_order_relaxed))};
+
+        node_t::destroy(current);
+        current = next;
+    }
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator. Concurrent updates may or may not show up.
+ * @tparam ostream_t Type of the data
+ * @tparam compare_t Strict weak ordering of the elements
+ * @param os Output stream
+ * @param list List to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class compare_t>
+std::ostream &operator<<(std::ostream &os,
+                         const ConcurrentSkipList<ostream_t, compare_t> &list)
+{
+    using node_t = ConcurrentSkipListNode<ostream_t>;
+
+    auto guard{EpochManager::instance().pin()};
+    auto *current{node_t::pointer(list.m_head[0].load(std::memory_order_acquire))};
+
+    while (current != nullptr)
+    {
+        auto const next{current->links()[0].load(std::memory_order_acquire)};
+
+        if (!node_t::marked(next))
+            os << current->data << " ";
+
+        current = node_t::pointer(next);
+    }
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements. Only exact while no update is in flight.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::size_t Size of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t ConcurrentSkipList<T, Compare>::get_size() const
+{
+    auto const size{m_size.load(std::memory_order_relaxed)};
+
+    return size > 0 ? static_cast<std::size_t>(size) : 0;
+}
+
+/**
+ * @brief
+ * Get the smallest element that is not being removed
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::optional<T> Smallest element, std::nullopt if empty
+ * @time complexity O(1) without concurrent removals
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::optional<T> ConcurrentSkipList<T, Compare>::get_front() const
+{
+    auto guard{EpochManager::instance().pin()};
+    auto *current{node_t::pointer(m_head[0].load(std::memory_order_acquire))};
+
+    while (current != nullptr)
+    {
+        auto const next{current->links()[0].load(std::memory_order_acquire)};
+
+        if (!node_t::marked(next))
+            return current->data;
+
+        current = node_t::pointer(next);
+    }
+
+    return std::nullopt;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the list is empty
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return true If the list is empty
+ * @return false If the list is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool ConcurrentSkipList<T, Compare>::is_empty() const
+{
+    return get_size() == 0;
+}
+
+/**
+ * @brief
+ * Checks if the list contains value. Never writes to shared memory: marked
+ * nodes are stepped over instead of unlinked.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be searched
+ * @return true If the value is in the list
+ * @return false If the value is not in the list
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool ConcurrentSkipList<T, Compare>::contains(const T &value) const
+{
+    auto guard{EpochManager::instance().pin()};
+    node_t *pred{};
+    node_t *current{};
+
+    for (auto level{m_height.load(std::memory_order_acquire)}; level-- > 0;)
+    {
+        current = node_t::pointer(links_of(pred)[level].load(std::memory_order_acquire));
+
+        while (current != nullptr)
+        {
+            auto next{current->links()[level].load(std::memory_order_acquire)};
+
+            while (node_t::marked(next))
+            {
+                current = node_t::pointer(next);
+
+                if (current == nullptr)
+                    break;
+
+                next = current->links()[level].load(std::memory_order_acquire);
+            }
+
+            if (current == nullptr || !m_cmp(current->data, value))
+                break;
+
+            pred = current;
+            current = node_t::pointer(next);
+        }
+    }
+
+    return current != nullptr && !m_cmp(value, current->data);
+}
+
+/**
+ * @brief
+ * Insert value if no equivalent element is present
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be inserted
+ * @return true If the value was inserted
+ * @return false If an equivalent element was already present
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1) expected
+ */
+template <class T, class Compare>
+bool ConcurrentSkipList<T, Compare>::insert(const T &value)
+{
+    auto guard{EpochManager::instance().pin()};
+    auto const height{random_height()};
+
+    for (auto top{m_height.load(std::memory_order_relaxed)}; top < height;)
+        if (m_height.compare_exchange_weak(top, height, std::memory_order_acq_rel))
+            break;
+
+    path_t preds;
+    path_t succs;
+    node_t *node{};
+
+    while (true)
+    {
+        if (find(value, preds, succs))
+        {
+            if (node != nullptr)
+                node_t::destroy(node);
+
+            return false;
+        }
+
+        if (node == nullptr)
+            node = node_t::create(height, value);
+
+        for (std::size_t level{}; level < height; ++level)
+            node->links()[level].store(node_t::word(succs[level]),
+                                       std::memory_order_relaxed);
+
+        auto expected{node_t::word(succs[0])};
+
+        if (links_of(preds[0])[0].compare_exchange_strong(
+                expected, node_t::word(node), std::memory_order_acq_rel))
+            break;
+    }
+
+    m_size.fetch_add(1, std::memory_order_relaxed);
+
+    auto abandoned{false};
+
+    for (std::size_t level{1}; level < height && !abandoned; ++level)
+    {
+        while (true)
+        {
+            auto own{node->links()[level].load(std::memory_order_acquire)};
+
+            if (node_t::marked(own))
+            {
+                abandoned = true;
+                break;
+            }
+
+            if (node_t::pointer(own) != succs[level] &&
+                !node->links()[level].compare_exchange_strong(
+                    own, node_t::word(succs[level]), std::memory_order_acq_rel))
+                continue;
+
+            auto expected{node_t::word(succs[level])};
+
+            if (links_of(preds[level])[level].compare_exchange_strong(
+                    expected, node_t::word(node), std::memory_order_acq_rel))
+                break;
+
+            find(value, preds, succs);
+
+            if (succs[0] != node)
+            {
+                abandoned = true;
+                break;
+            }
+        }
+    }
+
+    release(node, value);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Remove the element equivalent to value. The node is marked on every level,
+ * top to bottom; whoever marks level 0 owns the removal.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be removed
+ * @return true If this call removed the element
+ * @return false If the value is not in the list
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool ConcurrentSkipList<T, Compare>::remove(const T &value)
+{
+    auto guard{EpochManager::instance().pin()};
+    path_t preds;
+    path_t succs;
+
+    if (!find(value, preds, succs))
+        return false;
+
+    auto *node{succs[0]};
+
+    for (auto level{node->height}; level-- > 1;)
+    {
+        auto next{node->links()[level].load(std::memory_order_acquire)};
+
+        while (!node_t::marked(next) &&
+               !node->links()[level].compare_exchange_weak(
+                   next, next | node_t::MARK, std::memory_order_acq_rel))
+        {
+        }
+    }
+
+    auto next{node->links()[0].load(std::memory_order_acquire)};
+
+    while (!node_t::marked(next))
+    {
+        if (node->links()[0].compare_exchange_weak(
+                next, next | node_t::MARK, std::memory_order_acq_rel))
+        {
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            release(node, value);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief
+ * Prints the list to a string
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::string String representation of the list
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, class Compare>
+std::string ConcurrentSkipList<T, Compare>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Tower of links of a node, the head links for nullptr
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param node Node, nullptr for the head
+ * @return link_t* Links of the node
+ */
+template <class T, class Compare>
+typename ConcurrentSkipList<T, Compare>::link_t *
+ConcurrentSkipList<T, Compare>::links_of(node_t *node) const
+{
+    return node != nullptr ? node->links() : m_head.data();
+}
+
+/**
+ * @brief
+ * Fill preds and succs with the last node less than value and the first
+ * node not less than value on every level, unlinking the marked nodes met
+ * on the way
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be searched
+ * @param preds Predecessors, nullptr for the head
+ * @param succs Successors, nullptr for the end
+ * @return true If succs[0] holds an element equivalent to value
+ * @return false Otherwise
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool ConcurrentSkipList<T, Compare>::find(const T &value, path_t &preds,
+                                          path_t &succs) const
+{
+retry:
+    node_t *pred{};
+
+    for (auto level{m_height.load(std::memory_order_acquire)}; level-- > 0;)
+    {
+        auto *current{node_t::pointer(
+            links_of(pred)[level].load(std::memory_order_acquire))};
+
+        while (current != nullptr)
+        {
+            auto next{current->links()[level].load(std::memory_order_acquire)};
+
+            while (node_t::marked(next))
+            {
+                auto expected{node_t::word(current)};
+
+                if (!links_of(pred)[level].compare_exchange_strong(
+                        expected, node_t::word(node_t::pointer(next)),
+                        std::memory_order_acq_rel))
+                    goto retry;
+
+                current = node_t::pointer(next);
+
+                if (current == nullptr)
+                    break;
+
+                next = current->links()[level].load(std::memory_order_acquire);
+            }
+
+            if (current == nullptr || !m_cmp(current->data, value))
+                break;
+
+            pred = current;
+            current = node_t::pointer(next);
+        }
+
+        preds[level] = pred;
+        succs[level] = current;
+    }
+
+    return succs[0] != nullptr && !m_cmp(value, succs[0]->data);
+}
+
+/**
+ * @brief
+ * Called once by the inserter, when it stops linking upper levels, and once
+ * by the remover. If the node is marked, unlink it from every level; the
+ * second caller retires it, since by then nobody links it again.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param node Node the caller is done with
+ * @param value Value of the node
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void ConcurrentSkipList<T, Compare>::release(node_t *node, const T &value) const
+{
+    if (node_t::marked(node->links()[0].load(std::memory_order_acquire)))
+    {
+        path_t preds;
+        path_t succs;
+
+        find(value, preds, succs);
+    }
+
+    if (node->pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        EpochManager::instance().retire(node, &node_t::destroy);
+}
+
+/**
+ * @brief
+ * Draw a tower height with P(height > h) = 4^-h from a per-thread
+ * xorshift64* generator
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::size_t Height in [1, MAX_HEIGHT]
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t ConcurrentSkipList<T, Compare>::random_height()
+{
+    thread_local std::uint64_t state{
+        0x9E3779B97F4A7C15ULL ^ reinterpret_cast<std::uintptr_t>(&state)};
+
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+
+    auto const bits{state * 0x2545F4914F6CDD1DULL};
+
+    return 1 + std::countr_zero(bits | (1ULL << 62)) / 2;
+}
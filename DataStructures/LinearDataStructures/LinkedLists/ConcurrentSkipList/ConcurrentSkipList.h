@@ -0,0 +1,86 @@
+/**
+ * @file ConcurrentSkipList.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ConcurrentSkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_SKIP_LIST_H
+#define CONCURRENT_SKIP_LIST_H
+
+#include <array>
+#include <atomic>
+#include <functional> // std::less<>
+#include <optional>   // C++17, std::optional encapsulation
+#include <sstream>    // std::stringstream for to_string()
+#include <string>
+
+// Custom Headers
+#include "ConcurrentSkipListNode.h"
+#include "../../../Concurrency/EpochManager.h"
+
+/**
+ * @brief
+ * Lock-free ordered set (Herlihy, Lev, Luchangco and Shavit; Fraser).
+ * contains() is wait-free, insert() and remove() are lock-free. Removed
+ * nodes are reclaimed through the EpochManager.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ */
+template <class T, class Compare = std::less<T>>
+class ConcurrentSkipList
+{
+    using node_t = ConcurrentSkipListNode<T>;
+    using link_t = typename node_t::link_t;
+
+public:
+    static constexpr std::size_t MAX_HEIGHT = 32;
+
+    // Constructor
+    ConcurrentSkipList(const Compare &cmp = Compare{});
+    ConcurrentSkipList(const ConcurrentSkipList &) = delete;
+
+    // Destructor
+    ~ConcurrentSkipList();
+
+    // Operator Overload
+    ConcurrentSkipList &operator=(const ConcurrentSkipList &) = delete;
+
+    template <class ostream_t, class compare_t>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const ConcurrentSkipList<ostream_t, compare_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::optional<T> get_front() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    bool insert(const T &);
+    bool remove(const T &);
+
+    std::string to_string() const;
+
+private:
+    using path_t = std::array<node_t *, MAX_HEIGHT>;
+
+    mutable std::array<link_t, MAX_HEIGHT> m_head{};
+    std::atomic<std::size_t> m_height{1};
+    std::atomic<std::ptrdiff_t> m_size{0};
+    Compare m_cmp;
+
+    link_t *links_of(node_t *) const;
+
+    bool find(const T &, path_t &, path_t &) const;
+    void release(node_t *, const T &) const;
+
+    static std::size_t random_height();
+};
+
+#endif //! CONCURRENT_SKIP_LIST_H
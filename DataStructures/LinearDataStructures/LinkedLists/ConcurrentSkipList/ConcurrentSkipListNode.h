@@ -0,0 +1,121 @@
+/**
+ * @file ConcurrentSkipListNode.h
+ * @author Carlos Salguero
+ * @brief Node declaration for the ConcurrentSkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_SKIP_LIST_NODE_H
+#define CONCURRENT_SKIP_LIST_NODE_H
+
+#include <atomic>
+#include <cstddef> // std::size_t, std::byte
+#include <cstdint> // std::uintptr_t
+#include <new>     // ::operator new(), placement new
+#include <utility> // std::forward()
+
+/**
+ * @brief
+ * Node of a lock-free skip list. Every forward link is an atomic word whose
+ * lowest bit marks the owner as logically deleted on that level. The tower
+ * of links is stored inline after the node.
+ * @tparam T Type of the data
+ */
+template <class T>
+struct ConcurrentSkipListNode
+{
+    using link_t = std::atomic<std::uintptr_t>;
+
+    static constexpr std::uintptr_t MARK = 1;
+
+    /**
+     * @brief
+     * Allocate and construct a node of the given height
+     * @param height Number of levels of the node
+     * @param args Arguments forwarded to the constructor of T
+     * @return ConcurrentSkipListNode* New node, every link nullptr
+     */
+    template <class... Args>
+    static ConcurrentSkipListNode *create(std::size_t height, Args &&...args)
+    {
+        void *block{::operator new(links_offset() + height * sizeof(link_t))};
+
+        try
+        {
+            return new (block) ConcurrentSkipListNode(height,
+                                                      std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            ::operator delete(block);
+            throw;
+        }
+    }
+
+    /**
+     * @brief
+     * Destroy and free a node created with create(). Has the signature
+     * EpochManager::retire() expects.
+     * @param pointer Node to be released
+     */
+    static void destroy(void *pointer)
+    {
+        auto *node{static_cast<ConcurrentSkipListNode *>(pointer)};
+
+        for (std::size_t i = 0; i < node->height; ++i)
+            node->links()[i].~link_t();
+
+        node->~ConcurrentSkipListNode();
+        ::operator delete(pointer);
+    }
+
+    link_t *links()
+    {
+        return reinterpret_cast<link_t *>(
+            reinterpret_cast<std::byte *>(this) + links_offset());
+    }
+
+    static constexpr std::size_t links_offset()
+    {
+        return (sizeof(ConcurrentSkipListNode) + alignof(link_t) - 1) /
+               alignof(link_t) * alignof(link_t);
+    }
+
+    static ConcurrentSkipListNode *pointer(std::uintptr_t link)
+    {
+        return reinterpret_cast<ConcurrentSkipListNode *>(link & ~MARK);
+    }
+
+    static bool marked(std::uintptr_t link) { return (link & MARK) != 0; }
+
+    static std::uintptr_t word(const ConcurrentSkipListNode *node,
+                               bool mark = false)
+    {
+        return reinterpret_cast<std::uintptr_t>(node) | (mark ? MARK : 0);
+    }
+
+    T data;
+    std::size_t height;
+
+    /**
+     * @brief
+     * Parties that still have to finish with the node before it can be
+     * retired: the inserter linking the upper levels and the remover.
+     */
+    std::atomic<int> pending{2};
+
+private:
+    template <class... Args>
+    ConcurrentSkipListNode(std::size_t tower_height, Args &&...args)
+        : data(std::forward<Args>(args)...), height(tower_height)
+    {
+        for (std::size_t i = 0; i < height; ++i)
+            new (links() + i) link_t{0};
+    }
+};
+
+#endif //! CONCURRENT_SKIP_LIST_NODE_H
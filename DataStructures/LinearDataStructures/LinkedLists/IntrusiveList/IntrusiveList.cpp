@@ -0,0 +1,435 @@
+/**
+ * @file IntrusiveList.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the IntrusiveList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <utility> // std::exchange()
+
+#include "IntrusiveList.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new IntrusiveList< T, Tag>:: IntrusiveList object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ */
+template <class T, class Tag>
+IntrusiveList<T, Tag>::IntrusiveList()
+{
+    m_root.m_prev = &m_root;
+    m_root.m_next = &m_root;
+}
+
+/**
+ * @brief
+ * Construct a new IntrusiveList< T, Tag>:: IntrusiveList object taking the
+ * objects of other, which is left empty
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param other List to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+IntrusiveList<T, Tag>::IntrusiveList(IntrusiveList &&other) noexcept
+    : IntrusiveList()
+{
+    if (other.is_empty())
+        return;
+
+    m_root.m_next = other.m_root.m_next;
+    m_root.m_prev = other.m_root.m_prev;
+    m_root.m_next->m_prev = &m_root;
+    m_root.m_prev->m_next = &m_root;
+    m_size = std::exchange(other.m_size, 0);
+
+    other.m_root.m_prev = &other.m_root;
+    other.m_root.m_next = &other.m_root;
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the IntrusiveList< T, Tag>:: IntrusiveList object. The objects
+ * are unlinked, not destroyed.
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+IntrusiveList<T, Tag>::~IntrusiveList()
+{
+    clear();
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator
+ * @tparam ostream_t Type of the objects
+ * @tparam tag_t Selects which hook of the objects the list uses
+ * @param os Output stream
+ * @param list List to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class tag_t>
+std::ostream &operator<<(std::ostream &os,
+                         const IntrusiveList<ostream_t, tag_t> &list)
+{
+    for (const auto &object : list)
+        os << object << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of objects in the list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @return std::size_t Size of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+std::size_t IntrusiveList<T, Tag>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the first object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @return T& First object
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+T &IntrusiveList<T, Tag>::front()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    return *owner(m_root.m_next);
+}
+
+/**
+ * @brief
+ * Get the last object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @return T& Last object
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+T &IntrusiveList<T, Tag>::back()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    return *owner(m_root.m_prev);
+}
+
+// Iterators
+template <class T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::begin()
+{
+    return iterator{m_root.m_next};
+}
+
+template <class T, class Tag>
+typename IntrusiveList<T, Tag>::iterator IntrusiveList<T, Tag>::end()
+{
+    return iterator{&m_root};
+}
+
+template <class T, class Tag>
+typename IntrusiveList<T, Tag>::const_iterator IntrusiveList<T, Tag>::begin() const
+{
+    return const_iterator{m_root.m_next};
+}
+
+template <class T, class Tag>
+typename IntrusiveList<T, Tag>::const_iterator IntrusiveList<T, Tag>::end() const
+{
+    return const_iterator{const_cast<hook_t *>(&m_root)};
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the list is empty
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @return true If the list is empty
+ * @return false If the list is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+bool IntrusiveList<T, Tag>::is_empty() const
+{
+    return m_root.m_next == &m_root;
+}
+
+/**
+ * @brief
+ * Link an object at the front of the list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object to be linked
+ * @throw std::logic_error If the object is already in a list with this tag
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::push_front(T &object)
+{
+    link_before(hook(object), m_root.m_next);
+}
+
+/**
+ * @brief
+ * Link an object at the back of the list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object to be linked
+ * @throw std::logic_error If the object is already in a list with this tag
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::push_back(T &object)
+{
+    link_before(hook(object), &m_root);
+}
+
+/**
+ * @brief
+ * Link an object right before another object of this list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param position Object of this list that will follow the new one
+ * @param object Object to be linked
+ * @throw std::logic_error If object is already linked or position is not
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::insert_before(T &position, T &object)
+{
+    if (!hook(position)->is_linked())
+        throw std::logic_error("Position is not linked");
+
+    link_before(hook(object), hook(position));
+}
+
+/**
+ * @brief
+ * Unlink the first object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::pop_front()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    unlink(m_root.m_next);
+    --m_size;
+}
+
+/**
+ * @brief
+ * Unlink the last object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::pop_back()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    unlink(m_root.m_prev);
+    --m_size;
+}
+
+/**
+ * @brief
+ * Unlink an object of this list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object to be unlinked, must belong to this list
+ * @throw std::logic_error If the object is not linked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::remove(T &object)
+{
+    auto *node{hook(object)};
+
+    if (!node->is_linked())
+        throw std::logic_error("Object is not linked");
+
+    unlink(node);
+    --m_size;
+}
+
+/**
+ * @brief
+ * Move an object of this list to the front
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object of this list
+ * @throw std::logic_error If the object is not linked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::move_to_front(T &object)
+{
+    remove(object);
+    push_front(object);
+}
+
+/**
+ * @brief
+ * Move an object of this list to the back
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object of this list
+ * @throw std::logic_error If the object is not linked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::move_to_back(T &object)
+{
+    remove(object);
+    push_back(object);
+}
+
+/**
+ * @brief
+ * Unlink every object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::clear()
+{
+    auto *current{m_root.m_next};
+
+    while (current != &m_root)
+    {
+        auto *next{current->m_next};
+
+        current->m_prev = nullptr;
+        current->m_next = nullptr;
+        current = next;
+    }
+
+    m_root.m_prev = &m_root;
+    m_root.m_next = &m_root;
+    m_size = 0;
+}
+
+/**
+ * @brief
+ * Prints the list to a string
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @return std::string String representation of the list
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, class Tag>
+std::string IntrusiveList<T, Tag>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+template <class T, class Tag>
+typename IntrusiveList<T, Tag>::hook_t *IntrusiveList<T, Tag>::hook(T &object)
+{
+    return static_cast<hook_t *>(&object);
+}
+
+template <class T, class Tag>
+T *IntrusiveList<T, Tag>::owner(hook_t *node)
+{
+    return static_cast<T *>(node);
+}
+
+/**
+ * @brief
+ * Link an unlinked hook before position
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param node Hook to be linked
+ * @param position Hook that will follow it, the root for the back
+ * @throw std::logic_error If node is already linked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::link_before(hook_t *node, hook_t *position)
+{
+    if (node->is_linked())
+        throw std::logic_error("Object is already linked");
+
+    node->m_prev = position->m_prev;
+    node->m_next = position;
+    position->m_prev->m_next = node;
+    position->m_prev = node;
+    ++m_size;
+}
+
+/**
+ * @brief
+ * Detach a hook from its neighbours and mark it unlinked
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param node Hook to be unlinked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveList<T, Tag>::unlink(hook_t *node)
+{
+    node->m_prev->m_next = node->m_next;
+    node->m_next->m_prev = node->m_prev;
+    node->m_prev = nullptr;
+    node->m_next = nullptr;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file IntrusiveList.h
+ * @author Carlos Salguero
+ * @brief Declaration of the IntrusiveList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef INTRUSIVE_LIST_H
+#define INTRUSIVE_LIST_H
+
+#include <cstddef>     // std::size_t
+#include <iterator>    // std::bidirectional_iterator_tag
+#include <sstream>     // std::stringstream for to_string() function
+#include <stdexcept>   // std::runtime_error, std::logic_error
+#include <string>
+#include <type_traits> // std::conditional_t
+
+// Custom Headers
+#include "IntrusiveListHook.h"
+
+/**
+ * @brief
+ * Doubly linked list of objects that carry their own links. The list never
+ * allocates or copies: it links the IntrusiveListHook<Tag> base of the
+ * objects it is given, so an object can be in as many lists as it has
+ * hooks, and can be removed in O(1) from a reference to it. The list does
+ * not own the objects, which must outlive their membership.
+ * @tparam T Type of the objects, derived from IntrusiveListHook<Tag>
+ * @tparam Tag Selects which hook of T this list uses
+ */
+template <class T, class Tag = DefaultListTag>
+class IntrusiveList
+{
+    using hook_t = IntrusiveListHook<Tag>;
+
+    template <bool Const>
+    class basic_iterator
+    {
+    public:
+        using iterator_category = std::bidirectional_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        basic_iterator() = default;
+        explicit basic_iterator(hook_t *hook) : m_hook{hook} {}
+
+        reference operator*() const { return *owner(m_hook); }
+        pointer operator->() const { return owner(m_hook); }
+
+        basic_iterator &operator++()
+        {
+            m_hook = m_hook->m_next;
+            return *this;
+        }
+
+        basic_iterator &operator--()
+        {
+            m_hook = m_hook->m_prev;
+            return *this;
+        }
+
+        basic_iterator operator++(int)
+        {
+            auto copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        basic_iterator operator--(int)
+        {
+            auto copy{*this};
+            --*this;
+            return copy;
+        }
+
+        bool operator==(const basic_iterator &) const = default;
+
+    private:
+        hook_t *m_hook{};
+    };
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // Constructor
+    IntrusiveList();
+    IntrusiveList(const IntrusiveList &) = delete;
+    IntrusiveList(IntrusiveList &&) noexcept;
+
+    // Destructor
+    ~IntrusiveList();
+
+    // Operator Overloads
+    IntrusiveList &operator=(const IntrusiveList &) = delete;
+
+    template <class ostream_t, class tag_t>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const IntrusiveList<ostream_t, tag_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+
+    T &front();
+    T &back();
+
+    // Iterators
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Functions
+    bool is_empty() const;
+
+    void push_front(T &);
+    void push_back(T &);
+    void insert_before(T &, T &);
+
+    void pop_front();
+    void pop_back();
+    void remove(T &);
+
+    void move_to_front(T &);
+    void move_to_back(T &);
+    void clear();
+
+    std::string to_string() const;
+
+private:
+    hook_t m_root;
+    std::size_t m_size{};
+
+    static hook_t *hook(T &);
+    static T *owner(hook_t *);
+
+    void link_before(hook_t *, hook_t *);
+    static void unlink(hook_t *);
+};
+
+#endif //! INTRUSIVE_LIST_H
@@ -0,0 +1,89 @@
+/**
+ * @file IntrusiveListHook.h
+ * @author Carlos Salguero
+ * @brief Link hooks embedded in the objects of the intrusive lists
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef INTRUSIVE_LIST_HOOK_H
+#define INTRUSIVE_LIST_HOOK_H
+
+/**
+ * @brief
+ * Tag of the default hook. Objects that live in several lists at once
+ * derive from one hook per list, each with its own tag type.
+ */
+struct DefaultListTag
+{
+};
+
+/**
+ * @brief
+ * Links of an object in an IntrusiveList. Copying an object does not copy
+ * its membership: the copy starts unlinked.
+ * @tparam Tag Identifies the list this hook belongs to
+ */
+template <class Tag = DefaultListTag>
+class IntrusiveListHook
+{
+public:
+    IntrusiveListHook() = default;
+    IntrusiveListHook(const IntrusiveListHook &) {}
+    IntrusiveListHook &operator=(const IntrusiveListHook &) { return *this; }
+    ~IntrusiveListHook() = default;
+
+    /**
+     * @brief
+     * Checks if the object is currently in a list
+     * @return true If the hook is linked
+     * @return false If the hook is not linked
+     * @time complexity O(1)
+     * @space complexity O(1)
+     */
+    bool is_linked() const { return m_next != nullptr; }
+
+private:
+    template <class, class>
+    friend class IntrusiveList;
+
+    IntrusiveListHook *m_prev{};
+    IntrusiveListHook *m_next{};
+};
+
+/**
+ * @brief
+ * Link of an object in an IntrusiveSinglyList. Copying an object does not
+ * copy its membership: the copy starts unlinked.
+ * @tparam Tag Identifies the list this hook belongs to
+ */
+template <class Tag = DefaultListTag>
+class IntrusiveSinglyListHook
+{
+public:
+    IntrusiveSinglyListHook() = default;
+    IntrusiveSinglyListHook(const IntrusiveSinglyListHook &) {}
+    IntrusiveSinglyListHook &operator=(const IntrusiveSinglyListHook &) { return *this; }
+    ~IntrusiveSinglyListHook() = default;
+
+    /**
+     * @brief
+     * Checks if the object is currently in a list
+     * @return true If the hook is linked
+     * @return false If the hook is not linked
+     * @time complexity O(1)
+     * @space complexity O(1)
+     */
+    bool is_linked() const { return m_next != nullptr; }
+
+private:
+    template <class, class>
+    friend class IntrusiveSinglyList;
+
+    IntrusiveSinglyListHook *m_next{};
+};
+
+#endif //! INTRUSIVE_LIST_HOOK_H
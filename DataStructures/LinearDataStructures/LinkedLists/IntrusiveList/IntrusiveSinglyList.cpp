@@ -0,0 +1,407 @@
+/**
+ * @file IntrusiveSinglyList.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the IntrusiveSinglyList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <utility> // std::exchange()
+
+#include "IntrusiveSinglyList.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new IntrusiveSinglyList< T, Tag>:: IntrusiveSinglyList object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ */
+template <class T, class Tag>
+IntrusiveSinglyList<T, Tag>::IntrusiveSinglyList() : m_tail{&m_root}
+{
+    m_root.m_next = &m_root;
+}
+
+/**
+ * @brief
+ * Construct a new IntrusiveSinglyList< T, Tag>:: IntrusiveSinglyList object
+ * taking the objects of other, which is left empty
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param other List to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+IntrusiveSinglyList<T, Tag>::IntrusiveSinglyList(IntrusiveSinglyList &&other) noexcept
+    : IntrusiveSinglyList()
+{
+    if (other.is_empty())
+        return;
+
+    m_root.m_next = other.m_root.m_next;
+    m_tail = other.m_tail;
+    m_tail->m_next = &m_root;
+    m_size = std::exchange(other.m_size, 0);
+
+    other.m_root.m_next = &other.m_root;
+    other.m_tail = &other.m_root;
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the IntrusiveSinglyList< T, Tag>:: IntrusiveSinglyList object.
+ * The objects are unlinked, not destroyed.
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+IntrusiveSinglyList<T, Tag>::~IntrusiveSinglyList()
+{
+    clear();
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator
+ * @tparam ostream_t Type of the objects
+ * @tparam tag_t Selects which hook of the objects the list uses
+ * @param os Output stream
+ * @param list List to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class tag_t>
+std::ostream &operator<<(std::ostream &os,
+                         const IntrusiveSinglyList<ostream_t, tag_t> &list)
+{
+    for (const auto &object : list)
+        os << object << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of objects in the list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @return std::size_t Size of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+std::size_t IntrusiveSinglyList<T, Tag>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the first object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @return T& First object
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+T &IntrusiveSinglyList<T, Tag>::front()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    return *owner(m_root.m_next);
+}
+
+/**
+ * @brief
+ * Get the last object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @return T& Last object
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+T &IntrusiveSinglyList<T, Tag>::back()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    return *owner(m_tail);
+}
+
+// Iterators
+template <class T, class Tag>
+typename IntrusiveSinglyList<T, Tag>::iterator IntrusiveSinglyList<T, Tag>::begin()
+{
+    return iterator{m_root.m_next};
+}
+
+template <class T, class Tag>
+typename IntrusiveSinglyList<T, Tag>::iterator IntrusiveSinglyList<T, Tag>::end()
+{
+    return iterator{&m_root};
+}
+
+template <class T, class Tag>
+typename IntrusiveSinglyList<T, Tag>::const_iterator
+IntrusiveSinglyList<T, Tag>::begin() const
+{
+    return const_iterator{m_root.m_next};
+}
+
+template <class T, class Tag>
+typename IntrusiveSinglyList<T, Tag>::const_iterator
+IntrusiveSinglyList<T, Tag>::end() const
+{
+    return const_iterator{const_cast<hook_t *>(&m_root)};
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the list is empty
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @return true If the list is empty
+ * @return false If the list is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+bool IntrusiveSinglyList<T, Tag>::is_empty() const
+{
+    return m_root.m_next == &m_root;
+}
+
+/**
+ * @brief
+ * Link an object at the front of the list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object to be linked
+ * @throw std::logic_error If the object is already in a list with this tag
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::push_front(T &object)
+{
+    link_after(&m_root, hook(object));
+}
+
+/**
+ * @brief
+ * Link an object at the back of the list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object to be linked
+ * @throw std::logic_error If the object is already in a list with this tag
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::push_back(T &object)
+{
+    link_after(m_tail, hook(object));
+}
+
+/**
+ * @brief
+ * Link an object right after another object of this list
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param position Object of this list that will precede the new one
+ * @param object Object to be linked
+ * @throw std::logic_error If object is already linked or position is not
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::insert_after(T &position, T &object)
+{
+    if (!hook(position)->is_linked())
+        throw std::logic_error("Position is not linked");
+
+    link_after(hook(position), hook(object));
+}
+
+/**
+ * @brief
+ * Unlink the first object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @throw std::runtime_error If the list is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::pop_front()
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    unlink_after(&m_root);
+}
+
+/**
+ * @brief
+ * Unlink the object that follows the given one
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param position Object of this list
+ * @throw std::logic_error If position is not linked or is the last object
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::erase_after(T &position)
+{
+    auto *node{hook(position)};
+
+    if (!node->is_linked() || node->m_next == &m_root)
+        throw std::logic_error("No object after position");
+
+    unlink_after(node);
+}
+
+/**
+ * @brief
+ * Unlink an object of this list, searching for its predecessor
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param object Object to be unlinked
+ * @throw std::logic_error If the object is not in this list
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::remove(T &object)
+{
+    auto *node{hook(object)};
+
+    if (node->is_linked())
+        for (auto *current{&m_root}; current->m_next != &m_root; current = current->m_next)
+            if (current->m_next == node)
+            {
+                unlink_after(current);
+                return;
+            }
+
+    throw std::logic_error("Object is not in the list");
+}
+
+/**
+ * @brief
+ * Unlink every object
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::clear()
+{
+    auto *current{m_root.m_next};
+
+    while (current != &m_root)
+        current = std::exchange(current->m_next, nullptr);
+
+    m_root.m_next = &m_root;
+    m_tail = &m_root;
+    m_size = 0;
+}
+
+/**
+ * @brief
+ * Prints the list to a string
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @return std::string String representation of the list
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, class Tag>
+std::string IntrusiveSinglyList<T, Tag>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+template <class T, class Tag>
+typename IntrusiveSinglyList<T, Tag>::hook_t *IntrusiveSinglyList<T, Tag>::hook(T &object)
+{
+    return static_cast<hook_t *>(&object);
+}
+
+template <class T, class Tag>
+T *IntrusiveSinglyList<T, Tag>::owner(hook_t *node)
+{
+    return static_cast<T *>(node);
+}
+
+/**
+ * @brief
+ * Link an unlinked hook after position
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param position Hook that will precede it, the root for the front
+ * @param node Hook to be linked
+ * @throw std::logic_error If node is already linked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::link_after(hook_t *position, hook_t *node)
+{
+    if (node->is_linked())
+        throw std::logic_error("Object is already linked");
+
+    node->m_next = position->m_next;
+    position->m_next = node;
+
+    if (position == m_tail)
+        m_tail = node;
+
+    ++m_size;
+}
+
+/**
+ * @brief
+ * Unlink the hook that follows position and mark it unlinked
+ * @tparam T Type of the objects
+ * @tparam Tag Selects which hook of T this list uses
+ * @param position Hook preceding the one to be unlinked
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Tag>
+void IntrusiveSinglyList<T, Tag>::unlink_after(hook_t *position)
+{
+    auto *node{position->m_next};
+
+    position->m_next = node->m_next;
+    node->m_next = nullptr;
+
+    if (node == m_tail)
+        m_tail = position;
+
+    --m_size;
+}
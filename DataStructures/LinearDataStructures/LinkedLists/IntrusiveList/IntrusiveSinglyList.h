@@ -0,0 +1,131 @@
+/**
+ * @file IntrusiveSinglyList.h
+ * @author Carlos Salguero
+ * @brief Declaration of the IntrusiveSinglyList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef INTRUSIVE_SINGLY_LIST_H
+#define INTRUSIVE_SINGLY_LIST_H
+
+#include <cstddef>     // std::size_t
+#include <iterator>    // std::forward_iterator_tag
+#include <sstream>     // std::stringstream for to_string() function
+#include <stdexcept>   // std::runtime_error, std::logic_error
+#include <string>
+#include <type_traits> // std::conditional_t
+
+// Custom Headers
+#include "IntrusiveListHook.h"
+
+/**
+ * @brief
+ * Singly linked list of objects that carry their own link, in the
+ * IntrusiveSinglyListHook<Tag> base. Insertion never allocates. Unlinking
+ * is O(1) at the front and after a known object, O(n) for an arbitrary one.
+ * The list does not own the objects.
+ * @tparam T Type of the objects, derived from IntrusiveSinglyListHook<Tag>
+ * @tparam Tag Selects which hook of T this list uses
+ */
+template <class T, class Tag = DefaultListTag>
+class IntrusiveSinglyList
+{
+    using hook_t = IntrusiveSinglyListHook<Tag>;
+
+    template <bool Const>
+    class basic_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = std::conditional_t<Const, const T *, T *>;
+        using reference = std::conditional_t<Const, const T &, T &>;
+
+        basic_iterator() = default;
+        explicit basic_iterator(hook_t *hook) : m_hook{hook} {}
+
+        reference operator*() const { return *owner(m_hook); }
+        pointer operator->() const { return owner(m_hook); }
+
+        basic_iterator &operator++()
+        {
+            m_hook = m_hook->m_next;
+            return *this;
+        }
+
+        basic_iterator operator++(int)
+        {
+            auto copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const basic_iterator &) const = default;
+
+    private:
+        hook_t *m_hook{};
+    };
+
+public:
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    // Constructor
+    IntrusiveSinglyList();
+    IntrusiveSinglyList(const IntrusiveSinglyList &) = delete;
+    IntrusiveSinglyList(IntrusiveSinglyList &&) noexcept;
+
+    // Destructor
+    ~IntrusiveSinglyList();
+
+    // Operator Overloads
+    IntrusiveSinglyList &operator=(const IntrusiveSinglyList &) = delete;
+
+    template <class ostream_t, class tag_t>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const IntrusiveSinglyList<ostream_t, tag_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+
+    T &front();
+    T &back();
+
+    // Iterators
+    iterator begin();
+    iterator end();
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Functions
+    bool is_empty() const;
+
+    void push_front(T &);
+    void push_back(T &);
+    void insert_after(T &, T &);
+
+    void pop_front();
+    void erase_after(T &);
+    void remove(T &);
+    void clear();
+
+    std::string to_string() const;
+
+private:
+    hook_t m_root;
+    hook_t *m_tail;
+    std::size_t m_size{};
+
+    static hook_t *hook(T &);
+    static T *owner(hook_t *);
+
+    void link_after(hook_t *, hook_t *);
+    void unlink_after(hook_t *);
+};
+
+#endif //! INTRUSIVE_SINGLY_LIST_H
@@ -0,0 +1,421 @@
+/**
+ * @file PersistentList.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the PersistentList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PERSISTENT_LIST_CPP
+#define PERSISTENT_LIST_CPP
+
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::exchange(), std::forward(), std::move(), std::swap()
+
+#include "PersistentList.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new PersistentList< T, ThreadSafe>:: PersistentList object
+ * holding the values in the given order
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param values Values of the list, front first
+ * @throw Whatever copying a value or allocating a node throws, after the
+ * nodes built so far are freed
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe>::PersistentList(std::initializer_list<T> values)
+{
+    // Built back to front, each new node takes over the reference to the
+    // previous head. The destructor does not run if a node fails, so the
+    // ones built so far are released here.
+    try
+    {
+        for (auto it{values.end()}; it != values.begin();)
+        {
+            m_head = new node_t{m_head, *--it};
+            ++m_size;
+        }
+    }
+    catch (...)
+    {
+        node_t::release(m_head);
+        throw;
+    }
+}
+
+/**
+ * @brief
+ * Construct a new PersistentList< T, ThreadSafe>:: PersistentList object
+ * sharing every node of other
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param other List to be copied
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe>::PersistentList(const PersistentList &other)
+    : m_head{node_t::acquire(other.m_head)}, m_size{other.m_size}
+{
+}
+
+/**
+ * @brief
+ * Construct a new PersistentList< T, ThreadSafe>:: PersistentList object
+ * taking the reference of other, which is left empty
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param other List to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe>::PersistentList(PersistentList &&other) noexcept
+    : m_head{std::exchange(other.m_head, nullptr)},
+      m_size{std::exchange(other.m_size, 0)}
+{
+}
+
+/**
+ * @brief
+ * Construct a new PersistentList< T, ThreadSafe>:: PersistentList object
+ * adopting a reference to a node
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param head First node, whose reference now belongs to the list
+ * @param size Number of nodes reachable from head
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe>::PersistentList(node_t *head, std::size_t size)
+    : m_head{head}, m_size{size}
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the PersistentList< T, ThreadSafe>:: PersistentList object. Only
+ * the nodes no other version reaches are freed.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @time complexity O(k), k nodes freed
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe>::~PersistentList()
+{
+    node_t::release(m_head);
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Copy and move assignment
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param other List to be assigned
+ * @return PersistentList& Reference to this list
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe> &PersistentList<T, ThreadSafe>::operator=(PersistentList other)
+{
+    std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+
+    return *this;
+}
+
+/**
+ * @brief
+ * Compare two lists value by value. Stops as soon as both reach a shared
+ * node, since the rest is the same.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param other List to be compared
+ * @return true If both lists hold the same values in the same order
+ * @return false Otherwise
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+bool PersistentList<T, ThreadSafe>::operator==(const PersistentList &other) const
+{
+    if (m_size != other.m_size)
+        return false;
+
+    for (auto *lhs{m_head}, *rhs{other.m_head}; lhs != rhs; lhs = lhs->next, rhs = rhs->next)
+        if (!(lhs->value == rhs->value))
+            return false;
+
+    return true;
+}
+
+/**
+ * @brief
+ * Overload the << operator, front first
+ * @tparam ostream_t Type of the data
+ * @tparam thread_safe Whether versions may be shared between threads
+ * @param os Output stream
+ * @param list List to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, bool thread_safe>
+std::ostream &operator<<(std::ostream &os, const PersistentList<ostream_t, thread_safe> &list)
+{
+    for (auto const &value : list)
+        os << value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return std::size_t Size of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+std::size_t PersistentList<T, ThreadSafe>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the first element
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @throw std::runtime_error If the list is empty
+ * @return const T& First element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+const T &PersistentList<T, ThreadSafe>::front() const
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    return m_head->value;
+}
+
+// Iterators
+/**
+ * @brief
+ * Get an iterator to the first element. It stays valid for as long as
+ * this version, or any version sharing the node, is alive.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return const_iterator Iterator to the first element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+typename PersistentList<T, ThreadSafe>::const_iterator PersistentList<T, ThreadSafe>::begin() const
+{
+    return const_iterator{m_head};
+}
+
+template <class T, bool ThreadSafe>
+typename PersistentList<T, ThreadSafe>::const_iterator PersistentList<T, ThreadSafe>::end() const
+{
+    return const_iterator{};
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the list is empty
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return true If the list is empty
+ * @return false If the list is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+bool PersistentList<T, ThreadSafe>::is_empty() const
+{
+    return m_head == nullptr;
+}
+
+/**
+ * @brief
+ * Checks if the list contains a value
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param value Value to be searched
+ * @return true If the value is in the list
+ * @return false If the value is not in the list
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+bool PersistentList<T, ThreadSafe>::contains(const T &value) const
+{
+    for (auto const &element : *this)
+        if (element == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief
+ * Checks if two versions share their last node, that is, if one was
+ * derived from the other or both from a common version
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param other Version to be checked
+ * @return true If the lists share nodes
+ * @return false If they share none
+ * @time complexity O(n + m)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+bool PersistentList<T, ThreadSafe>::shares_nodes_with(const PersistentList &other) const
+{
+    auto const last{[](const node_t *node)
+                    {
+                        while (node != nullptr && node->next != nullptr)
+                            node = node->next;
+
+                        return node;
+                    }};
+
+    return m_head != nullptr && last(m_head) == last(other.m_head);
+}
+
+/**
+ * @brief
+ * Get a new version with a value in front of this one
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param value Value to be copied
+ * @return PersistentList New version, sharing every node of this one
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe> PersistentList<T, ThreadSafe>::push_front(const T &value) const
+{
+    return emplace_front(value);
+}
+
+/**
+ * @brief
+ * Get a new version with a value in front of this one
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param value Value to be moved
+ * @return PersistentList New version, sharing every node of this one
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe> PersistentList<T, ThreadSafe>::push_front(T &&value) const
+{
+    return emplace_front(std::move(value));
+}
+
+/**
+ * @brief
+ * Get a new version with a value constructed in front of this one
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return PersistentList New version, sharing every node of this one
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+template <class... Args>
+PersistentList<T, ThreadSafe> PersistentList<T, ThreadSafe>::emplace_front(Args &&...args) const
+{
+    auto *const next{node_t::acquire(m_head)};
+
+    try
+    {
+        return PersistentList{new node_t{next, std::forward<Args>(args)...}, m_size + 1};
+    }
+    catch (...)
+    {
+        node_t::release(next);
+        throw;
+    }
+}
+
+/**
+ * @brief
+ * Get the version without the first element
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @throw std::runtime_error If the list is empty
+ * @return PersistentList Rest of this version, sharing its nodes
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe> PersistentList<T, ThreadSafe>::pop_front() const
+{
+    if (is_empty())
+        throw std::runtime_error("List is empty");
+
+    return PersistentList{node_t::acquire(m_head->next), m_size - 1};
+}
+
+/**
+ * @brief
+ * Get a version with the elements in reverse order. Nothing can be shared,
+ * so every node is copied.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return PersistentList Reversed version
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, bool ThreadSafe>
+PersistentList<T, ThreadSafe> PersistentList<T, ThreadSafe>::reverse() const
+{
+    PersistentList reversed;
+
+    for (auto const &value : *this)
+        reversed = reversed.push_front(value);
+
+    return reversed;
+}
+
+/**
+ * @brief
+ * Prints the list to a string, front first
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return std::string String representation of the list
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, bool ThreadSafe>
+std::string PersistentList<T, ThreadSafe>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+#endif //! PERSISTENT_LIST_CPP
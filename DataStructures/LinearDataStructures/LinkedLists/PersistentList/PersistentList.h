@@ -0,0 +1,127 @@
+/**
+ * @file PersistentList.h
+ * @author Carlos Salguero
+ * @brief Declaration of the PersistentList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PERSISTENT_LIST_H
+#define PERSISTENT_LIST_H
+
+#include <cstddef>  // std::size_t, std::ptrdiff_t
+#include <initializer_list>
+#include <iterator> // std::forward_iterator_tag
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+// Custom Headers
+#include "PersistentListNode.h"
+
+/**
+ * @brief
+ * Immutable singly linked list. Operations never modify a list: push_front
+ * and pop_front return a new version in O(1) that shares the rest of its
+ * nodes with the old one, and copying a list only copies a pointer. Every
+ * version stays valid and unchanged for as long as it is kept, which gives
+ * snapshots and undo for free. Nodes are freed when the last version that
+ * reaches them is gone.
+ *
+ * With ThreadSafe the reference counts are atomic and versions may be
+ * shared between threads; without it they are plain counters, which is
+ * faster when a list never leaves its thread.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ */
+template <class T, bool ThreadSafe = true>
+class PersistentList
+{
+    using node_t = PersistentListNode<T, ThreadSafe>;
+
+public:
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+        explicit const_iterator(const node_t *node) : m_node{node} {}
+
+        reference operator*() const { return m_node->value; }
+        pointer operator->() const { return &m_node->value; }
+
+        const_iterator &operator++()
+        {
+            m_node = m_node->next;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto copy{*this};
+            m_node = m_node->next;
+            return copy;
+        }
+
+        bool operator==(const const_iterator &) const = default;
+
+    private:
+        const node_t *m_node{};
+    };
+
+    // Constructor
+    PersistentList() = default;
+    PersistentList(std::initializer_list<T>);
+    PersistentList(const PersistentList &);
+    PersistentList(PersistentList &&) noexcept;
+
+    // Destructor
+    ~PersistentList();
+
+    // Operator overloads
+    PersistentList &operator=(PersistentList);
+    bool operator==(const PersistentList &) const;
+
+    template <class ostream_t, bool thread_safe>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const PersistentList<ostream_t, thread_safe> &);
+
+    // Getters
+    std::size_t get_size() const;
+    const T &front() const;
+
+    // Iterators
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+    bool shares_nodes_with(const PersistentList &) const;
+
+    [[nodiscard]] PersistentList push_front(const T &) const;
+    [[nodiscard]] PersistentList push_front(T &&) const;
+
+    template <class... Args>
+    [[nodiscard]] PersistentList emplace_front(Args &&...) const;
+
+    [[nodiscard]] PersistentList pop_front() const;
+    [[nodiscard]] PersistentList reverse() const;
+
+    std::string to_string() const;
+
+private:
+    node_t *m_head{};
+    std::size_t m_size{};
+
+    PersistentList(node_t *, std::size_t);
+};
+
+#endif //! PERSISTENT_LIST_H
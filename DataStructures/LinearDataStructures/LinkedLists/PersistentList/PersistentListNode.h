@@ -0,0 +1,84 @@
+/**
+ * @file PersistentListNode.h
+ * @author Carlos Salguero
+ * @brief Node declaration for the PersistentList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PERSISTENT_LIST_NODE_H
+#define PERSISTENT_LIST_NODE_H
+
+#include <atomic>
+#include <cstddef>     // std::size_t
+#include <type_traits> // std::conditional_t
+#include <utility>     // std::exchange(), std::forward()
+
+/**
+ * @brief
+ * Immutable node shared by every version of a PersistentList that reaches
+ * it. It carries its own reference count, which is atomic unless the list
+ * is only used from one thread; the count is the number of versions and
+ * nodes pointing at it.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ */
+template <class T, bool ThreadSafe>
+struct PersistentListNode
+{
+    template <class... Args>
+    explicit PersistentListNode(PersistentListNode *next, Args &&...args)
+        : value(std::forward<Args>(args)...), next{next}
+    {
+    }
+
+    /**
+     * @brief
+     * Add a reference to a node
+     * @param node Node, may be nullptr
+     * @return PersistentListNode* The same node
+     */
+    static PersistentListNode *acquire(PersistentListNode *node)
+    {
+        if (node != nullptr)
+        {
+            if constexpr (ThreadSafe)
+                node->count.fetch_add(1, std::memory_order_relaxed);
+            else
+                ++node->count;
+        }
+
+        return node;
+    }
+
+    /**
+     * @brief
+     * Drop a reference to a node, and free every node that is left without
+     * references along the chain. It loops instead of recursing, so long
+     * lists do not exhaust the stack.
+     * @param node Node, may be nullptr
+     */
+    static void release(PersistentListNode *node)
+    {
+        while (node != nullptr && drop(node))
+            delete std::exchange(node, node->next);
+    }
+
+    T value;
+    PersistentListNode *const next;
+    std::conditional_t<ThreadSafe, std::atomic<std::size_t>, std::size_t> count{1};
+
+private:
+    static bool drop(PersistentListNode *node)
+    {
+        if constexpr (ThreadSafe)
+            return node->count.fetch_sub(1, std::memory_order_acq_rel) == 1;
+        else
+            return --node->count == 0;
+    }
+};
+
+#endif //! PERSISTENT_LIST_NODE_H
@@ -0,0 +1,175 @@
+/**
+ * @file NodePool.h
+ * @author Carlos Salguero
+ * @brief Tower-height-aware node allocator for the SkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef NODE_POOL_H
+#define NODE_POOL_H
+
+#include <algorithm> // std::max()
+#include <array>
+#include <cstddef> // std::size_t, std::byte
+#include <new>     // ::operator new(), std::align_val_t
+#include <utility> // std::exchange()
+#include <vector>
+
+/**
+ * @brief
+ * Pool of raw node blocks. Memory is carved out of large chunks and every
+ * tower height has its own free list, so a released node of height h is
+ * reused by the next node of height h without going back to the system
+ * allocator.
+ * @tparam Node Node type, must provide Node::block_size(height)
+ * @tparam MaxHeight Maximum tower height
+ */
+template <class Node, std::size_t MaxHeight>
+class NodePool
+{
+public:
+    // Constructor
+    explicit NodePool(std::size_t chunk_size = 64 * 1024)
+        : m_chunk_size{std::max(chunk_size, stride(MaxHeight))}
+    {
+    }
+
+    NodePool(const NodePool &) = delete;
+    NodePool &operator=(const NodePool &) = delete;
+
+    NodePool(NodePool &&other) noexcept
+        : m_chunks{std::move(other.m_chunks)},
+          m_free_lists{std::exchange(other.m_free_lists, {})},
+          m_cursor{std::exchange(other.m_cursor, nullptr)},
+          m_remaining{std::exchange(other.m_remaining, 0)},
+          m_chunk_size{other.m_chunk_size}
+    {
+    }
+
+    NodePool &operator=(NodePool &&other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            m_chunks = std::move(other.m_chunks);
+            m_free_lists = std::exchange(other.m_free_lists, {});
+            m_cursor = std::exchange(other.m_cursor, nullptr);
+            m_remaining = std::exchange(other.m_remaining, 0);
+            m_chunk_size = other.m_chunk_size;
+        }
+
+        return *this;
+    }
+
+    // Destructor
+    ~NodePool() { release(); }
+
+    /**
+     * @brief
+     * Get a block big enough for a node of the given height
+     * @param height Tower height of the node
+     * @return void* Uninitialized, suitably aligned memory
+     * @time complexity O(1) amortized
+     * @space complexity O(1)
+     */
+    void *allocate(std::size_t height)
+    {
+        if (auto *block = m_free_lists[height]; block != nullptr)
+        {
+            m_free_lists[height] = block->next;
+            return block;
+        }
+
+        auto const bytes{stride(height)};
+
+        if (m_remaining < bytes)
+        {
+            m_cursor = static_cast<std::byte *>(
+                ::operator new(m_chunk_size, std::align_val_t{alignment()}));
+            m_chunks.push_back(m_cursor);
+            m_remaining = m_chunk_size;
+        }
+
+        auto *block{m_cursor};
+        m_cursor += bytes;
+        m_remaining -= bytes;
+
+        return block;
+    }
+
+    /**
+     * @brief
+     * Return a block to the free list of its height
+     * @param pointer Block previously returned by allocate(height)
+     * @param height Tower height used to allocate the block
+     * @time complexity O(1)
+     * @space complexity O(1)
+     */
+    void deallocate(void *pointer, std::size_t height)
+    {
+        auto *block = static_cast<FreeBlock *>(pointer);
+
+        block->next = m_free_lists[height];
+        m_free_lists[height] = block;
+    }
+
+    /**
+     * @brief
+     * Total number of bytes reserved from the system allocator
+     * @return std::size_t Reserved bytes
+     * @time complexity O(1)
+     * @space complexity O(1)
+     */
+    std::size_t reserved_bytes() const
+    {
+        return m_chunks.size() * m_chunk_size;
+    }
+
+    /**
+     * @brief
+     * Bytes taken by one block of the given height, including padding
+     * @param height Tower height
+     * @return std::size_t Block stride in bytes
+     */
+    static constexpr std::size_t stride(std::size_t height)
+    {
+        return (std::max(Node::block_size(height), sizeof(FreeBlock)) +
+                alignment() - 1) /
+               alignment() * alignment();
+    }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock *next;
+    };
+
+    static constexpr std::size_t alignment()
+    {
+        return std::max({alignof(Node), alignof(typename Node::Link),
+                         alignof(FreeBlock)});
+    }
+
+    void release()
+    {
+        for (auto *chunk : m_chunks)
+            ::operator delete(chunk, std::align_val_t{alignment()});
+
+        m_chunks.clear();
+        m_free_lists = {};
+        m_cursor = nullptr;
+        m_remaining = 0;
+    }
+
+    std::vector<std::byte *> m_chunks;
+    std::array<FreeBlock *, MaxHeight + 1> m_free_lists{};
+    std::byte *m_cursor{};
+    std::size_t m_remaining{};
+    std::size_t m_chunk_size;
+};
+
+#endif //! NODE_POOL_H
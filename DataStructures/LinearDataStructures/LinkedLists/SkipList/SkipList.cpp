@@ -0,0 +1,789 @@
+/**
+ * @file SkipList.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the SkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <bit>         // C++20, std::countr_zero()
+#include <type_traits> // std::is_trivially_destructible_v
+
+#include "SkipList.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new SkipList< T, Compare>:: SkipList object
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param cmp Comparison object
+ * @param seed Seed of the tower height generator
+ */
+template <class T, class Compare>
+SkipList<T, Compare>::SkipList(const Compare &cmp, std::uint64_t seed)
+    : m_state{seed != 0 ? seed : 0x9E3779B97F4A7C15}, m_cmp{cmp}
+{
+}
+
+/**
+ * @brief
+ * Construct a new SkipList< T, Compare>:: SkipList object as a deep copy
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param other List to be copied
+ * @time complexity O(n log(n))
+ * @space complexity O(n)
+ */
+template <class T, class Compare>
+SkipList<T, Compare>::SkipList(const SkipList &other)
+    : m_state{other.m_state}, m_cmp{other.m_cmp}
+{
+    for (const auto &value : other)
+        insert(value);
+}
+
+/**
+ * @brief
+ * Construct a new SkipList< T, Compare>:: SkipList object taking the nodes
+ * of other, which is left empty
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param other List to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+SkipList<T, Compare>::SkipList(SkipList &&other) noexcept
+    : m_head{std::exchange(other.m_head, {})},
+      m_pool{std::move(other.m_pool)},
+      m_size{std::exchange(other.m_size, 0)},
+      m_height{std::exchange(other.m_height, 1)},
+      m_state{other.m_state},
+      m_cmp{other.m_cmp}
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the SkipList< T, Compare>:: SkipList object
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+SkipList<T, Compare>::~SkipList()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        clear();
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Copy and move assignment
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param other List to be assigned
+ * @return SkipList& Reference to this list
+ */
+template <class T, class Compare>
+SkipList<T, Compare> &SkipList<T, Compare>::operator=(SkipList other)
+{
+    std::swap(m_head, other.m_head);
+    std::swap(m_pool, other.m_pool);
+    std::swap(m_size, other.m_size);
+    std::swap(m_height, other.m_height);
+    std::swap(m_state, other.m_state);
+    std::swap(m_cmp, other.m_cmp);
+
+    return *this;
+}
+
+/**
+ * @brief
+ * Overload the << operator
+ * @tparam ostream_t Type of the data
+ * @tparam compare_t Strict weak ordering of the elements
+ * @param os Output stream
+ * @param list List to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class compare_t>
+std::ostream &operator<<(std::ostream &os,
+                         const SkipList<ostream_t, compare_t> &list)
+{
+    for (const auto &value : list)
+        os << value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements in the list
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::size_t Size of the list
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the number of levels currently in use
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::size_t Height of the tallest tower
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::get_height() const
+{
+    return m_height;
+}
+
+/**
+ * @brief
+ * Get the number of bytes reserved by the node pool
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::size_t Reserved bytes
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::reserved_bytes() const
+{
+    return m_pool.reserved_bytes();
+}
+
+/**
+ * @brief
+ * Get the element at the given index, following the link spans
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param index Index of the element
+ * @throw std::out_of_range If the index is out of range
+ * @return const T& Element at the given index
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+const T &SkipList<T, Compare>::at(std::size_t index) const
+{
+    if (index >= m_size)
+        throw std::out_of_range("Index out of range");
+
+    return node_at(index)->data;
+}
+
+/**
+ * @brief
+ * Get the smallest element of the list
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::optional<T> Smallest element, std::nullopt if empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::optional<T> SkipList<T, Compare>::get_front() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_head[0].next->data;
+}
+
+/**
+ * @brief
+ * Get the largest element of the list
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::optional<T> Largest element, std::nullopt if empty
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::optional<T> SkipList<T, Compare>::get_last() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return node_at(m_size - 1)->data;
+}
+
+// Iterators
+/**
+ * @brief
+ * Iterator to the smallest element
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return const_iterator Iterator to the first element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::const_iterator SkipList<T, Compare>::begin() const
+{
+    return const_iterator{m_head[0].next};
+}
+
+/**
+ * @brief
+ * Past-the-end iterator
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return const_iterator Iterator past the last element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::const_iterator SkipList<T, Compare>::end() const
+{
+    return const_iterator{};
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the list is empty
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return true If the list is empty
+ * @return false If the list is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool SkipList<T, Compare>::is_empty() const
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief
+ * Checks if the list contains an element equivalent to value
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be searched
+ * @return true If the value is in the list
+ * @return false If the value is not in the list
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool SkipList<T, Compare>::contains(const T &value) const
+{
+    auto it{lower_bound(value)};
+
+    return it != end() && !m_cmp(value, *it);
+}
+
+/**
+ * @brief
+ * Number of elements strictly less than value, i.e. the index
+ * lower_bound(value) points to
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be ranked
+ * @return std::size_t Rank of the value
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::rank(const T &value) const
+{
+    const node_t *current{};
+    std::size_t traversed{};
+
+    for (auto level{m_height}; level-- > 0;)
+    {
+        auto const *links{links_of(current)};
+
+        while (links[level].next != nullptr &&
+               m_cmp(links[level].next->data, value))
+        {
+            traversed += links[level].span;
+            current = links[level].next;
+            links = current->links();
+        }
+    }
+
+    return traversed;
+}
+
+/**
+ * @brief
+ * Iterator to the first element that is not less than value
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be searched
+ * @return const_iterator Iterator to the element, end() if none
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::const_iterator
+SkipList<T, Compare>::lower_bound(const T &value) const
+{
+    const node_t *current{};
+
+    for (auto level{m_height}; level-- > 0;)
+    {
+        auto const *links{links_of(current)};
+
+        while (links[level].next != nullptr &&
+               m_cmp(links[level].next->data, value))
+        {
+            current = links[level].next;
+            links = current->links();
+        }
+    }
+
+    return const_iterator{links_of(current)[0].next};
+}
+
+/**
+ * @brief
+ * Iterator to the first element that is greater than value
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be searched
+ * @return const_iterator Iterator to the element, end() if none
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::const_iterator
+SkipList<T, Compare>::upper_bound(const T &value) const
+{
+    const node_t *current{};
+
+    for (auto level{m_height}; level-- > 0;)
+    {
+        auto const *links{links_of(current)};
+
+        while (links[level].next != nullptr &&
+               !m_cmp(value, links[level].next->data))
+        {
+            current = links[level].next;
+            links = current->links();
+        }
+    }
+
+    return const_iterator{links_of(current)[0].next};
+}
+
+/**
+ * @brief
+ * Elements in the half-open value interval [low, high)
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param low Inclusive lower bound
+ * @param high Exclusive upper bound
+ * @return Range Iterable range of the elements
+ * @time complexity O(log(n)) expected, plus O(k) to iterate k elements
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::Range
+SkipList<T, Compare>::range(const T &low, const T &high) const
+{
+    if (!m_cmp(low, high))
+        return Range{end(), end()};
+
+    return Range{lower_bound(low), lower_bound(high)};
+}
+
+/**
+ * @brief
+ * Elements with index in [first, first + count), clamped to the size
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param first Index of the first element
+ * @param count Number of elements
+ * @throw std::out_of_range If first is greater than the size
+ * @return Range Iterable range of the elements
+ * @time complexity O(log(n)) expected, plus O(k) to iterate k elements
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::Range
+SkipList<T, Compare>::slice(std::size_t first, std::size_t count) const
+{
+    if (first > m_size)
+        throw std::out_of_range("Index out of range");
+
+    auto const last{count < m_size - first ? first + count : m_size};
+
+    if (first == last)
+        return Range{end(), end()};
+
+    return Range{const_iterator{node_at(first)},
+                 last == m_size ? end() : const_iterator{node_at(last)}};
+}
+
+/**
+ * @brief
+ * Insert a copy of value after any equivalent elements
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be inserted
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1) expected
+ */
+template <class T, class Compare>
+void SkipList<T, Compare>::insert(const T &value)
+{
+    auto const height{random_height()};
+    auto *block{m_pool.allocate(height)};
+
+    try
+    {
+        insert_node(new (block) node_t(height, value));
+    }
+    catch (...)
+    {
+        m_pool.deallocate(block, height);
+        throw;
+    }
+}
+
+/**
+ * @brief
+ * Insert value, moving it into the list, after any equivalent elements
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be inserted
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1) expected
+ */
+template <class T, class Compare>
+void SkipList<T, Compare>::insert(T &&value)
+{
+    auto const height{random_height()};
+    auto *block{m_pool.allocate(height)};
+
+    try
+    {
+        insert_node(new (block) node_t(height, std::move(value)));
+    }
+    catch (...)
+    {
+        m_pool.deallocate(block, height);
+        throw;
+    }
+}
+
+/**
+ * @brief
+ * Remove the first element equivalent to value
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param value Value to be removed
+ * @return true If an element was removed
+ * @return false If the value is not in the list
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool SkipList<T, Compare>::remove(const T &value)
+{
+    std::array<node_t *, MAX_HEIGHT> update;
+    node_t *current{};
+
+    for (auto level{m_height}; level-- > 0;)
+    {
+        auto *links{links_of(current)};
+
+        while (links[level].next != nullptr &&
+               m_cmp(links[level].next->data, value))
+        {
+            current = links[level].next;
+            links = current->links();
+        }
+
+        update[level] = current;
+    }
+
+    auto *target{links_of(current)[0].next};
+
+    if (target == nullptr || m_cmp(value, target->data))
+        return false;
+
+    auto const *target_links{target->links()};
+
+    for (std::size_t level{}; level < m_height; ++level)
+    {
+        auto *links{links_of(update[level])};
+
+        if (links[level].next == target)
+        {
+            links[level].span += target_links[level].span - 1;
+            links[level].next = target_links[level].next;
+        }
+        else
+            --links[level].span;
+    }
+
+    while (m_height > 1 && m_head[m_height - 1].next == nullptr)
+        --m_height;
+
+    destroy(target);
+    --m_size;
+
+    return true;
+}
+
+/**
+ * @brief
+ * Remove the smallest element of the list
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @throw std::out_of_range If the list is empty
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void SkipList<T, Compare>::pop_front()
+{
+    if (is_empty())
+        throw std::out_of_range("List is empty");
+
+    auto *front{m_head[0].next};
+    auto const *front_links{front->links()};
+
+    for (std::size_t level{}; level < m_height; ++level)
+    {
+        if (level < front->height)
+            m_head[level] = front_links[level];
+        else
+            --m_head[level].span;
+    }
+
+    while (m_height > 1 && m_head[m_height - 1].next == nullptr)
+        --m_height;
+
+    destroy(front);
+    --m_size;
+}
+
+/**
+ * @brief
+ * Remove every element, keeping the pooled memory for reuse
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void SkipList<T, Compare>::clear()
+{
+    auto *current{m_head[0].next};
+
+    while (current != nullptr)
+    {
+        auto *next{current->links()[0].next};
+
+        destroy(current);
+        current = next;
+    }
+
+    m_head = {};
+    m_size = 0;
+    m_height = 1;
+}
+
+/**
+ * @brief
+ * Prints the list to a string
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::string String representation of the list
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, class Compare>
+std::string SkipList<T, Compare>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Tower of links of a node, the head links for nullptr
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param node Node, nullptr for the head
+ * @return link_t* Links of the node
+ */
+template <class T, class Compare>
+typename SkipList<T, Compare>::link_t *SkipList<T, Compare>::links_of(node_t *node)
+{
+    return node != nullptr ? node->links() : m_head.data();
+}
+
+template <class T, class Compare>
+const typename SkipList<T, Compare>::link_t *
+SkipList<T, Compare>::links_of(const node_t *node) const
+{
+    return node != nullptr ? node->links() : m_head.data();
+}
+
+/**
+ * @brief
+ * Draw a tower height with P(height > h) = 4^-h using xorshift64*
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @return std::size_t Height in [1, MAX_HEIGHT]
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t SkipList<T, Compare>::random_height()
+{
+    m_state ^= m_state >> 12;
+    m_state ^= m_state << 25;
+    m_state ^= m_state >> 27;
+
+    auto const bits{m_state * 0x2545F4914F6CDD1DULL};
+
+    return 1 + std::countr_zero(bits | (1ULL << 62)) / 2;
+}
+
+/**
+ * @brief
+ * Node at the given index, which must be smaller than the size
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param index Index of the node
+ * @return const node_t* Node at the index
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+const typename SkipList<T, Compare>::node_t *
+SkipList<T, Compare>::node_at(std::size_t index) const
+{
+    const node_t *current{};
+    std::size_t traversed{};
+    auto const target{index + 1};
+
+    for (auto level{m_height}; level-- > 0;)
+    {
+        auto const *links{links_of(current)};
+
+        while (links[level].next != nullptr &&
+               traversed + links[level].span <= target)
+        {
+            traversed += links[level].span;
+            current = links[level].next;
+            links = current->links();
+        }
+
+        if (traversed == target)
+            break;
+    }
+
+    return current;
+}
+
+/**
+ * @brief
+ * Link a constructed node after every element not greater than it,
+ * updating the spans of the links it crosses
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param node Node to be linked
+ * @time complexity O(log(n)) expected
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void SkipList<T, Compare>::insert_node(node_t *node)
+{
+    std::array<node_t *, MAX_HEIGHT> update;
+    std::array<std::size_t, MAX_HEIGHT> ranks;
+    node_t *current{};
+    std::size_t traversed{};
+
+    for (auto level{m_height}; level-- > 0;)
+    {
+        auto *links{links_of(current)};
+
+        while (links[level].next != nullptr &&
+               !m_cmp(node->data, links[level].next->data))
+        {
+            traversed += links[level].span;
+            current = links[level].next;
+            links = current->links();
+        }
+
+        update[level] = current;
+        ranks[level] = traversed;
+    }
+
+    auto const height{node->height};
+
+    for (; m_height < height; ++m_height)
+    {
+        update[m_height] = nullptr;
+        ranks[m_height] = 0;
+        m_head[m_height] = link_t{nullptr, m_size};
+    }
+
+    auto *node_links{node->links()};
+
+    for (std::size_t level{}; level < height; ++level)
+    {
+        auto *links{links_of(update[level])};
+        auto const skipped{ranks[0] - ranks[level]};
+
+        node_links[level].next = links[level].next;
+        node_links[level].span = links[level].span - skipped;
+        links[level].next = node;
+        links[level].span = skipped + 1;
+    }
+
+    for (auto level{height}; level < m_height; ++level)
+        ++links_of(update[level])[level].span;
+
+    ++m_size;
+}
+
+/**
+ * @brief
+ * Destroy a node and give its block back to the pool
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ * @param node Node to be destroyed
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void SkipList<T, Compare>::destroy(node_t *node)
+{
+    auto const height{node->height};
+
+    node->~node_t();
+    m_pool.deallocate(node, height);
+}
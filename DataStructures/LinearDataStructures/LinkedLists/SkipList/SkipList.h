@@ -0,0 +1,154 @@
+/**
+ * @file SkipList.h
+ * @author Carlos Salguero
+ * @brief Declaration of the SkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SKIP_LIST_H
+#define SKIP_LIST_H
+
+#include <array>
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::less<>
+#include <iterator>   // std::forward_iterator_tag
+#include <optional>   // C++17, std::optional encapsulation
+#include <sstream>    // std::stringstream for to_string()
+#include <stdexcept>  // std::out_of_range
+#include <string>
+
+// Custom Headers
+#include "SkipListNode.h"
+#include "NodePool.h"
+
+/**
+ * @brief
+ * Sorted container with O(log n) expected search, insertion, removal and
+ * indexed access. Equal elements are kept in insertion order.
+ * @tparam T Type of the data
+ * @tparam Compare Strict weak ordering of the elements
+ */
+template <class T, class Compare = std::less<T>>
+class SkipList
+{
+    using node_t = SkipListNode<T>;
+    using link_t = typename node_t::Link;
+
+public:
+    static constexpr std::size_t MAX_HEIGHT = 32;
+
+    class const_iterator
+    {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = T;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const T *;
+        using reference = const T &;
+
+        const_iterator() = default;
+        explicit const_iterator(const node_t *node) : m_node{node} {}
+
+        reference operator*() const { return m_node->data; }
+        pointer operator->() const { return &m_node->data; }
+
+        const_iterator &operator++()
+        {
+            m_node = m_node->links()[0].next;
+            return *this;
+        }
+
+        const_iterator operator++(int)
+        {
+            auto copy{*this};
+            ++*this;
+            return copy;
+        }
+
+        bool operator==(const const_iterator &) const = default;
+
+    private:
+        const node_t *m_node{};
+    };
+
+    /**
+     * @brief
+     * Half-open sub-range of the list, usable in a range-based for loop
+     */
+    struct Range
+    {
+        const_iterator first;
+        const_iterator last;
+
+        const_iterator begin() const { return first; }
+        const_iterator end() const { return last; }
+    };
+
+    // Constructor
+    SkipList(const Compare &cmp = Compare{}, std::uint64_t seed = 0x9E3779B97F4A7C15);
+    SkipList(const SkipList &);
+    SkipList(SkipList &&) noexcept;
+
+    // Destructor
+    ~SkipList();
+
+    // Operator Overload
+    SkipList &operator=(SkipList);
+
+    template <class ostream_t, class compare_t>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const SkipList<ostream_t, compare_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t get_height() const;
+    std::size_t reserved_bytes() const;
+
+    const T &at(std::size_t) const;
+    std::optional<T> get_front() const;
+    std::optional<T> get_last() const;
+
+    // Iterators
+    const_iterator begin() const;
+    const_iterator end() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    std::size_t rank(const T &) const;
+    const_iterator lower_bound(const T &) const;
+    const_iterator upper_bound(const T &) const;
+    Range range(const T &, const T &) const;
+    Range slice(std::size_t, std::size_t) const;
+
+    void insert(const T &);
+    void insert(T &&);
+    bool remove(const T &);
+    void pop_front();
+    void clear();
+
+    std::string to_string() const;
+
+private:
+    std::array<link_t, MAX_HEIGHT> m_head{};
+    NodePool<node_t, MAX_HEIGHT> m_pool;
+    std::size_t m_size{};
+    std::size_t m_height{1};
+    std::uint64_t m_state;
+    Compare m_cmp;
+
+    link_t *links_of(node_t *);
+    const link_t *links_of(const node_t *) const;
+
+    std::size_t random_height();
+    const node_t *node_at(std::size_t) const;
+    void insert_node(node_t *);
+    void destroy(node_t *);
+};
+
+#endif //! SKIP_LIST_H
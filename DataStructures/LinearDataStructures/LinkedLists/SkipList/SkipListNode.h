@@ -0,0 +1,94 @@
+/**
+ * @file SkipListNode.h
+ * @author Carlos Salguero
+ * @brief Node declaration for the SkipList class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SKIP_LIST_NODE_H
+#define SKIP_LIST_NODE_H
+
+#include <cstddef> // std::size_t, std::byte
+#include <new>     // placement new
+#include <utility> // std::forward()
+
+/**
+ * @brief
+ * Node of a skip list. The tower of links is stored inline, right after the
+ * node itself, so a node of height h occupies a single block of
+ * block_size(h) bytes handed out by the NodePool.
+ * @tparam T Type of the data
+ */
+template <class T>
+struct SkipListNode
+{
+    /**
+     * @brief
+     * Forward link of one level. span is the number of level 0 steps
+     * between the owner of the link and next (the distance to the last
+     * element when next is nullptr).
+     */
+    struct Link
+    {
+        SkipListNode *next{};
+        std::size_t span{};
+    };
+
+    template <class... Args>
+    SkipListNode(std::size_t tower_height, Args &&...args)
+        : data(std::forward<Args>(args)...), height(tower_height)
+    {
+        for (std::size_t i = 0; i < height; ++i)
+            new (links() + i) Link{};
+    }
+
+    /**
+     * @brief
+     * Get the tower of links of the node
+     * @return Link* Pointer to the link of level 0
+     * @time complexity O(1)
+     * @space complexity O(1)
+     */
+    Link *links()
+    {
+        return reinterpret_cast<Link *>(
+            reinterpret_cast<std::byte *>(this) + links_offset());
+    }
+
+    const Link *links() const
+    {
+        return reinterpret_cast<const Link *>(
+            reinterpret_cast<const std::byte *>(this) + links_offset());
+    }
+
+    /**
+     * @brief
+     * Offset from the start of the node to its tower of links
+     * @return std::size_t Offset in bytes
+     */
+    static constexpr std::size_t links_offset()
+    {
+        return (sizeof(SkipListNode) + alignof(Link) - 1) /
+               alignof(Link) * alignof(Link);
+    }
+
+    /**
+     * @brief
+     * Number of bytes needed by a node with the given tower height
+     * @param tower_height Number of levels of the node
+     * @return std::size_t Size of the block in bytes
+     */
+    static constexpr std::size_t block_size(std::size_t tower_height)
+    {
+        return links_offset() + tower_height * sizeof(Link);
+    }
+
+    T data;
+    std::size_t height;
+};
+
+#endif //! SKIP_LIST_NODE_H
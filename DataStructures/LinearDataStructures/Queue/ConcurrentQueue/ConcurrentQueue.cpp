@@ -0,0 +1,267 @@
+/**
+ * @file ConcurrentQueue.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the ConcurrentQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_QUEUE_CPP
+#define CONCURRENT_QUEUE_CPP
+
+#include <utility> // std::forward(), std::move()
+
+#include "ConcurrentQueue.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new ConcurrentQueue< T>:: ConcurrentQueue object holding only
+ * the dummy node
+ * @tparam T Type of the data
+ */
+template <class T>
+ConcurrentQueue<T>::ConcurrentQueue()
+{
+    auto *const dummy{node_t::create()};
+
+    m_head.store(dummy, std::memory_order_relaxed);
+    m_tail.store(dummy, std::memory_order_relaxed);
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the ConcurrentQueue< T>:: ConcurrentQueue object and the values
+ * left in it. No thread may be using the queue any more.
+ * @tparam T Type of the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+ConcurrentQueue<T>::~ConcurrentQueue()
+{
+    auto *node{m_head.load(std::memory_order_relaxed)};
+
+    // The first node is the dummy, every other node still holds a value
+    for (bool dummy{true}; node != nullptr; dummy = false)
+    {
+        auto *const next{node->next.load(std::memory_order_relaxed)};
+
+        if (!dummy)
+            std::destroy_at(node->value());
+
+        node_t::recycle(node);
+        node = next;
+    }
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator, front first. Only valid while no other thread
+ * is using the queue.
+ * @tparam ostream_t Type of the data
+ * @param os Output stream
+ * @param queue Queue to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t>
+std::ostream &operator<<(std::ostream &os, const ConcurrentQueue<ostream_t> &queue)
+{
+    auto *node{queue.m_head.load(std::memory_order_acquire)->next.load(
+        std::memory_order_acquire)};
+
+    for (; node != nullptr; node = node->next.load(std::memory_order_acquire))
+        os << *node->value() << " ";
+
+    return os;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the queue is empty, as a snapshot
+ * @tparam T Type of the data
+ * @return true If the queue is empty
+ * @return false If the queue is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool ConcurrentQueue<T>::is_empty() const
+{
+    auto const guard{EpochManager::instance().pin()};
+
+    return m_head.load(std::memory_order_acquire)->next.load(std::memory_order_acquire) == nullptr;
+}
+
+/**
+ * @brief
+ * Add a value at the back
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+void ConcurrentQueue<T>::enqueue(const T &value)
+{
+    emplace(value);
+}
+
+/**
+ * @brief
+ * Add a value at the back
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+void ConcurrentQueue<T>::enqueue(T &&value)
+{
+    emplace(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value in a new node and add it at the back
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+template <class... Args>
+void ConcurrentQueue<T>::emplace(Args &&...args)
+{
+    auto *const node{node_t::create()};
+
+    try
+    {
+        node->construct(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        node_t::recycle(node);
+        throw;
+    }
+
+    link(node);
+}
+
+/**
+ * @brief
+ * Remove the value at the front
+ * @tparam T Type of the data
+ * @return std::optional<T> Value removed, std::nullopt if the queue is empty
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> ConcurrentQueue<T>::dequeue()
+{
+    auto &epochs{EpochManager::instance()};
+    auto const guard{epochs.pin()};
+
+    while (true)
+    {
+        auto *head{m_head.load(std::memory_order_acquire)};
+        auto *const tail{m_tail.load(std::memory_order_acquire)};
+        auto *const next{head->next.load(std::memory_order_acquire)};
+
+        if (head != m_head.load(std::memory_order_acquire))
+            continue;
+
+        if (next == nullptr)
+            return std::nullopt;
+
+        // The tail still points at the dummy, help the enqueuer move it
+        if (head == tail)
+        {
+            auto expected{tail};
+            m_tail.compare_exchange_strong(expected, next, std::memory_order_release,
+                                           std::memory_order_relaxed);
+            continue;
+        }
+
+        if (m_head.compare_exchange_strong(head, next, std::memory_order_acq_rel,
+                                           std::memory_order_relaxed))
+        {
+            // next is the new dummy and only this thread may take its value
+            std::optional<T> value{std::move(*next->value())};
+            std::destroy_at(next->value());
+
+            epochs.retire(head, &node_t::recycle);
+
+            return value;
+        }
+    }
+}
+
+/**
+ * @brief
+ * Prints the queue to a string. Only valid while no other thread is using
+ * the queue.
+ * @tparam T Type of the data
+ * @return std::string String representation of the queue
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string ConcurrentQueue<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Link a node after the last one and swing the tail to it
+ * @tparam T Type of the data
+ * @param node Node holding the new value
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+void ConcurrentQueue<T>::link(node_t *node)
+{
+    auto const guard{EpochManager::instance().pin()};
+
+    while (true)
+    {
+        auto *tail{m_tail.load(std::memory_order_acquire)};
+        auto *next{tail->next.load(std::memory_order_acquire)};
+
+        if (tail != m_tail.load(std::memory_order_acquire))
+            continue;
+
+        if (next != nullptr)
+        {
+            // Another enqueuer linked a node but has not moved the tail yet
+            m_tail.compare_exchange_strong(tail, next, std::memory_order_release,
+                                           std::memory_order_relaxed);
+            continue;
+        }
+
+        if (tail->next.compare_exchange_strong(next, node, std::memory_order_release,
+                                               std::memory_order_relaxed))
+        {
+            m_tail.compare_exchange_strong(tail, node, std::memory_order_release,
+                                           std::memory_order_relaxed);
+            return;
+        }
+    }
+}
+
+#endif //! CONCURRENT_QUEUE_CPP
@@ -0,0 +1,77 @@
+/**
+ * @file ConcurrentQueue.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ConcurrentQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_QUEUE_H
+#define CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <optional> // C++17, std::optional encapsulation
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+// Custom Headers
+#include "ConcurrentQueueNode.h"
+#include "../../../Concurrency/EpochManager.h"
+
+/**
+ * @brief
+ * Unbounded lock-free FIFO queue (Michael and Scott). The queue is a
+ * singly linked list that always starts with a dummy node: enqueue links a
+ * node after the last one with a compare-and-swap and then swings the
+ * tail, and dequeue swings the head to the second node, whose value is the
+ * one removed and which becomes the new dummy. A thread that finds the
+ * tail lagging behind helps to advance it.
+ *
+ * Dequeued dummies are retired through the EpochManager, so no node is
+ * reused while another thread may still be reading it; this also rules out
+ * the ABA problem on the head and tail.
+ * @tparam T Type of the data
+ */
+template <class T>
+class ConcurrentQueue
+{
+public:
+    using node_t = ConcurrentQueueNode<T>;
+
+    // Constructor
+    ConcurrentQueue();
+    ConcurrentQueue(const ConcurrentQueue &) = delete;
+
+    // Destructor
+    ~ConcurrentQueue();
+
+    // Operator overloads
+    ConcurrentQueue &operator=(const ConcurrentQueue &) = delete;
+
+    template <class ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const ConcurrentQueue<ostream_t> &);
+
+    // Functions
+    bool is_empty() const;
+
+    void enqueue(const T &);
+    void enqueue(T &&);
+
+    template <class... Args>
+    void emplace(Args &&...);
+
+    std::optional<T> dequeue();
+
+    std::string to_string() const;
+
+private:
+    alignas(64) std::atomic<node_t *> m_head;
+    alignas(64) std::atomic<node_t *> m_tail;
+
+    void link(node_t *);
+};
+
+#endif //! CONCURRENT_QUEUE_H
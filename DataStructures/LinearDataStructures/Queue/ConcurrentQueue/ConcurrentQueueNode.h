@@ -0,0 +1,132 @@
+/**
+ * @file ConcurrentQueueNode.h
+ * @author Carlos Salguero
+ * @brief Node declaration for the ConcurrentQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_QUEUE_NODE_H
+#define CONCURRENT_QUEUE_NODE_H
+
+#include <atomic>
+#include <cstddef> // std::size_t, std::byte
+#include <new>     // std::launder(), placement new
+#include <utility> // std::forward()
+
+/**
+ * @brief
+ * Node of a lock-free linked queue. The value is constructed and destroyed
+ * by the queue itself, because the node at the head is a dummy whose value
+ * has already been taken. Nodes are recycled through a small cache per
+ * thread instead of going back to the allocator every time.
+ * @tparam T Type of the data
+ */
+template <class T>
+struct ConcurrentQueueNode
+{
+    static constexpr std::size_t CACHE_LIMIT = 256;
+
+    /**
+     * @brief
+     * Take a node from the cache of the calling thread, or allocate one
+     * @return ConcurrentQueueNode* Node with next set to nullptr and no value
+     */
+    static ConcurrentQueueNode *create()
+    {
+        auto &free{cache()};
+        ConcurrentQueueNode *node;
+
+        if (free.head != nullptr)
+        {
+            node = free.head;
+            free.head = node->next.load(std::memory_order_relaxed);
+            --free.size;
+        }
+        else
+            node = new ConcurrentQueueNode;
+
+        node->next.store(nullptr, std::memory_order_relaxed);
+
+        return node;
+    }
+
+    /**
+     * @brief
+     * Give a node without a value back to the cache of the calling thread,
+     * or free it if the cache is full. Has the signature
+     * EpochManager::retire() expects.
+     * @param pointer Node to be recycled
+     */
+    static void recycle(void *pointer)
+    {
+        auto *node{static_cast<ConcurrentQueueNode *>(pointer)};
+        auto &free{cache()};
+
+        if (free.closed || free.size >= CACHE_LIMIT)
+        {
+            delete node;
+            return;
+        }
+
+        node->next.store(free.head, std::memory_order_relaxed);
+        free.head = node;
+        ++free.size;
+    }
+
+    T *value()
+    {
+        return std::launder(reinterpret_cast<T *>(storage));
+    }
+
+    template <class... Args>
+    void construct(Args &&...args)
+    {
+        ::new (static_cast<void *>(storage)) T(std::forward<Args>(args)...);
+    }
+
+    std::atomic<ConcurrentQueueNode *> next{nullptr};
+    alignas(T) std::byte storage[sizeof(T)];
+
+private:
+    /**
+     * @brief
+     * Free list of one thread. It is trivially destructible, so it can still
+     * be reached while the thread (or the process) is shutting down; the
+     * Drain frees its nodes at thread exit and closes it.
+     */
+    struct Cache
+    {
+        ConcurrentQueueNode *head;
+        std::size_t size;
+        bool closed;
+    };
+
+    struct Drain
+    {
+        Cache *cache;
+
+        ~Drain()
+        {
+            while (cache->head != nullptr)
+                delete std::exchange(cache->head,
+                                     cache->head->next.load(std::memory_order_relaxed));
+
+            cache->size = 0;
+            cache->closed = true;
+        }
+    };
+
+    static Cache &cache()
+    {
+        thread_local Cache cache{};
+        thread_local Drain drain{&cache};
+
+        return cache;
+    }
+};
+
+#endif //! CONCURRENT_QUEUE_NODE_H
@@ -0,0 +1,480 @@
+/**
+ * @file MPMCQueue.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the MPMCQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm> // std::max(), std::min()
+#include <bit>       // std::bit_ceil()
+#include <cstdint>   // std::intptr_t
+#include <new>       // std::launder()
+#include <thread>    // std::this_thread::yield()
+#include <utility>   // std::forward(), std::move()
+
+#include "MPMCQueue.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new MPMCQueue< T>:: MPMCQueue object
+ * @tparam T Type of the data
+ * @param capacity Maximum number of elements, rounded up to a power of two
+ * (at least 2)
+ * @time complexity O(capacity)
+ * @space complexity O(capacity)
+ */
+template <class T>
+MPMCQueue<T>::MPMCQueue(std::size_t capacity)
+    : m_mask{std::bit_ceil(std::max<std::size_t>(capacity, 2)) - 1}
+{
+    m_cells = std::make_unique<Cell[]>(m_mask + 1);
+
+    for (std::size_t i{}; i <= m_mask; ++i)
+        m_cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the MPMCQueue< T>:: MPMCQueue object and the elements left in it.
+ * No thread may be using the queue any more.
+ * @tparam T Type of the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+MPMCQueue<T>::~MPMCQueue()
+{
+    while (dequeue())
+        ;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements, as a snapshot
+ * @tparam T Type of the data
+ * @return std::size_t Size of the queue
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t MPMCQueue<T>::get_size() const
+{
+    auto const head{m_head.load(std::memory_order_acquire)};
+    auto const tail{m_tail.load(std::memory_order_acquire)};
+
+    return tail > head ? std::min(tail - head, capacity()) : 0;
+}
+
+/**
+ * @brief
+ * Get the maximum number of elements
+ * @tparam T Type of the data
+ * @return std::size_t Capacity of the queue, a power of two
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t MPMCQueue<T>::capacity() const
+{
+    return m_mask + 1;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the queue is empty, as a snapshot
+ * @tparam T Type of the data
+ * @return true If the queue is empty
+ * @return false If the queue is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool MPMCQueue<T>::is_empty() const
+{
+    return get_size() == 0;
+}
+
+/**
+ * @brief
+ * Add a value at the back without blocking
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @return true If the value was added
+ * @return false If the queue is full
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+bool MPMCQueue<T>::try_push(const T &value)
+{
+    return try_emplace(value);
+}
+
+/**
+ * @brief
+ * Add a value at the back without blocking
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @return true If the value was added
+ * @return false If the queue is full, value is left untouched
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+bool MPMCQueue<T>::try_push(T &&value)
+{
+    return try_emplace(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value in place at the back without blocking
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return true If the value was added
+ * @return false If the queue is full
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+template <class... Args>
+bool MPMCQueue<T>::try_emplace(Args &&...args)
+{
+    if (!enqueue(std::forward<Args>(args)...))
+        return false;
+
+    wake(m_waiting_consumers, m_not_empty);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Remove the value at the front without blocking
+ * @tparam T Type of the data
+ * @return std::optional<T> Value removed, std::nullopt if the queue is empty
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> MPMCQueue<T>::try_pop()
+{
+    auto value{dequeue()};
+
+    if (value)
+        wake(m_waiting_producers, m_not_full);
+
+    return value;
+}
+
+/**
+ * @brief
+ * Add a value at the back, waiting while the queue is full
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) when there is room
+ * @space complexity O(1)
+ */
+template <class T>
+void MPMCQueue<T>::push(const T &value)
+{
+    if (!try_push(value))
+    {
+        wait_until(m_waiting_producers, m_not_full,
+                   std::chrono::steady_clock::time_point::max(),
+                   [&]
+                   { return enqueue(value); });
+        wake(m_waiting_consumers, m_not_empty);
+    }
+}
+
+/**
+ * @brief
+ * Add a value at the back, waiting while the queue is full
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) when there is room
+ * @space complexity O(1)
+ */
+template <class T>
+void MPMCQueue<T>::push(T &&value)
+{
+    if (!try_push(std::move(value)))
+    {
+        wait_until(m_waiting_producers, m_not_full,
+                   std::chrono::steady_clock::time_point::max(),
+                   [&]
+                   { return enqueue(std::move(value)); });
+        wake(m_waiting_consumers, m_not_empty);
+    }
+}
+
+/**
+ * @brief
+ * Remove the value at the front, waiting while the queue is empty
+ * @tparam T Type of the data
+ * @return T Value removed
+ * @time complexity O(1) when there is a value
+ * @space complexity O(1)
+ */
+template <class T>
+T MPMCQueue<T>::pop()
+{
+    auto value{try_pop()};
+
+    if (!value)
+    {
+        wait_until(m_waiting_consumers, m_not_empty,
+                   std::chrono::steady_clock::time_point::max(),
+                   [&]
+                   { return (value = dequeue()).has_value(); });
+        wake(m_waiting_producers, m_not_full);
+    }
+
+    return std::move(*value);
+}
+
+/**
+ * @brief
+ * Add a value at the back, waiting at most timeout for room
+ * @tparam T Type of the data
+ * @tparam Rep Arithmetic type of the timeout
+ * @tparam Period Unit of the timeout
+ * @param value Value to be copied
+ * @param timeout Maximum time to wait
+ * @return true If the value was added
+ * @return false If the queue stayed full
+ * @time complexity O(1) when there is room
+ * @space complexity O(1)
+ */
+template <class T>
+template <class Rep, class Period>
+bool MPMCQueue<T>::try_push_for(const T &value,
+                                const std::chrono::duration<Rep, Period> &timeout)
+{
+    if (try_push(value))
+        return true;
+
+    auto const deadline{std::chrono::steady_clock::now() + timeout};
+
+    if (!wait_until(m_waiting_producers, m_not_full, deadline, [&]
+                    { return enqueue(value); }))
+        return false;
+
+    wake(m_waiting_consumers, m_not_empty);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Remove the value at the front, waiting at most timeout for one
+ * @tparam T Type of the data
+ * @tparam Rep Arithmetic type of the timeout
+ * @tparam Period Unit of the timeout
+ * @param timeout Maximum time to wait
+ * @return std::optional<T> Value removed, std::nullopt if the queue stayed
+ * empty
+ * @time complexity O(1) when there is a value
+ * @space complexity O(1)
+ */
+template <class T>
+template <class Rep, class Period>
+std::optional<T>
+MPMCQueue<T>::try_pop_for(const std::chrono::duration<Rep, Period> &timeout)
+{
+    auto value{try_pop()};
+
+    if (value)
+        return value;
+
+    auto const deadline{std::chrono::steady_clock::now() + timeout};
+
+    if (wait_until(m_waiting_consumers, m_not_empty, deadline, [&]
+                   { return (value = dequeue()).has_value(); }))
+        wake(m_waiting_producers, m_not_full);
+
+    return value;
+}
+
+// Private Functions
+template <class T>
+T *MPMCQueue<T>::value_at(Cell &cell)
+{
+    return std::launder(reinterpret_cast<T *>(cell.storage));
+}
+
+/**
+ * @brief
+ * Claim the next ticket and fill its slot. Does not wake anybody.
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return true If the value was added
+ * @return false If the queue is full
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+template <class... Args>
+bool MPMCQueue<T>::enqueue(Args &&...args)
+{
+    auto tail{m_tail.load(std::memory_order_relaxed)};
+    Cell *cell;
+
+    while (true)
+    {
+        cell = &m_cells[tail & m_mask];
+
+        auto const sequence{cell->sequence.load(std::memory_order_acquire)};
+        auto const turn{static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(tail)};
+
+        if (turn == 0)
+        {
+            if (m_tail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed))
+                break;
+        }
+        // The slot still holds the value of the previous lap
+        else if (turn < 0)
+            return false;
+        else
+            tail = m_tail.load(std::memory_order_relaxed);
+    }
+
+    ::new (static_cast<void *>(cell->storage)) T(std::forward<Args>(args)...);
+    cell->sequence.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Claim the next ticket and empty its slot. Does not wake anybody.
+ * @tparam T Type of the data
+ * @return std::optional<T> Value removed, std::nullopt if the queue is empty
+ * @time complexity O(1), lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> MPMCQueue<T>::dequeue()
+{
+    auto head{m_head.load(std::memory_order_relaxed)};
+    Cell *cell;
+
+    while (true)
+    {
+        cell = &m_cells[head & m_mask];
+
+        auto const sequence{cell->sequence.load(std::memory_order_acquire)};
+        auto const turn{static_cast<std::intptr_t>(sequence) -
+                        static_cast<std::intptr_t>(head + 1)};
+
+        if (turn == 0)
+        {
+            if (m_head.compare_exchange_weak(head, head + 1, std::memory_order_relaxed))
+                break;
+        }
+        // No producer has filled the slot yet
+        else if (turn < 0)
+            return std::nullopt;
+        else
+            head = m_head.load(std::memory_order_relaxed);
+    }
+
+    auto *const slot{value_at(*cell)};
+    std::optional<T> value{std::move(*slot)};
+
+    std::destroy_at(slot);
+    cell->sequence.store(head + m_mask + 1, std::memory_order_release);
+
+    return value;
+}
+
+/**
+ * @brief
+ * Wake one thread blocked on condition, if any is registered in waiting.
+ * The fence pairs with the one in wait_until: either the waiter sees the
+ * change made before this call, or this call sees the waiter.
+ * @tparam T Type of the data
+ * @param waiting Number of threads blocked on condition
+ * @param condition Condition variable to notify
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void MPMCQueue<T>::wake(std::atomic<std::size_t> &waiting,
+                        std::condition_variable &condition)
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if (waiting.load(std::memory_order_relaxed) == 0)
+        return;
+
+    // Taking the mutex orders the notification after the waiter's check
+    {
+        std::lock_guard lock{m_mutex};
+    }
+
+    condition.notify_one();
+}
+
+/**
+ * @brief
+ * Block until ready() succeeds or the deadline passes. ready() is first
+ * retried SPIN_LIMIT times, yielding in between, since the other side
+ * usually catches up within a few time slices; after that the thread
+ * sleeps and ready() is retried under the mutex on every wake-up.
+ * @tparam T Type of the data
+ * @tparam Predicate Callable returning bool
+ * @param waiting Counter of threads blocked on condition
+ * @param condition Condition variable to wait on
+ * @param deadline Time to give up, time_point::max() to wait forever
+ * @param ready Operation to retry
+ * @return true If ready() succeeded
+ * @return false If the deadline passed first
+ */
+template <class T>
+template <class Predicate>
+bool MPMCQueue<T>::wait_until(std::atomic<std::size_t> &waiting,
+                              std::condition_variable &condition,
+                              std::chrono::steady_clock::time_point deadline,
+                              Predicate ready)
+{
+    for (std::size_t i{}; i < SPIN_LIMIT; ++i)
+    {
+        if (ready())
+            return true;
+
+        std::this_thread::yield();
+    }
+
+    waiting.fetch_add(1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    bool done;
+    {
+        std::unique_lock lock{m_mutex};
+
+        if (deadline == std::chrono::steady_clock::time_point::max())
+        {
+            condition.wait(lock, ready);
+            done = true;
+        }
+        else
+            done = condition.wait_until(lock, deadline, ready);
+    }
+
+    waiting.fetch_sub(1, std::memory_order_relaxed);
+
+    return done;
+}
@@ -0,0 +1,114 @@
+/**
+ * @file MPMCQueue.h
+ * @author Carlos Salguero
+ * @brief Declaration of the MPMCQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MPMC_QUEUE_H
+#define MPMC_QUEUE_H
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef> // std::size_t, std::byte
+#include <memory>  // std::unique_ptr
+#include <mutex>
+#include <optional> // C++17, std::optional encapsulation
+
+/**
+ * @brief
+ * Bounded lock-free queue for any number of producer and consumer threads
+ * (Dmitry Vyukov's design). Every slot of the ring carries a sequence
+ * number that says whose turn it is: a producer may fill slot i when its
+ * sequence equals the ticket i, and a consumer may empty it when it equals
+ * i + 1. A thread claims a ticket with a single compare-and-swap on the
+ * tail (or head) and never waits for another thread to finish.
+ *
+ * push, pop and the timed variants yield a few times and then block on a
+ * condition variable when the queue is full or empty. Waiters are counted, so the lock-free operations
+ * only touch the mutex when somebody is actually waiting.
+ * @tparam T Type of the data
+ */
+template <class T>
+class MPMCQueue
+{
+public:
+    static constexpr std::size_t SPIN_LIMIT = 16;
+
+    // Constructor
+    explicit MPMCQueue(std::size_t);
+    MPMCQueue(const MPMCQueue &) = delete;
+
+    // Destructor
+    ~MPMCQueue();
+
+    // Operator overloads
+    MPMCQueue &operator=(const MPMCQueue &) = delete;
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    // Functions
+    bool is_empty() const;
+
+    // Non-blocking
+    bool try_push(const T &);
+    bool try_push(T &&);
+
+    template <class... Args>
+    bool try_emplace(Args &&...);
+
+    std::optional<T> try_pop();
+
+    // Blocking
+    void push(const T &);
+    void push(T &&);
+    T pop();
+
+    template <class Rep, class Period>
+    bool try_push_for(const T &, const std::chrono::duration<Rep, Period> &);
+
+    template <class Rep, class Period>
+    std::optional<T> try_pop_for(const std::chrono::duration<Rep, Period> &);
+
+private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence;
+        alignas(T) std::byte storage[sizeof(T)];
+    };
+
+    // Read-only after construction
+    alignas(64) std::unique_ptr<Cell[]> m_cells;
+    std::size_t m_mask;
+
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    alignas(64) std::atomic<std::size_t> m_head{0};
+
+    // Only used when a thread has to block
+    alignas(64) std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+    std::atomic<std::size_t> m_waiting_producers{0};
+    std::atomic<std::size_t> m_waiting_consumers{0};
+
+    T *value_at(Cell &);
+
+    template <class... Args>
+    bool enqueue(Args &&...);
+    std::optional<T> dequeue();
+
+    void wake(std::atomic<std::size_t> &, std::condition_variable &);
+
+    template <class Predicate>
+    bool wait_until(std::atomic<std::size_t> &, std::condition_variable &,
+                    std::chrono::steady_clock::time_point, Predicate);
+};
+
+#endif //! MPMC_QUEUE_H
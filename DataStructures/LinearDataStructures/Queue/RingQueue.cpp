@@ -0,0 +1,266 @@
+/**
+ * @file RingQueue.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the RingQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <utility> // std::forward(), std::move()
+
+#include "RingQueue.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new RingQueue< T>:: RingQueue object with room for capacity
+ * elements before it has to grow
+ * @tparam T Type of the data
+ * @param capacity Number of elements to reserve
+ */
+template <class T>
+RingQueue<T>::RingQueue(std::size_t capacity) : m_buffer{capacity}
+{
+}
+
+// Operator overloading
+/**
+ * @brief
+ * Overload the << operator, front first
+ * @tparam T Type of the data
+ * @param os Output stream
+ * @param queue Queue to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <typename ostream_t>
+std::ostream &operator<<(std::ostream &os, const RingQueue<ostream_t> &queue)
+{
+    return os << queue.m_buffer;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @return std::size_t Size of the queue
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t RingQueue<T>::get_size() const
+{
+    return m_buffer.get_size();
+}
+
+/**
+ * @brief
+ * Get the number of elements that fit before the queue grows
+ * @tparam T Type of the data
+ * @return std::size_t Capacity of the queue
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t RingQueue<T>::capacity() const
+{
+    return m_buffer.capacity();
+}
+
+// Functions
+/**
+ * @brief
+ * Check if the queue is empty
+ * @tparam T Type of the data
+ * @return true Queue is empty
+ * @return false Queue is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool RingQueue<T>::is_empty() const
+{
+    return m_buffer.is_empty();
+}
+
+/**
+ * @brief
+ * Check if the queue contains a value
+ * @tparam T Type of the data
+ * @param value Value to be searched
+ * @return true Queue contains the value
+ * @return false Queue does not contain the value
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+bool RingQueue<T>::contains(const T &value) const
+{
+    return m_buffer.contains(value);
+}
+
+/**
+ * @brief
+ * Make room for at least capacity elements
+ * @tparam T Type of the data
+ * @param capacity Number of elements
+ * @time complexity O(n) if the queue grows, O(1) otherwise
+ * @space complexity O(capacity)
+ */
+template <class T>
+void RingQueue<T>::reserve(std::size_t capacity)
+{
+    m_buffer.reserve(capacity);
+}
+
+/**
+ * @brief
+ * Add a value at the back of the queue
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void RingQueue<T>::enqueue(const T &value)
+{
+    m_buffer.push_back(value);
+}
+
+/**
+ * @brief
+ * Add a value at the back of the queue
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void RingQueue<T>::enqueue(T &&value)
+{
+    m_buffer.push_back(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value in place at the back of the queue
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return T& The new back
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+template <class... Args>
+T &RingQueue<T>::emplace(Args &&...args)
+{
+    return m_buffer.emplace_back(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief
+ * Enqueue every value of [first, last) in order
+ * @tparam T Type of the data
+ * @tparam InputIt Type of the iterators
+ * @param first Beginning of the range
+ * @param last End of the range
+ * @time complexity O(k) for k values
+ * @space complexity O(k)
+ */
+template <class T>
+template <class InputIt>
+void RingQueue<T>::push_range(InputIt first, InputIt last)
+{
+    m_buffer.push_range(first, last);
+}
+
+/**
+ * @brief
+ * Dequeue up to count values, moving them into out from the front
+ * @tparam T Type of the data
+ * @tparam OutputIt Type of the output iterator
+ * @param out Destination of the values
+ * @param count Maximum number of values
+ * @return std::size_t Number of values popped
+ * @time complexity O(k) for k values
+ * @space complexity O(1)
+ */
+template <class T>
+template <class OutputIt>
+std::size_t RingQueue<T>::pop_n(OutputIt out, std::size_t count)
+{
+    return m_buffer.pop_front_n(out, count);
+}
+
+/**
+ * @brief
+ * Clears the queue. The capacity is kept.
+ * @tparam T Type of the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+void RingQueue<T>::clear()
+{
+    m_buffer.clear();
+}
+
+/**
+ * @brief
+ * Remove the first value of the queue
+ * @tparam T Type of the data
+ * @return std::optional<T> Value removed, std::nullopt if empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> RingQueue<T>::dequeue()
+{
+    if (is_empty())
+        return std::nullopt;
+
+    std::optional<T> value{std::move(m_buffer.front())};
+    m_buffer.pop_front();
+
+    return value;
+}
+
+/**
+ * @brief
+ * Get the first value of the queue
+ * @tparam T Type of the data
+ * @return std::optional<T> First value, std::nullopt if empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> RingQueue<T>::peek() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_buffer.front();
+}
+
+/**
+ * @brief
+ * Prints the queue to a string
+ * @tparam T Type of the data
+ * @return std::string String representation of the queue
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string RingQueue<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
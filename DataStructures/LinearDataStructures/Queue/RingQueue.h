@@ -0,0 +1,75 @@
+/**
+ * @file RingQueue.h
+ * @author Carlos Salguero
+ * @brief Declaration of the RingQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RING_QUEUE_H
+#define RING_QUEUE_H
+
+#include <cstddef>  // std::size_t
+#include <optional> // C++17, std::optional encapsulation
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+#include "../RingBuffer/RingBuffer.cpp"
+
+/**
+ * @brief
+ * Queue stored in a contiguous, growable RingBuffer instead of one node per
+ * element. Values are enqueued at the back of the buffer and dequeued from
+ * its front, so no element is ever shifted.
+ * @tparam T Type of the data
+ */
+template <class T>
+class RingQueue
+{
+public:
+    // Constructor
+    RingQueue() = default;
+    explicit RingQueue(std::size_t);
+
+    // Destructor
+    ~RingQueue() = default;
+
+    // Operator overload
+    template <typename ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const RingQueue<ostream_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    void reserve(std::size_t);
+    void enqueue(const T &);
+    void enqueue(T &&);
+
+    template <class... Args>
+    T &emplace(Args &&...);
+
+    template <class InputIt>
+    void push_range(InputIt, InputIt);
+
+    template <class OutputIt>
+    std::size_t pop_n(OutputIt, std::size_t);
+
+    void clear();
+
+    std::optional<T> dequeue();
+    std::optional<T> peek() const;
+    std::string to_string() const;
+
+private:
+    RingBuffer<T> m_buffer;
+};
+
+#endif //! RING_QUEUE_H
@@ -0,0 +1,318 @@
+/**
+ * @file SPSCQueue.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the SPSCQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <algorithm> // std::max(), std::min()
+#include <bit>       // std::bit_ceil()
+#include <utility>   // std::forward(), std::move()
+
+#include "SPSCQueue.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new SPSCQueue< T>:: SPSCQueue object
+ * @tparam T Type of the data
+ * @param capacity Maximum number of elements, rounded up to a power of two
+ * @time complexity O(1)
+ * @space complexity O(capacity)
+ */
+template <class T>
+SPSCQueue<T>::SPSCQueue(std::size_t capacity)
+    : m_mask{std::bit_ceil(std::max<std::size_t>(capacity, 1)) - 1}
+{
+    m_data = allocator_t{}.allocate(m_mask + 1);
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the SPSCQueue< T>:: SPSCQueue object and the elements left in it.
+ * Neither thread may be using the queue any more.
+ * @tparam T Type of the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+SPSCQueue<T>::~SPSCQueue()
+{
+    auto const tail{m_tail.load(std::memory_order_relaxed)};
+
+    for (auto head{m_head.load(std::memory_order_relaxed)}; head != tail; ++head)
+        std::destroy_at(m_data + (head & m_mask));
+
+    allocator_t{}.deallocate(m_data, m_mask + 1);
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator, front first. Only valid while neither thread
+ * is using the queue.
+ * @tparam ostream_t Type of the data
+ * @param os Output stream
+ * @param queue Queue to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t>
+std::ostream &operator<<(std::ostream &os, const SPSCQueue<ostream_t> &queue)
+{
+    auto const tail{queue.m_tail.load(std::memory_order_acquire)};
+
+    for (auto head{queue.m_head.load(std::memory_order_acquire)}; head != tail; ++head)
+        os << queue.m_data[head & queue.m_mask] << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements. The value is exact only when neither thread
+ * is working on the queue; otherwise it is a snapshot.
+ * @tparam T Type of the data
+ * @return std::size_t Size of the queue
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t SPSCQueue<T>::get_size() const
+{
+    // The head is read first so it can never be ahead of the tail
+    auto const head{m_head.load(std::memory_order_acquire)};
+    auto const tail{m_tail.load(std::memory_order_acquire)};
+
+    return std::min(tail - head, capacity());
+}
+
+/**
+ * @brief
+ * Get the maximum number of elements
+ * @tparam T Type of the data
+ * @return std::size_t Capacity of the queue, a power of two
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t SPSCQueue<T>::capacity() const
+{
+    return m_mask + 1;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the queue is empty, as a snapshot
+ * @tparam T Type of the data
+ * @return true If the queue is empty
+ * @return false If the queue is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool SPSCQueue<T>::is_empty() const
+{
+    return get_size() == 0;
+}
+
+/**
+ * @brief
+ * Add a value at the back. Producer thread only.
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @return true If the value was added
+ * @return false If the queue is full
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool SPSCQueue<T>::try_push(const T &value)
+{
+    return try_emplace(value);
+}
+
+/**
+ * @brief
+ * Add a value at the back. Producer thread only.
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @return true If the value was added
+ * @return false If the queue is full, value is left untouched
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool SPSCQueue<T>::try_push(T &&value)
+{
+    return try_emplace(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value in place at the back. Producer thread only.
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return true If the value was added
+ * @return false If the queue is full
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+template <class... Args>
+bool SPSCQueue<T>::try_emplace(Args &&...args)
+{
+    auto const tail{m_tail.load(std::memory_order_relaxed)};
+
+    if (tail - m_cached_head == capacity())
+    {
+        m_cached_head = m_head.load(std::memory_order_acquire);
+
+        if (tail - m_cached_head == capacity())
+            return false;
+    }
+
+    std::construct_at(m_data + (tail & m_mask), std::forward<Args>(args)...);
+    m_tail.store(tail + 1, std::memory_order_release);
+
+    return true;
+}
+
+/**
+ * @brief
+ * Copy up to count values starting at first to the back and publish them
+ * together. Producer thread only.
+ * @tparam T Type of the data
+ * @tparam InputIt Type of the iterator
+ * @param first Beginning of the values
+ * @param count Maximum number of values
+ * @return std::size_t Number of values added, less than count if the
+ * queue filled up
+ * @throw Whatever copying a value throws. The values of the batch copied
+ * before it are destroyed, and the queue is left as it was.
+ * @time complexity O(k) for k values
+ * @space complexity O(1)
+ */
+template <class T>
+template <class InputIt>
+std::size_t SPSCQueue<T>::try_push_n(InputIt first, std::size_t count)
+{
+    auto const tail{m_tail.load(std::memory_order_relaxed)};
+
+    if (capacity() - (tail - m_cached_head) < count)
+        m_cached_head = m_head.load(std::memory_order_acquire);
+
+    count = std::min(count, capacity() - (tail - m_cached_head));
+
+    std::size_t i{};
+
+    try
+    {
+        for (; i < count; ++i, ++first)
+            std::construct_at(m_data + ((tail + i) & m_mask), *first);
+    }
+    catch (...)
+    {
+        while (i > 0)
+            std::destroy_at(m_data + ((tail + --i) & m_mask));
+
+        throw;
+    }
+
+    m_tail.store(tail + count, std::memory_order_release);
+
+    return count;
+}
+
+/**
+ * @brief
+ * Remove the value at the front. Consumer thread only.
+ * @tparam T Type of the data
+ * @return std::optional<T> Value removed, std::nullopt if the queue is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> SPSCQueue<T>::try_pop()
+{
+    auto const head{m_head.load(std::memory_order_relaxed)};
+
+    if (head == m_cached_tail)
+    {
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+        if (head == m_cached_tail)
+            return std::nullopt;
+    }
+
+    auto *const slot{m_data + (head & m_mask)};
+    std::optional<T> value{std::move(*slot)};
+
+    std::destroy_at(slot);
+    m_head.store(head + 1, std::memory_order_release);
+
+    return value;
+}
+
+/**
+ * @brief
+ * Move up to count values from the front into out and release their slots
+ * together. Consumer thread only.
+ * @tparam T Type of the data
+ * @tparam OutputIt Type of the output iterator
+ * @param out Destination of the values
+ * @param count Maximum number of values
+ * @return std::size_t Number of values removed
+ * @time complexity O(k) for k values
+ * @space complexity O(1)
+ */
+template <class T>
+template <class OutputIt>
+std::size_t SPSCQueue<T>::try_pop_n(OutputIt out, std::size_t count)
+{
+    auto const head{m_head.load(std::memory_order_relaxed)};
+
+    if (m_cached_tail - head < count)
+        m_cached_tail = m_tail.load(std::memory_order_acquire);
+
+    count = std::min(count, m_cached_tail - head);
+
+    for (std::size_t i{}; i < count; ++i, ++out)
+    {
+        auto *const slot{m_data + ((head + i) & m_mask)};
+
+        *out = std::move(*slot);
+        std::destroy_at(slot);
+    }
+
+    m_head.store(head + count, std::memory_order_release);
+
+    return count;
+}
+
+/**
+ * @brief
+ * Prints the queue to a string. Only valid while neither thread is using
+ * the queue.
+ * @tparam T Type of the data
+ * @return std::string String representation of the queue
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string SPSCQueue<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
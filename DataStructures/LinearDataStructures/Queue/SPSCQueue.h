@@ -0,0 +1,90 @@
+/**
+ * @file SPSCQueue.h
+ * @author Carlos Salguero
+ * @brief Declaration of the SPSCQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef SPSC_QUEUE_H
+#define SPSC_QUEUE_H
+
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <memory>   // std::allocator
+#include <optional> // C++17, std::optional encapsulation
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+/**
+ * @brief
+ * Bounded lock-free queue for exactly one producer thread and one consumer
+ * thread. The elements live in a ring whose capacity is a power of two.
+ * The producer only writes the tail and the consumer only writes the head,
+ * each on its own cache line, and each side keeps a private copy of the
+ * other side's index that it refreshes only when the ring looks full (or
+ * empty), so in the common case neither side reads the other's cache line.
+ * @tparam T Type of the data
+ */
+template <class T>
+class SPSCQueue
+{
+public:
+    // Constructor
+    explicit SPSCQueue(std::size_t);
+    SPSCQueue(const SPSCQueue &) = delete;
+
+    // Destructor
+    ~SPSCQueue();
+
+    // Operator overloads
+    SPSCQueue &operator=(const SPSCQueue &) = delete;
+
+    template <class ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const SPSCQueue<ostream_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    // Functions
+    bool is_empty() const;
+
+    // Producer
+    bool try_push(const T &);
+    bool try_push(T &&);
+
+    template <class... Args>
+    bool try_emplace(Args &&...);
+
+    template <class InputIt>
+    std::size_t try_push_n(InputIt, std::size_t);
+
+    // Consumer
+    std::optional<T> try_pop();
+
+    template <class OutputIt>
+    std::size_t try_pop_n(OutputIt, std::size_t);
+
+    std::string to_string() const;
+
+private:
+    using allocator_t = std::allocator<T>;
+
+    // Read-only after construction
+    alignas(64) T *m_data;
+    std::size_t m_mask;
+
+    // Written by the consumer
+    alignas(64) std::atomic<std::size_t> m_head{0};
+    std::size_t m_cached_tail{0};
+
+    // Written by the producer
+    alignas(64) std::atomic<std::size_t> m_tail{0};
+    std::size_t m_cached_head{0};
+};
+
+#endif //! SPSC_QUEUE_H
@@ -0,0 +1,238 @@
+/**
+ * @file MonotonicQueue.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the MonotonicQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MONOTONIC_QUEUE_CPP
+#define MONOTONIC_QUEUE_CPP
+
+#include <iterator>  // std::forward_iterator, std::distance(), std::next()
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move()
+
+#include "MonotonicQueue.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new MonotonicQueue< T, Compare>:: MonotonicQueue object
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering, the extreme is the first value by it
+ * @param window Number of values in the window, 0 to remove them by hand
+ * @param compare Ordering of the values
+ */
+template <class T, class Compare>
+MonotonicQueue<T, Compare>::MonotonicQueue(std::size_t window, Compare compare)
+    : m_window{window}, m_compare{std::move(compare)}
+{
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator. Prints the candidates, front (the extreme)
+ * first.
+ * @tparam ostream_t Type of the data
+ * @tparam compare_t Ordering of the values
+ * @param os Output stream
+ * @param queue Queue to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class compare_t>
+std::ostream &operator<<(std::ostream &os, const MonotonicQueue<ostream_t, compare_t> &queue)
+{
+    for (std::size_t i{}; i < queue.m_candidates.get_size(); ++i)
+        os << queue.m_candidates[i].value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of values in the window, kept or not
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @return std::size_t Number of values in the window
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t MonotonicQueue<T, Compare>::get_size() const
+{
+    return static_cast<std::size_t>(m_back - m_front);
+}
+
+/**
+ * @brief
+ * Get the size of the window
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @return std::size_t Window size, 0 if values are removed by hand
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::size_t MonotonicQueue<T, Compare>::get_window() const
+{
+    return m_window;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the window is empty
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @return true If the window is empty
+ * @return false If the window is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+bool MonotonicQueue<T, Compare>::is_empty() const
+{
+    return m_front == m_back;
+}
+
+/**
+ * @brief
+ * Add a value at the back of the window, removing the oldest one first if
+ * the window is full
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @param value Value to be added
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T, class Compare>
+void MonotonicQueue<T, Compare>::push(const T &value)
+{
+    if (m_window != 0 && get_size() == m_window)
+        pop();
+
+    // Older values that are not better than the new one can never be the
+    // extreme again
+    while (!m_candidates.is_empty() && !m_compare(m_candidates.back().value, value))
+        m_candidates.pop_back();
+
+    m_candidates.push_back(Candidate{m_back++, value});
+}
+
+/**
+ * @brief
+ * Add a batch of values. With a window size, only the values that end up
+ * in the window are compared, the ones before are only counted.
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @tparam InputIt Type of the input iterator
+ * @param first Beginning of the values
+ * @param last End of the values
+ * @time complexity O(k) amortized, k values added
+ * @space complexity O(1) amortized
+ */
+template <class T, class Compare>
+template <class InputIt>
+void MonotonicQueue<T, Compare>::push_range(InputIt first, InputIt last)
+{
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        auto const count{static_cast<std::size_t>(std::distance(first, last))};
+
+        if (m_window != 0 && count > m_window)
+        {
+            // Every value in the window now comes from the batch
+            m_candidates.clear();
+            m_back += count - m_window;
+            m_front = m_back;
+            first = std::next(first, static_cast<std::ptrdiff_t>(count - m_window));
+        }
+    }
+
+    for (; first != last; ++first)
+        push(*first);
+}
+
+/**
+ * @brief
+ * Remove the oldest value of the window
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @throw std::runtime_error If the window is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void MonotonicQueue<T, Compare>::pop()
+{
+    if (is_empty())
+        throw std::runtime_error("Queue is empty");
+
+    // The oldest value is only kept if it is the current extreme
+    if (m_candidates.front().index == m_front)
+        m_candidates.pop_front();
+
+    ++m_front;
+}
+
+/**
+ * @brief
+ * Remove every value
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+void MonotonicQueue<T, Compare>::clear()
+{
+    m_candidates.clear();
+    m_front = m_back;
+}
+
+/**
+ * @brief
+ * Get the extreme of the window
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @return std::optional<T> First value of the window by Compare,
+ * std::nullopt if the window is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Compare>
+std::optional<T> MonotonicQueue<T, Compare>::peek() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_candidates.front().value;
+}
+
+/**
+ * @brief
+ * Prints the candidates to a string, front first
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering
+ * @return std::string String representation of the candidates
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, class Compare>
+std::string MonotonicQueue<T, Compare>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+#endif //! MONOTONIC_QUEUE_CPP
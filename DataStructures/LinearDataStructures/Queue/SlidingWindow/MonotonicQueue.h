@@ -0,0 +1,86 @@
+/**
+ * @file MonotonicQueue.h
+ * @author Carlos Salguero
+ * @brief Declaration of the MonotonicQueue class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef MONOTONIC_QUEUE_H
+#define MONOTONIC_QUEUE_H
+
+#include <cstddef>    // std::size_t
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::less
+#include <optional>   // C++17, std::optional encapsulation
+#include <sstream>    // std::stringstream for to_string()
+#include <string>
+
+#include "../../RingBuffer/RingBuffer.cpp"
+
+/**
+ * @brief
+ * FIFO window that answers "what is the minimum" (or the maximum, with
+ * std::greater) in O(1). It does not keep every value, only the ones that
+ * can still become the extreme: a new value removes every older value that
+ * is not better than it, so the kept values are sorted from the front and
+ * the extreme is always the front one. Each value is added and removed at
+ * most once, so push and pop are O(1) amortized.
+ *
+ * With a window size, push removes the oldest value once the window is
+ * full; with a window of 0 the caller removes values with pop().
+ * @tparam T Type of the data
+ * @tparam Compare Strict ordering, the extreme is the first value by it
+ */
+template <class T, class Compare = std::less<T>>
+class MonotonicQueue
+{
+public:
+    // Constructor
+    explicit MonotonicQueue(std::size_t window = 0, Compare compare = Compare{});
+
+    // Destructor
+    ~MonotonicQueue() = default;
+
+    // Operator overloads
+    template <class ostream_t, class compare_t>
+    friend std::ostream &operator<<(std::ostream &, const MonotonicQueue<ostream_t, compare_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t get_window() const;
+
+    // Functions
+    bool is_empty() const;
+
+    void push(const T &);
+
+    template <class InputIt>
+    void push_range(InputIt, InputIt);
+
+    void pop();
+    void clear();
+
+    std::optional<T> peek() const;
+    std::string to_string() const;
+
+private:
+    struct Candidate
+    {
+        std::uint64_t index;
+        T value;
+    };
+
+    RingBuffer<Candidate> m_candidates;
+    std::size_t m_window;
+    Compare m_compare;
+
+    // Index of the oldest value in the window and of the next value
+    std::uint64_t m_front{};
+    std::uint64_t m_back{};
+};
+
+#endif //! MONOTONIC_QUEUE_H
@@ -0,0 +1,253 @@
+/**
+ * @file WindowAggregator.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the WindowAggregator class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef WINDOW_AGGREGATOR_CPP
+#define WINDOW_AGGREGATOR_CPP
+
+#include <iterator>  // std::forward_iterator, std::distance(), std::next()
+#include <stdexcept> // std::runtime_error
+#include <utility>   // std::move()
+
+#include "WindowAggregator.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new WindowAggregator< T, Op>:: WindowAggregator object
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param window Number of values in the window, 0 to remove them by hand
+ * @param identity Identity of the operation, the aggregate of no values
+ * @param op Operation
+ */
+template <class T, class Op>
+WindowAggregator<T, Op>::WindowAggregator(std::size_t window, T identity, Op op)
+    : m_identity{identity}, m_back{std::move(identity)}, m_op{std::move(op)},
+      m_window{window}
+{
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator. Prints the aggregate, since the values that
+ * reached the front part are no longer stored one by one.
+ * @tparam ostream_t Type of the data
+ * @tparam op_t Associative binary operation
+ * @param os Output stream
+ * @param aggregator Aggregator to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class op_t>
+std::ostream &operator<<(std::ostream &os, const WindowAggregator<ostream_t, op_t> &aggregator)
+{
+    return os << aggregator.query() << " ";
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of values in the window
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::size_t Number of values
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::size_t WindowAggregator<T, Op>::get_size() const
+{
+    return m_entries.get_size();
+}
+
+/**
+ * @brief
+ * Get the size of the window
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::size_t Window size, 0 if values are removed by hand
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::size_t WindowAggregator<T, Op>::get_window() const
+{
+    return m_window;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the window is empty
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return true If the window is empty
+ * @return false If the window is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+bool WindowAggregator<T, Op>::is_empty() const
+{
+    return m_entries.is_empty();
+}
+
+/**
+ * @brief
+ * Add a value at the back of the window, removing the oldest one first if
+ * the window is full
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param value Value to be added
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T, class Op>
+void WindowAggregator<T, Op>::push(const T &value)
+{
+    if (m_window != 0 && m_entries.get_size() == m_window)
+        pop();
+
+    m_back = m_op(m_back, value);
+    m_entries.push_back(value);
+}
+
+/**
+ * @brief
+ * Add a batch of values. With a window size, values that would be removed
+ * before the batch ends are skipped.
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @tparam InputIt Type of the input iterator
+ * @param first Beginning of the values
+ * @param last End of the values
+ * @time complexity O(k) amortized, k values added
+ * @space complexity O(1) amortized
+ */
+template <class T, class Op>
+template <class InputIt>
+void WindowAggregator<T, Op>::push_range(InputIt first, InputIt last)
+{
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        auto const count{static_cast<std::size_t>(std::distance(first, last))};
+
+        if (m_window != 0 && count >= m_window)
+        {
+            // Every value in the window now comes from the batch
+            clear();
+            first = std::next(first, static_cast<std::ptrdiff_t>(count - m_window));
+        }
+    }
+
+    for (; first != last; ++first)
+        push(*first);
+}
+
+/**
+ * @brief
+ * Remove the oldest value of the window
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @throw std::runtime_error If the window is empty
+ * @time complexity O(1) amortized, O(n) when the front part is rebuilt
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void WindowAggregator<T, Op>::pop()
+{
+    if (is_empty())
+        throw std::runtime_error("Window is empty");
+
+    if (m_split == 0)
+        flip();
+
+    m_entries.pop_front();
+    --m_split;
+}
+
+/**
+ * @brief
+ * Remove every value
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void WindowAggregator<T, Op>::clear()
+{
+    m_entries.clear();
+    m_split = 0;
+    m_back = m_identity;
+}
+
+/**
+ * @brief
+ * Get the aggregate of the values in the window, in arrival order
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return T Aggregate, the identity if the window is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+T WindowAggregator<T, Op>::query() const
+{
+    if (m_split == 0)
+        return m_back;
+
+    return m_op(m_entries[0], m_back);
+}
+
+/**
+ * @brief
+ * Prints the aggregate to a string
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::string String representation of the aggregate
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::string WindowAggregator<T, Op>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Turn every raw value into the aggregate from its slot to the end, so the
+ * whole buffer becomes the front part
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void WindowAggregator<T, Op>::flip()
+{
+    auto const size{m_entries.get_size()};
+
+    for (std::size_t i{size - 1}; i-- > 0;)
+        m_entries[i] = m_op(m_entries[i], m_entries[i + 1]);
+
+    m_split = size;
+    m_back = m_identity;
+}
+
+#endif //! WINDOW_AGGREGATOR_CPP
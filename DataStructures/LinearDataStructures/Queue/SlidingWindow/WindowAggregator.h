@@ -0,0 +1,86 @@
+/**
+ * @file WindowAggregator.h
+ * @author Carlos Salguero
+ * @brief Declaration of the WindowAggregator class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef WINDOW_AGGREGATOR_H
+#define WINDOW_AGGREGATOR_H
+
+#include <cstddef>    // std::size_t
+#include <functional> // std::plus
+#include <sstream>    // std::stringstream for to_string()
+#include <string>
+
+#include "../../RingBuffer/RingBuffer.cpp"
+
+/**
+ * @brief
+ * FIFO window that keeps the aggregate of its values under any associative
+ * operation with an identity (a monoid: sum, product, min, max, gcd, matrix
+ * product...), in O(1) amortized per value. The operation does not need an
+ * inverse, and it does not need to be commutative: the aggregate is always
+ * value_0 op value_1 op ... in arrival order.
+ *
+ * It is the two-stacks algorithm kept in one RingBuffer. The front part of
+ * the buffer holds, for each slot, the aggregate from that slot to the end
+ * of the front part; the back part holds the raw values plus their running
+ * aggregate. Removing from an empty front part turns the whole back part
+ * into front aggregates in one pass.
+ *
+ * With a window size, push removes the oldest value once the window is
+ * full; with a window of 0 the caller removes values with pop().
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ */
+template <class T, class Op = std::plus<T>>
+class WindowAggregator
+{
+public:
+    // Constructor
+    explicit WindowAggregator(std::size_t window = 0, T identity = T{}, Op op = Op{});
+
+    // Destructor
+    ~WindowAggregator() = default;
+
+    // Operator overloads
+    template <class ostream_t, class op_t>
+    friend std::ostream &operator<<(std::ostream &, const WindowAggregator<ostream_t, op_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t get_window() const;
+
+    // Functions
+    bool is_empty() const;
+
+    void push(const T &);
+
+    template <class InputIt>
+    void push_range(InputIt, InputIt);
+
+    void pop();
+    void clear();
+
+    T query() const;
+    std::string to_string() const;
+
+private:
+    // [0, m_split) front aggregates, [m_split, size) raw values
+    RingBuffer<T> m_entries;
+    std::size_t m_split{};
+
+    T m_identity;
+    T m_back;
+    Op m_op;
+    std::size_t m_window;
+
+    void flip();
+};
+
+#endif //! WINDOW_AGGREGATOR_H
@@ -0,0 +1,579 @@
+/**
+ * @file RingBuffer.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the RingBuffer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RING_BUFFER_CPP
+#define RING_BUFFER_CPP
+
+#include <algorithm>   // std::max(), std::min(), std::move()
+#include <bit>         // std::bit_ceil()
+#include <stdexcept>   // std::runtime_error
+#include <type_traits> // std::is_trivially_destructible_v
+#include <utility>     // std::exchange(), std::forward(), std::swap()
+
+#include "RingBuffer.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new RingBuffer< T>:: RingBuffer object with room for at least
+ * capacity elements
+ * @tparam T Type of the data
+ * @param capacity Number of elements to reserve
+ */
+template <class T>
+RingBuffer<T>::RingBuffer(std::size_t capacity)
+{
+    reserve(capacity);
+}
+
+/**
+ * @brief
+ * Construct a new RingBuffer< T>:: RingBuffer object as a copy of other.
+ * The copy starts at slot 0.
+ * @tparam T Type of the data
+ * @param other Buffer to be copied
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+RingBuffer<T>::RingBuffer(const RingBuffer &other)
+{
+    reserve(other.m_size);
+
+    for (std::size_t i{}; i < other.m_size; ++i)
+        push_back(other[i]);
+}
+
+/**
+ * @brief
+ * Construct a new RingBuffer< T>:: RingBuffer object taking the storage of
+ * other, which is left empty
+ * @tparam T Type of the data
+ * @param other Buffer to be moved
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+RingBuffer<T>::RingBuffer(RingBuffer &&other) noexcept
+    : m_data{std::exchange(other.m_data, nullptr)},
+      m_capacity{std::exchange(other.m_capacity, 0)},
+      m_head{std::exchange(other.m_head, 0)},
+      m_size{std::exchange(other.m_size, 0)}
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the RingBuffer< T>:: RingBuffer object
+ * @tparam T Type of the data
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T>
+RingBuffer<T>::~RingBuffer()
+{
+    clear();
+
+    if (m_data != nullptr)
+        allocator_t{}.deallocate(m_data, m_capacity);
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Copy and move assignment
+ * @tparam T Type of the data
+ * @param other Buffer to be assigned
+ * @return RingBuffer& Reference to this buffer
+ */
+template <class T>
+RingBuffer<T> &RingBuffer<T>::operator=(RingBuffer other)
+{
+    std::swap(m_data, other.m_data);
+    std::swap(m_capacity, other.m_capacity);
+    std::swap(m_head, other.m_head);
+    std::swap(m_size, other.m_size);
+
+    return *this;
+}
+
+/**
+ * @brief
+ * Access the element at an index, 0 being the front. The index is not
+ * checked.
+ * @tparam T Type of the data
+ * @param index Index of the element
+ * @return T& Element at the index
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &RingBuffer<T>::operator[](std::size_t index)
+{
+    return m_data[slot(index)];
+}
+
+template <class T>
+const T &RingBuffer<T>::operator[](std::size_t index) const
+{
+    return m_data[slot(index)];
+}
+
+/**
+ * @brief
+ * Overload the << operator, front first
+ * @tparam ostream_t Type of the data
+ * @param os Output stream
+ * @param buffer Buffer to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t>
+std::ostream &operator<<(std::ostream &os, const RingBuffer<ostream_t> &buffer)
+{
+    for (std::size_t i{}; i < buffer.m_size; ++i)
+        os << buffer[i] << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @return std::size_t Size of the buffer
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t RingBuffer<T>::get_size() const
+{
+    return m_size;
+}
+
+/**
+ * @brief
+ * Get the number of elements that fit before the buffer grows
+ * @tparam T Type of the data
+ * @return std::size_t Capacity, 0 or a power of two
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t RingBuffer<T>::capacity() const
+{
+    return m_capacity;
+}
+
+/**
+ * @brief
+ * Get the first element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the buffer is empty
+ * @return T& First element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &RingBuffer<T>::front()
+{
+    if (is_empty())
+        throw std::runtime_error("Buffer is empty");
+
+    return m_data[m_head];
+}
+
+template <class T>
+const T &RingBuffer<T>::front() const
+{
+    if (is_empty())
+        throw std::runtime_error("Buffer is empty");
+
+    return m_data[m_head];
+}
+
+/**
+ * @brief
+ * Get the last element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the buffer is empty
+ * @return T& Last element
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+T &RingBuffer<T>::back()
+{
+    if (is_empty())
+        throw std::runtime_error("Buffer is empty");
+
+    return m_data[slot(m_size - 1)];
+}
+
+template <class T>
+const T &RingBuffer<T>::back() const
+{
+    if (is_empty())
+        throw std::runtime_error("Buffer is empty");
+
+    return m_data[slot(m_size - 1)];
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the buffer is empty
+ * @tparam T Type of the data
+ * @return true If the buffer is empty
+ * @return false If the buffer is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool RingBuffer<T>::is_empty() const
+{
+    return m_size == 0;
+}
+
+/**
+ * @brief
+ * Checks if the buffer contains a value
+ * @tparam T Type of the data
+ * @param value Value to be searched
+ * @return true If the value is found
+ * @return false If the value is not found
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+bool RingBuffer<T>::contains(const T &value) const
+{
+    for (std::size_t i{}; i < m_size; ++i)
+        if ((*this)[i] == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief
+ * Make room for at least capacity elements. The capacity is rounded up to
+ * a power of two and never shrinks.
+ * @tparam T Type of the data
+ * @param capacity Number of elements
+ * @time complexity O(n) if the buffer grows, O(1) otherwise
+ * @space complexity O(capacity)
+ */
+template <class T>
+void RingBuffer<T>::reserve(std::size_t capacity)
+{
+    if (capacity > m_capacity)
+        grow(std::bit_ceil(std::max(capacity, MIN_CAPACITY)));
+}
+
+/**
+ * @brief
+ * Destroy every element. The capacity is kept.
+ * @tparam T Type of the data
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T>
+void RingBuffer<T>::clear()
+{
+    if constexpr (!std::is_trivially_destructible_v<T>)
+        for (std::size_t i{}; i < m_size; ++i)
+            std::destroy_at(m_data + slot(i));
+
+    m_head = 0;
+    m_size = 0;
+}
+
+/**
+ * @brief
+ * Construct an element in place at the back
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return T& The new element
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+template <class... Args>
+T &RingBuffer<T>::emplace_back(Args &&...args)
+{
+    T *element;
+
+    if (m_size == m_capacity)
+    {
+        // The arguments may refer to an element of this buffer, so the value
+        // is built before the old storage goes away
+        T value(std::forward<Args>(args)...);
+
+        grow(std::max(2 * m_capacity, MIN_CAPACITY));
+        element = std::construct_at(m_data + slot(m_size), std::move(value));
+    }
+    else
+        element = std::construct_at(m_data + slot(m_size), std::forward<Args>(args)...);
+
+    ++m_size;
+
+    return *element;
+}
+
+/**
+ * @brief
+ * Add an element at the back
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void RingBuffer<T>::push_back(const T &value)
+{
+    emplace_back(value);
+}
+
+/**
+ * @brief
+ * Add an element at the back
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void RingBuffer<T>::push_back(T &&value)
+{
+    emplace_back(std::move(value));
+}
+
+/**
+ * @brief
+ * Add every element of [first, last) at the back, in order. Forward ranges
+ * grow the buffer at most once and are copied in at most two contiguous
+ * blocks.
+ * @tparam T Type of the data
+ * @tparam InputIt Type of the iterators
+ * @param first Beginning of the range
+ * @param last End of the range
+ * @time complexity O(k) for k elements
+ * @space complexity O(k)
+ */
+template <class T>
+template <class InputIt>
+void RingBuffer<T>::push_range(InputIt first, InputIt last)
+{
+    if constexpr (std::forward_iterator<InputIt>)
+    {
+        auto const count{static_cast<std::size_t>(std::distance(first, last))};
+
+        reserve(m_size + count);
+
+        auto const tail{slot(m_size)};
+        auto const before_wrap{std::min(count, m_capacity - tail)};
+
+        std::uninitialized_copy_n(first, before_wrap, m_data + tail);
+        m_size += before_wrap;
+
+        std::uninitialized_copy_n(std::next(first, before_wrap),
+                                  count - before_wrap, m_data);
+        m_size += count - before_wrap;
+    }
+    else
+        for (; first != last; ++first)
+            emplace_back(*first);
+}
+
+/**
+ * @brief
+ * Remove the first element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the buffer is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void RingBuffer<T>::pop_front()
+{
+    if (is_empty())
+        throw std::runtime_error("Buffer is empty");
+
+    std::destroy_at(m_data + m_head);
+    m_head = slot(1);
+    --m_size;
+}
+
+/**
+ * @brief
+ * Remove the last element
+ * @tparam T Type of the data
+ * @throw std::runtime_error If the buffer is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void RingBuffer<T>::pop_back()
+{
+    if (is_empty())
+        throw std::runtime_error("Buffer is empty");
+
+    std::destroy_at(m_data + slot(m_size - 1));
+    --m_size;
+}
+
+/**
+ * @brief
+ * Move up to count elements from the front into out, front first, and
+ * remove them
+ * @tparam T Type of the data
+ * @tparam OutputIt Type of the output iterator
+ * @param out Destination of the elements
+ * @param count Maximum number of elements
+ * @return std::size_t Number of elements removed
+ * @time complexity O(k) for k elements
+ * @space complexity O(1)
+ */
+template <class T>
+template <class OutputIt>
+std::size_t RingBuffer<T>::pop_front_n(OutputIt out, std::size_t count)
+{
+    count = std::min(count, m_size);
+
+    auto const before_wrap{std::min(count, m_capacity - m_head)};
+    auto *const first{m_data + m_head};
+
+    out = std::move(first, first + before_wrap, out);
+    std::move(m_data, m_data + (count - before_wrap), out);
+
+    std::destroy(first, first + before_wrap);
+    std::destroy(m_data, m_data + (count - before_wrap));
+
+    m_head = slot(count);
+    m_size -= count;
+
+    return count;
+}
+
+/**
+ * @brief
+ * Move up to count elements from the back into out, back first, and
+ * remove them
+ * @tparam T Type of the data
+ * @tparam OutputIt Type of the output iterator
+ * @param out Destination of the elements
+ * @param count Maximum number of elements
+ * @return std::size_t Number of elements removed
+ * @time complexity O(k) for k elements
+ * @space complexity O(1)
+ */
+template <class T>
+template <class OutputIt>
+std::size_t RingBuffer<T>::pop_back_n(OutputIt out, std::size_t count)
+{
+    count = std::min(count, m_size);
+
+    if (count == 0)
+        return 0;
+
+    auto *const end{m_data + slot(m_size - 1) + 1};
+    auto const before_wrap{std::min<std::size_t>(count, end - m_data)};
+    auto *const wrapped_end{m_data + m_capacity};
+    auto const after_wrap{count - before_wrap};
+
+    out = std::move(std::reverse_iterator{end},
+                    std::reverse_iterator{end - before_wrap}, out);
+    std::move(std::reverse_iterator{wrapped_end},
+              std::reverse_iterator{wrapped_end - after_wrap}, out);
+
+    std::destroy(end - before_wrap, end);
+    std::destroy(wrapped_end - after_wrap, wrapped_end);
+
+    m_size -= count;
+
+    return count;
+}
+
+/**
+ * @brief
+ * Prints the buffer to a string
+ * @tparam T Type of the data
+ * @return std::string String representation of the buffer
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string RingBuffer<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Slot of the element at an index
+ * @tparam T Type of the data
+ * @param index Index of the element, 0 being the front
+ * @return std::size_t Position in the storage
+ */
+template <class T>
+std::size_t RingBuffer<T>::slot(std::size_t index) const
+{
+    return (m_head + index) & (m_capacity - 1);
+}
+
+/**
+ * @brief
+ * Move the elements to a new block of the given capacity, front at slot 0
+ * @tparam T Type of the data
+ * @param capacity New capacity, a power of two not below the size
+ * @time complexity O(n)
+ * @space complexity O(capacity)
+ */
+template <class T>
+void RingBuffer<T>::grow(std::size_t capacity)
+{
+    allocator_t allocator;
+    auto *const data{allocator.allocate(capacity)};
+    std::size_t moved{};
+
+    try
+    {
+        for (; moved < m_size; ++moved)
+            std::construct_at(data + moved, std::move_if_noexcept((*this)[moved]));
+    }
+    catch (...)
+    {
+        std::destroy(data, data + moved);
+        allocator.deallocate(data, capacity);
+        throw;
+    }
+
+    auto const size{m_size};
+    clear();
+
+    if (m_data != nullptr)
+        allocator.deallocate(m_data, m_capacity);
+
+    m_data = data;
+    m_capacity = capacity;
+    m_size = size;
+}
+
+#endif //! RING_BUFFER_CPP
@@ -0,0 +1,98 @@
+/**
+ * @file RingBuffer.h
+ * @author Carlos Salguero
+ * @brief Declaration of the RingBuffer class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <cstddef>  // std::size_t
+#include <iterator> // std::forward_iterator
+#include <memory>   // std::allocator
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+/**
+ * @brief
+ * Growable circular array. The elements live in one contiguous block whose
+ * capacity is always a power of two, so the slot of the i-th element is
+ * (head + i) & (capacity - 1). Both ends support O(1) insertion and
+ * removal; it is the storage behind RingStack and RingQueue.
+ * @tparam T Type of the data
+ */
+template <class T>
+class RingBuffer
+{
+public:
+    static constexpr std::size_t MIN_CAPACITY = 8;
+
+    // Constructor
+    RingBuffer() = default;
+    explicit RingBuffer(std::size_t);
+    RingBuffer(const RingBuffer &);
+    RingBuffer(RingBuffer &&) noexcept;
+
+    // Destructor
+    ~RingBuffer();
+
+    // Operator overloads
+    RingBuffer &operator=(RingBuffer);
+    T &operator[](std::size_t);
+    const T &operator[](std::size_t) const;
+
+    template <class ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const RingBuffer<ostream_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    T &front();
+    const T &front() const;
+    T &back();
+    const T &back() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    void reserve(std::size_t);
+    void clear();
+
+    template <class... Args>
+    T &emplace_back(Args &&...);
+    void push_back(const T &);
+    void push_back(T &&);
+
+    template <class InputIt>
+    void push_range(InputIt, InputIt);
+
+    void pop_front();
+    void pop_back();
+
+    template <class OutputIt>
+    std::size_t pop_front_n(OutputIt, std::size_t);
+    template <class OutputIt>
+    std::size_t pop_back_n(OutputIt, std::size_t);
+
+    std::string to_string() const;
+
+private:
+    using allocator_t = std::allocator<T>;
+
+    T *m_data{};
+    std::size_t m_capacity{};
+    std::size_t m_head{};
+    std::size_t m_size{};
+
+    std::size_t slot(std::size_t) const;
+    void grow(std::size_t);
+};
+
+#endif //! RING_BUFFER_H
@@ -0,0 +1,305 @@
+/**
+ * @file AggregateStack.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the AggregateStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef AGGREGATE_STACK_CPP
+#define AGGREGATE_STACK_CPP
+
+#include <iterator> // std::forward_iterator, std::distance()
+#include <utility>  // std::forward(), std::move()
+
+#include "AggregateStack.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new AggregateStack< T, Op>:: AggregateStack object with room
+ * for capacity elements before it has to grow
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param capacity Number of elements to reserve
+ * @param op Operation
+ */
+template <class T, class Op>
+AggregateStack<T, Op>::AggregateStack(std::size_t capacity, Op op)
+    : m_buffer{capacity}, m_op{std::move(op)}
+{
+}
+
+// Operator overloading
+/**
+ * @brief
+ * Overload the << operator, values top first
+ * @tparam ostream_t Type of the data
+ * @tparam op_t Associative binary operation
+ * @param os Output stream
+ * @param stack Stack to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, class op_t>
+std::ostream &operator<<(std::ostream &os, const AggregateStack<ostream_t, op_t> &stack)
+{
+    for (auto i{stack.m_buffer.get_size()}; i > 0; --i)
+        os << stack.m_buffer[i - 1].value << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::size_t Size of the stack
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::size_t AggregateStack<T, Op>::get_size() const
+{
+    return m_buffer.get_size();
+}
+
+/**
+ * @brief
+ * Get the number of elements that fit before the stack grows
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::size_t Capacity of the stack
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::size_t AggregateStack<T, Op>::capacity() const
+{
+    return m_buffer.capacity();
+}
+
+// Functions
+/**
+ * @brief
+ * Check if the stack is empty
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return true Stack is empty
+ * @return false Stack is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+bool AggregateStack<T, Op>::is_empty() const
+{
+    return m_buffer.is_empty();
+}
+
+/**
+ * @brief
+ * Check if the stack contains a value
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param value Value to be searched
+ * @return true Stack contains the value
+ * @return false Stack does not contain the value
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+bool AggregateStack<T, Op>::contains(const T &value) const
+{
+    for (std::size_t i{}; i < m_buffer.get_size(); ++i)
+        if (m_buffer[i].value == value)
+            return true;
+
+    return false;
+}
+
+/**
+ * @brief
+ * Make room for at least capacity elements, after which push does not
+ * allocate until the stack holds more
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param capacity Number of elements
+ * @time complexity O(n) if the stack grows, O(1) otherwise
+ * @space complexity O(capacity)
+ */
+template <class T, class Op>
+void AggregateStack<T, Op>::reserve(std::size_t capacity)
+{
+    m_buffer.reserve(capacity);
+}
+
+/**
+ * @brief
+ * Push a value on top of the stack
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param value Value to be copied
+ * @time complexity O(1) amortized, O(1) within the capacity
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void AggregateStack<T, Op>::push(const T &value)
+{
+    emplace(value);
+}
+
+/**
+ * @brief
+ * Push a value on top of the stack
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @param value Value to be moved
+ * @time complexity O(1) amortized, O(1) within the capacity
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void AggregateStack<T, Op>::push(T &&value)
+{
+    emplace(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value on top of the stack and combine it with the aggregate
+ * below it
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return const T& The new value, which cannot be modified in place
+ * because its aggregate depends on it
+ * @time complexity O(1) amortized, O(1) within the capacity
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+template <class... Args>
+const T &AggregateStack<T, Op>::emplace(Args &&...args)
+{
+    T value(std::forward<Args>(args)...);
+
+    auto aggregate{m_buffer.is_empty() ? value : m_op(m_buffer.back().aggregate, value)};
+
+    return m_buffer.emplace_back(Entry{std::move(value), std::move(aggregate)}).value;
+}
+
+/**
+ * @brief
+ * Push a range of values, the last one ends on top
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @tparam InputIt Type of the input iterator
+ * @param first Beginning of the values
+ * @param last End of the values
+ * @time complexity O(k) amortized, k values pushed
+ * @space complexity O(k)
+ */
+template <class T, class Op>
+template <class InputIt>
+void AggregateStack<T, Op>::push_range(InputIt first, InputIt last)
+{
+    if constexpr (std::forward_iterator<InputIt>)
+        m_buffer.reserve(m_buffer.get_size() +
+                         static_cast<std::size_t>(std::distance(first, last)));
+
+    for (; first != last; ++first)
+        emplace(*first);
+}
+
+/**
+ * @brief
+ * Pop the value on top of the stack. The aggregate goes back to the one
+ * stored below it.
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void AggregateStack<T, Op>::pop()
+{
+    if (is_empty())
+        return;
+
+    m_buffer.pop_back();
+}
+
+/**
+ * @brief
+ * Remove every value, keeping the capacity
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @time complexity O(n), O(1) for trivially destructible types
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+void AggregateStack<T, Op>::clear()
+{
+    m_buffer.clear();
+}
+
+/**
+ * @brief
+ * Get the value on top of the stack
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::optional<T> Value on top, std::nullopt if the stack is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::optional<T> AggregateStack<T, Op>::peek() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_buffer.back().value;
+}
+
+/**
+ * @brief
+ * Get the aggregate of every value, from the bottom to the top
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::optional<T> Aggregate, std::nullopt if the stack is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, class Op>
+std::optional<T> AggregateStack<T, Op>::query() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_buffer.back().aggregate;
+}
+
+/**
+ * @brief
+ * Prints the stack to a string, top first
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ * @return std::string String representation of the stack
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, class Op>
+std::string AggregateStack<T, Op>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+#endif //! AGGREGATE_STACK_CPP
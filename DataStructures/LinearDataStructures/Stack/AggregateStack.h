@@ -0,0 +1,120 @@
+/**
+ * @file AggregateStack.h
+ * @author Carlos Salguero
+ * @brief Declaration of the AggregateStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef AGGREGATE_STACK_H
+#define AGGREGATE_STACK_H
+
+#include <cstddef>    // std::size_t
+#include <functional> // std::plus
+#include <optional>   // C++17, std::optional encapsulation
+#include <sstream>    // std::stringstream for to_string()
+#include <string>
+
+#include "../RingBuffer/RingBuffer.cpp"
+
+/**
+ * @brief
+ * Smaller of two values, as an operation for AggregateStack
+ * @tparam T Type of the data
+ */
+template <class T>
+struct MinOp
+{
+    T operator()(const T &lhs, const T &rhs) const { return rhs < lhs ? rhs : lhs; }
+};
+
+/**
+ * @brief
+ * Larger of two values, as an operation for AggregateStack
+ * @tparam T Type of the data
+ */
+template <class T>
+struct MaxOp
+{
+    T operator()(const T &lhs, const T &rhs) const { return lhs < rhs ? rhs : lhs; }
+};
+
+/**
+ * @brief
+ * Stack that keeps, next to every value, the aggregate of that value and
+ * everything below it under an associative operation (sum by default, or
+ * MinOp, MaxOp, or any user-provided one). The aggregate of the whole stack
+ * is the one stored with the top, so it is read in O(1), and pop restores
+ * the previous one for free. Entries live in a RingBuffer like RingStack,
+ * so once enough room is reserved, push and pop never allocate.
+ * @tparam T Type of the data
+ * @tparam Op Associative binary operation
+ */
+template <class T, class Op = std::plus<T>>
+class AggregateStack
+{
+public:
+    // Constructor
+    explicit AggregateStack(std::size_t capacity = 0, Op op = Op{});
+
+    // Destructor
+    ~AggregateStack() = default;
+
+    // Operator overload
+    template <class ostream_t, class op_t>
+    friend std::ostream &operator<<(std::ostream &, const AggregateStack<ostream_t, op_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    void reserve(std::size_t);
+    void push(const T &);
+    void push(T &&);
+
+    template <class... Args>
+    const T &emplace(Args &&...);
+
+    template <class InputIt>
+    void push_range(InputIt, InputIt);
+
+    void pop();
+    void clear();
+
+    std::optional<T> peek() const;
+    std::optional<T> query() const;
+    std::string to_string() const;
+
+private:
+    struct Entry
+    {
+        T value;
+        T aggregate;
+    };
+
+    RingBuffer<Entry> m_buffer;
+    Op m_op;
+};
+
+/**
+ * @brief
+ * Stack with an O(1) running minimum
+ */
+template <class T>
+using MinStack = AggregateStack<T, MinOp<T>>;
+
+/**
+ * @brief
+ * Stack with an O(1) running maximum
+ */
+template <class T>
+using MaxStack = AggregateStack<T, MaxOp<T>>;
+
+#endif //! AGGREGATE_STACK_H
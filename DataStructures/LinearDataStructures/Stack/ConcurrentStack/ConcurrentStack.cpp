@@ -0,0 +1,326 @@
+/**
+ * @file ConcurrentStack.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the ConcurrentStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_STACK_CPP
+#define CONCURRENT_STACK_CPP
+
+#include <cstdint>    // std::uint64_t
+#include <functional> // std::hash
+#include <memory>     // std::destroy_at()
+#include <thread>     // std::this_thread::yield()
+#include <utility>    // std::forward(), std::move()
+
+#include "ConcurrentStack.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new ConcurrentStack< T>:: ConcurrentStack object
+ * @tparam T Type of the data
+ * @param elimination Whether contended operations back off into the
+ * elimination array or simply retry on the head
+ */
+template <class T>
+ConcurrentStack<T>::ConcurrentStack(bool elimination)
+    : m_elimination{elimination}
+{
+}
+
+// Destructor
+/**
+ * @brief
+ * Destroy the ConcurrentStack< T>:: ConcurrentStack object and the values
+ * left in it. No thread may be using the stack any more.
+ * @tparam T Type of the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+ConcurrentStack<T>::~ConcurrentStack()
+{
+    auto *node{m_head.load(std::memory_order_relaxed)};
+
+    while (node != nullptr)
+    {
+        auto *const next{node->next.load(std::memory_order_relaxed)};
+
+        std::destroy_at(node->value());
+        node_t::recycle(node);
+        node = next;
+    }
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator, top first. Only valid while no other thread
+ * is using the stack.
+ * @tparam ostream_t Type of the data
+ * @param os Output stream
+ * @param stack Stack to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t>
+std::ostream &operator<<(std::ostream &os, const ConcurrentStack<ostream_t> &stack)
+{
+    auto *node{stack.m_head.load(std::memory_order_acquire)};
+
+    for (; node != nullptr; node = node->next.load(std::memory_order_relaxed))
+        os << *node->value() << " ";
+
+    return os;
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the stack is empty, as a snapshot
+ * @tparam T Type of the data
+ * @return true If the stack is empty
+ * @return false If the stack is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool ConcurrentStack<T>::is_empty() const
+{
+    return m_head.load(std::memory_order_acquire) == nullptr;
+}
+
+/**
+ * @brief
+ * Push a value on top of the stack
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+void ConcurrentStack<T>::push(const T &value)
+{
+    emplace(value);
+}
+
+/**
+ * @brief
+ * Push a value on top of the stack
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+void ConcurrentStack<T>::push(T &&value)
+{
+    emplace(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value in a new node and push it on top of the stack
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+template <class... Args>
+void ConcurrentStack<T>::emplace(Args &&...args)
+{
+    auto *const node{node_t::create()};
+
+    try
+    {
+        node->construct(std::forward<Args>(args)...);
+    }
+    catch (...)
+    {
+        node_t::recycle(node);
+        throw;
+    }
+
+    auto const guard{EpochManager::instance().pin()};
+    auto *head{m_head.load(std::memory_order_relaxed)};
+
+    while (true)
+    {
+        node->next.store(head, std::memory_order_relaxed);
+
+        if (m_head.compare_exchange_weak(head, node, std::memory_order_release,
+                                         std::memory_order_relaxed))
+            return;
+
+        if (m_elimination && offer(node))
+            return;
+
+        head = m_head.load(std::memory_order_relaxed);
+    }
+}
+
+/**
+ * @brief
+ * Remove the value on top of the stack
+ * @tparam T Type of the data
+ * @return std::optional<T> Value removed, std::nullopt if the stack is empty
+ * @time complexity O(1) expected, lock-free
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> ConcurrentStack<T>::pop()
+{
+    auto const guard{EpochManager::instance().pin()};
+    auto *head{m_head.load(std::memory_order_acquire)};
+
+    while (head != nullptr)
+    {
+        // The node cannot be freed while this thread is pinned
+        auto *const next{head->next.load(std::memory_order_relaxed)};
+
+        if (m_head.compare_exchange_weak(head, next, std::memory_order_acquire,
+                                         std::memory_order_acquire))
+            return release(head);
+
+        if (m_elimination)
+            if (auto *const node{take_offer()})
+                return release(node);
+
+        head = m_head.load(std::memory_order_acquire);
+    }
+
+    return std::nullopt;
+}
+
+/**
+ * @brief
+ * Prints the stack to a string. Only valid while no other thread is using
+ * the stack.
+ * @tparam T Type of the data
+ * @return std::string String representation of the stack
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string ConcurrentStack<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
+
+// Private Functions
+/**
+ * @brief
+ * Offer a node to a pop in a random elimination slot and wait a little
+ * for one to take it. The calling thread has to be pinned.
+ * @tparam T Type of the data
+ * @param node Node holding the value being pushed
+ * @return true If a pop took the node
+ * @return false If no pop came, the node is still owned by the caller
+ * @time complexity O(ELIMINATION_SPINS)
+ * @space complexity O(1)
+ */
+template <class T>
+bool ConcurrentStack<T>::offer(node_t *node)
+{
+    auto &slot{pick()};
+    node_t *expected{nullptr};
+
+    if (!slot.offer.compare_exchange_strong(expected, node, std::memory_order_release,
+                                            std::memory_order_relaxed))
+        return false;
+
+    // A pop empties the slot when it takes the node. The node cannot come
+    // back to this slot while this thread is pinned, so another pointer
+    // means it was taken.
+    for (std::size_t spin{}; spin < ELIMINATION_SPINS; ++spin)
+    {
+        if (slot.offer.load(std::memory_order_relaxed) != node)
+            return true;
+
+        std::this_thread::yield();
+    }
+
+    expected = node;
+
+    return !slot.offer.compare_exchange_strong(expected, nullptr, std::memory_order_relaxed,
+                                               std::memory_order_relaxed);
+}
+
+/**
+ * @brief
+ * Take the node offered in a random elimination slot, if any
+ * @tparam T Type of the data
+ * @return node_t* Node taken, nullptr if the slot was empty or another pop
+ * was faster
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename ConcurrentStack<T>::node_t *ConcurrentStack<T>::take_offer()
+{
+    auto &slot{pick()};
+    auto *node{slot.offer.load(std::memory_order_acquire)};
+
+    if (node == nullptr ||
+        !slot.offer.compare_exchange_strong(node, nullptr, std::memory_order_acquire,
+                                            std::memory_order_relaxed))
+        return nullptr;
+
+    return node;
+}
+
+/**
+ * @brief
+ * Move the value out of a node this thread removed and retire the node
+ * @tparam T Type of the data
+ * @param node Node removed from the stack or taken from an offer
+ * @return std::optional<T> Value of the node
+ * @time complexity O(1) amortized
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> ConcurrentStack<T>::release(node_t *node)
+{
+    std::optional<T> value{std::move(*node->value())};
+    std::destroy_at(node->value());
+
+    EpochManager::instance().retire(node, &node_t::recycle);
+
+    return value;
+}
+
+/**
+ * @brief
+ * Pick an elimination slot at random, so that pushes and pops spread over
+ * the array
+ * @tparam T Type of the data
+ * @return Slot& The slot
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+typename ConcurrentStack<T>::Slot &ConcurrentStack<T>::pick()
+{
+    thread_local std::uint64_t seed{
+        0x9E3779B97F4A7C15ULL ^ std::hash<std::thread::id>{}(std::this_thread::get_id())};
+
+    seed ^= seed << 13;
+    seed ^= seed >> 7;
+    seed ^= seed << 17;
+
+    return m_slots[seed % ELIMINATION_SLOTS];
+}
+
+#endif //! CONCURRENT_STACK_CPP
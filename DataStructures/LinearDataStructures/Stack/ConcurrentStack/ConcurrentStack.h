@@ -0,0 +1,93 @@
+/**
+ * @file ConcurrentStack.h
+ * @author Carlos Salguero
+ * @brief Declaration of the ConcurrentStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef CONCURRENT_STACK_H
+#define CONCURRENT_STACK_H
+
+#include <array>
+#include <atomic>
+#include <cstddef>  // std::size_t
+#include <optional> // C++17, std::optional encapsulation
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+// Custom Headers
+#include "../../Queue/ConcurrentQueue/ConcurrentQueueNode.h"
+#include "../../../Concurrency/EpochManager.h"
+
+/**
+ * @brief
+ * Unbounded lock-free LIFO stack (Treiber) with an elimination-backoff
+ * array. push and pop swing the head with a compare-and-swap. A thread
+ * whose compare-and-swap fails backs off into the elimination array
+ * instead of retrying on the head right away: a push offers its node in a
+ * random slot and waits a little, and a pop that finds an offer takes the
+ * node directly. Such a pair cancels out without touching the head, so the
+ * more threads contend, the more operations complete away from it.
+ *
+ * Popped nodes are retired through the EpochManager, so no node is reused
+ * while another thread may still be reading it; this rules out the ABA
+ * problem on the head and on the elimination slots.
+ * @tparam T Type of the data
+ */
+template <class T>
+class ConcurrentStack
+{
+public:
+    using node_t = ConcurrentQueueNode<T>;
+
+    static constexpr std::size_t ELIMINATION_SLOTS = 16;
+    static constexpr std::size_t ELIMINATION_SPINS = 32;
+
+    // Constructor
+    explicit ConcurrentStack(bool elimination = true);
+    ConcurrentStack(const ConcurrentStack &) = delete;
+
+    // Destructor
+    ~ConcurrentStack();
+
+    // Operator overloads
+    ConcurrentStack &operator=(const ConcurrentStack &) = delete;
+
+    template <class ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const ConcurrentStack<ostream_t> &);
+
+    // Functions
+    bool is_empty() const;
+
+    void push(const T &);
+    void push(T &&);
+
+    template <class... Args>
+    void emplace(Args &&...);
+
+    std::optional<T> pop();
+
+    std::string to_string() const;
+
+private:
+    struct alignas(64) Slot
+    {
+        std::atomic<node_t *> offer{nullptr};
+    };
+
+    alignas(64) std::atomic<node_t *> m_head{nullptr};
+    alignas(64) std::array<Slot, ELIMINATION_SLOTS> m_slots{};
+    bool m_elimination;
+
+    bool offer(node_t *);
+    node_t *take_offer();
+    std::optional<T> release(node_t *);
+
+    Slot &pick();
+};
+
+#endif //! CONCURRENT_STACK_H
@@ -0,0 +1,204 @@
+/**
+ * @file PersistentStack.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the PersistentStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PERSISTENT_STACK_CPP
+#define PERSISTENT_STACK_CPP
+
+#include <utility> // std::forward(), std::move()
+
+#include "PersistentStack.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new PersistentStack< T, ThreadSafe>:: PersistentStack object
+ * over a version of the list, top first
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param list Values of the stack
+ */
+template <class T, bool ThreadSafe>
+PersistentStack<T, ThreadSafe>::PersistentStack(PersistentList<T, ThreadSafe> list)
+    : m_list{std::move(list)}
+{
+}
+
+// Operator overloads
+/**
+ * @brief
+ * Overload the << operator, top first
+ * @tparam ostream_t Type of the data
+ * @tparam thread_safe Whether versions may be shared between threads
+ * @param os Output stream
+ * @param stack Stack to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class ostream_t, bool thread_safe>
+std::ostream &operator<<(std::ostream &os, const PersistentStack<ostream_t, thread_safe> &stack)
+{
+    return os << stack.m_list;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return std::size_t Size of the stack
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+std::size_t PersistentStack<T, ThreadSafe>::get_size() const
+{
+    return m_list.get_size();
+}
+
+// Functions
+/**
+ * @brief
+ * Checks if the stack is empty
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return true If the stack is empty
+ * @return false If the stack is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+bool PersistentStack<T, ThreadSafe>::is_empty() const
+{
+    return m_list.is_empty();
+}
+
+/**
+ * @brief
+ * Checks if the stack contains a value
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param value Value to be searched
+ * @return true If the value is in the stack
+ * @return false If the value is not in the stack
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+bool PersistentStack<T, ThreadSafe>::contains(const T &value) const
+{
+    return m_list.contains(value);
+}
+
+/**
+ * @brief
+ * Get a new version with a value on top of this one
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param value Value to be copied
+ * @return PersistentStack New version
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentStack<T, ThreadSafe> PersistentStack<T, ThreadSafe>::push(const T &value) const
+{
+    return PersistentStack{m_list.push_front(value)};
+}
+
+/**
+ * @brief
+ * Get a new version with a value on top of this one
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @param value Value to be moved
+ * @return PersistentStack New version
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentStack<T, ThreadSafe> PersistentStack<T, ThreadSafe>::push(T &&value) const
+{
+    return PersistentStack{m_list.push_front(std::move(value))};
+}
+
+/**
+ * @brief
+ * Get a new version with a value constructed on top of this one
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return PersistentStack New version
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+template <class... Args>
+PersistentStack<T, ThreadSafe> PersistentStack<T, ThreadSafe>::emplace(Args &&...args) const
+{
+    return PersistentStack{m_list.emplace_front(std::forward<Args>(args)...)};
+}
+
+/**
+ * @brief
+ * Get the version without the top. Popping an empty stack gives an empty
+ * stack, like Stack::pop().
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return PersistentStack Version below the top
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+PersistentStack<T, ThreadSafe> PersistentStack<T, ThreadSafe>::pop() const
+{
+    if (is_empty())
+        return *this;
+
+    return PersistentStack{m_list.pop_front()};
+}
+
+/**
+ * @brief
+ * Get the top of the stack
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return std::optional<T> Top value, std::nullopt if the stack is empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T, bool ThreadSafe>
+std::optional<T> PersistentStack<T, ThreadSafe>::peek() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_list.front();
+}
+
+/**
+ * @brief
+ * Prints the stack to a string, top first
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ * @return std::string String representation of the stack
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T, bool ThreadSafe>
+std::string PersistentStack<T, ThreadSafe>::to_string() const
+{
+    return m_list.to_string();
+}
+
+#endif //! PERSISTENT_STACK_CPP
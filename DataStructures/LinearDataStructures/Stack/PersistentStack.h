@@ -0,0 +1,72 @@
+/**
+ * @file PersistentStack.h
+ * @author Carlos Salguero
+ * @brief Declaration of the PersistentStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef PERSISTENT_STACK_H
+#define PERSISTENT_STACK_H
+
+#include <cstddef>  // std::size_t
+#include <optional> // C++17, std::optional encapsulation
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+#include "../LinkedLists/PersistentList/PersistentList.cpp"
+
+/**
+ * @brief
+ * Immutable stack on top of a PersistentList. push and pop return a new
+ * version in O(1) and leave the old one untouched, every version sharing
+ * the values below its top with the versions it came from. Copying a stack
+ * is O(1), so keeping a snapshot at every step costs one node per push.
+ * @tparam T Type of the data
+ * @tparam ThreadSafe Whether versions may be shared between threads
+ */
+template <class T, bool ThreadSafe = true>
+class PersistentStack
+{
+public:
+    // Constructor
+    PersistentStack() = default;
+
+    // Destructor
+    ~PersistentStack() = default;
+
+    // Operator overloads
+    bool operator==(const PersistentStack &) const = default;
+
+    template <class ostream_t, bool thread_safe>
+    friend std::ostream &operator<<(std::ostream &,
+                                    const PersistentStack<ostream_t, thread_safe> &);
+
+    // Getters
+    std::size_t get_size() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    [[nodiscard]] PersistentStack push(const T &) const;
+    [[nodiscard]] PersistentStack push(T &&) const;
+
+    template <class... Args>
+    [[nodiscard]] PersistentStack emplace(Args &&...) const;
+
+    [[nodiscard]] PersistentStack pop() const;
+
+    std::optional<T> peek() const;
+    std::string to_string() const;
+
+private:
+    PersistentList<T, ThreadSafe> m_list;
+
+    explicit PersistentStack(PersistentList<T, ThreadSafe>);
+};
+
+#endif //! PERSISTENT_STACK_H
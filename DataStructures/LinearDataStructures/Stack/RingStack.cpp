@@ -0,0 +1,265 @@
+/**
+ * @file RingStack.cpp
+ * @author Carlos Salguero
+ * @brief Implementation of the RingStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#include <utility> // std::forward(), std::move()
+
+#include "RingStack.h"
+
+// Constructor
+/**
+ * @brief
+ * Construct a new RingStack< T>:: RingStack object with room for capacity
+ * elements before it has to grow
+ * @tparam T Type of the data
+ * @param capacity Number of elements to reserve
+ */
+template <class T>
+RingStack<T>::RingStack(std::size_t capacity) : m_buffer{capacity}
+{
+}
+
+// Operator overloading
+/**
+ * @brief
+ * Overload the << operator, top first
+ * @tparam T Type of the data
+ * @param os Output stream
+ * @param stack Stack to be printed
+ * @return std::ostream& Output stream
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <typename ostream_t>
+std::ostream &operator<<(std::ostream &os, const RingStack<ostream_t> &stack)
+{
+    for (auto i{stack.m_buffer.get_size()}; i > 0; --i)
+        os << stack.m_buffer[i - 1] << " ";
+
+    return os;
+}
+
+// Getters
+/**
+ * @brief
+ * Get the number of elements
+ * @tparam T Type of the data
+ * @return std::size_t Size of the stack
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t RingStack<T>::get_size() const
+{
+    return m_buffer.get_size();
+}
+
+/**
+ * @brief
+ * Get the number of elements that fit before the stack grows
+ * @tparam T Type of the data
+ * @return std::size_t Capacity of the stack
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::size_t RingStack<T>::capacity() const
+{
+    return m_buffer.capacity();
+}
+
+// Functions
+/**
+ * @brief
+ * Check if the stack is empty
+ * @tparam T Type of the data
+ * @return true Stack is empty
+ * @return false Stack is not empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+bool RingStack<T>::is_empty() const
+{
+    return m_buffer.is_empty();
+}
+
+/**
+ * @brief
+ * Check if the stack contains a value
+ * @tparam T Type of the data
+ * @param value Value to be searched
+ * @return true Stack contains the value
+ * @return false Stack does not contain the value
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+bool RingStack<T>::contains(const T &value) const
+{
+    return m_buffer.contains(value);
+}
+
+/**
+ * @brief
+ * Make room for at least capacity elements
+ * @tparam T Type of the data
+ * @param capacity Number of elements
+ * @time complexity O(n) if the stack grows, O(1) otherwise
+ * @space complexity O(capacity)
+ */
+template <class T>
+void RingStack<T>::reserve(std::size_t capacity)
+{
+    m_buffer.reserve(capacity);
+}
+
+/**
+ * @brief
+ * Push a value to the stack
+ * @tparam T Type of the data
+ * @param value Value to be copied
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void RingStack<T>::push(const T &value)
+{
+    m_buffer.push_back(value);
+}
+
+/**
+ * @brief
+ * Push a value to the stack
+ * @tparam T Type of the data
+ * @param value Value to be moved
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+void RingStack<T>::push(T &&value)
+{
+    m_buffer.push_back(std::move(value));
+}
+
+/**
+ * @brief
+ * Construct a value in place on top of the stack
+ * @tparam T Type of the data
+ * @tparam Args Types of the constructor arguments
+ * @param args Arguments forwarded to the constructor of T
+ * @return T& The new top
+ * @time complexity O(1) amortized
+ * @space complexity O(1) amortized
+ */
+template <class T>
+template <class... Args>
+T &RingStack<T>::emplace(Args &&...args)
+{
+    return m_buffer.emplace_back(std::forward<Args>(args)...);
+}
+
+/**
+ * @brief
+ * Push every value of [first, last) in order, so the last one ends on top
+ * @tparam T Type of the data
+ * @tparam InputIt Type of the iterators
+ * @param first Beginning of the range
+ * @param last End of the range
+ * @time complexity O(k) for k values
+ * @space complexity O(k)
+ */
+template <class T>
+template <class InputIt>
+void RingStack<T>::push_range(InputIt first, InputIt last)
+{
+    m_buffer.push_range(first, last);
+}
+
+/**
+ * @brief
+ * Pop a value from the stack
+ * @tparam T Type of the data
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+void RingStack<T>::pop()
+{
+    if (is_empty())
+        return;
+
+    m_buffer.pop_back();
+}
+
+/**
+ * @brief
+ * Pop up to count values, moving them into out from the top down
+ * @tparam T Type of the data
+ * @tparam OutputIt Type of the output iterator
+ * @param out Destination of the values
+ * @param count Maximum number of values
+ * @return std::size_t Number of values popped
+ * @time complexity O(k) for k values
+ * @space complexity O(1)
+ */
+template <class T>
+template <class OutputIt>
+std::size_t RingStack<T>::pop_n(OutputIt out, std::size_t count)
+{
+    return m_buffer.pop_back_n(out, count);
+}
+
+/**
+ * @brief
+ * Clears the stack. The capacity is kept.
+ * @tparam T Type of the data
+ * @time complexity O(n)
+ * @space complexity O(1)
+ */
+template <class T>
+void RingStack<T>::clear()
+{
+    m_buffer.clear();
+}
+
+/**
+ * @brief
+ * Peeks the top of the stack
+ * @tparam T Type of the data
+ * @return std::optional<T> Value at the top, std::nullopt if empty
+ * @time complexity O(1)
+ * @space complexity O(1)
+ */
+template <class T>
+std::optional<T> RingStack<T>::peek() const
+{
+    if (is_empty())
+        return std::nullopt;
+
+    return m_buffer.back();
+}
+
+/**
+ * @brief
+ * Prints the stack to a string
+ * @tparam T Type of the data
+ * @return std::string String representation of the stack
+ * @time complexity O(n)
+ * @space complexity O(n)
+ */
+template <class T>
+std::string RingStack<T>::to_string() const
+{
+    std::stringstream ss;
+    ss << *this;
+
+    return ss.str();
+}
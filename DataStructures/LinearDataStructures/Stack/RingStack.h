@@ -0,0 +1,75 @@
+/**
+ * @file RingStack.h
+ * @author Carlos Salguero
+ * @brief Declaration of the RingStack class
+ * @version 0.1
+ * @date 2026-10-19
+ *
+ * @copyright Copyright (c) 2026
+ *
+ */
+
+#ifndef RING_STACK_H
+#define RING_STACK_H
+
+#include <cstddef>  // std::size_t
+#include <optional> // C++17, std::optional encapsulation
+#include <sstream>  // std::stringstream for to_string()
+#include <string>
+
+#include "../RingBuffer/RingBuffer.cpp"
+
+/**
+ * @brief
+ * Stack stored in a contiguous, growable RingBuffer instead of one node per
+ * element. The top of the stack is the back of the buffer.
+ * @tparam T Type of the data
+ */
+template <class T>
+class RingStack
+{
+public:
+    // Constructor
+    RingStack() = default;
+    explicit RingStack(std::size_t);
+
+    // Destructor
+    ~RingStack() = default;
+
+    // Operator overload
+    template <typename ostream_t>
+    friend std::ostream &operator<<(std::ostream &, const RingStack<ostream_t> &);
+
+    // Getters
+    std::size_t get_size() const;
+    std::size_t capacity() const;
+
+    // Functions
+    bool is_empty() const;
+    bool contains(const T &) const;
+
+    void reserve(std::size_t);
+    void push(const T &);
+    void push(T &&);
+
+    template <class... Args>
+    T &emplace(Args &&...);
+
+    template <class InputIt>
+    void push_range(InputIt, InputIt);
+
+    void pop();
+
+    template <class OutputIt>
+    std::size_t pop_n(OutputIt, std::size_t);
+
+    void clear();
+
+    std::optional<T> peek() const;
+    std::string to_string() const;
+
+private:
+    RingBuffer<T> m_buffer;
+};
+
+#endif //! RING_STACK_H